@@ -27,6 +27,7 @@ public class BlueprintFunctionCreator : ModuleRules
 			"Kismet",
 			"Json",
 			"JsonUtilities",
+			"AssetRegistry",
 		}
 	);
 }
@@ -1,6 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "BlueprintFunctionCreator.h"
+#include "FModelTypeResolver.h"
+#include "FModelNativeTypeIndex.h"
+#include "FModelAssetIndex.h"
+#include "FModelProbeOrder.h"
 
 #define LOCTEXT_NAMESPACE "FBlueprintFunctionCreatorModule"
 
@@ -12,6 +16,10 @@ void FBlueprintFunctionCreatorModule::StartupModule()
 void FBlueprintFunctionCreatorModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module
+	FModelProbeOrder::Save();
+	FModelTypeResolver::Shutdown();
+	FModelNativeTypeIndex::Shutdown();
+	FModelAssetIndex::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -15,27 +15,73 @@
 #include "Engine/SCS_Node.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Misc/FileHelper.h"
-#include "Serialization/JsonSerializer.h"
-#include "Dom/JsonObject.h"
 #include "UObject/SavePackage.h"
 #include "AssetToolsModule.h"
 #include "Factories/BlueprintFactory.h"
 #include "Engine/UserDefinedStruct.h"
 #include "UserDefinedStructure/UserDefinedStructEditorData.h"
 #include "Kismet2/StructureEditorUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "FModelExportParser.h"
+#include "FModelExportFile.h"
+#include "FModelExportClassifier.h"
+#include "FModelExportIndex.h"
+#include "FModelDescriptorCache.h"
+#include "FModelImportScheduler.h"
+#include "FModelImportPipeline.h"
+#include "FModelTypeResolver.h"
+#include "FModelNativeTypeIndex.h"
+#include "FModelAssetIndex.h"
+#include "FModelProbeOrder.h"
+#include "FModelPinFixups.h"
+#include "Async/ParallelFor.h"
+
+static TAutoConsoleVariable<bool> CVarFModelStreamingParse(
+	TEXT("FModel.Parse.Streaming"),
+	true,
+	TEXT("Parse FModel exports in a single forward pass without building a JSON DOM.\n")
+	TEXT("Set to false to use the FJsonSerializer reference path (same outputs, slower)."));
+
+static TAutoConsoleVariable<bool> CVarFModelMappedInput(
+	TEXT("FModel.Parse.MappedInput"),
+	true,
+	TEXT("Memory-map FModel exports and run the streaming parser over the UTF-8 bytes in place.\n")
+	TEXT("Set to false to always load the file into an FString first. UTF-16 exports always take that path."));
+
+static TAutoConsoleVariable<bool> CVarFModelSkipIrrelevantEntries(
+	TEXT("FModel.Parse.SkipIrrelevantEntries"),
+	true,
+	TEXT("Streaming parser: skip export entries the importer never reads (class default objects, bytecode, ...)\n")
+	TEXT("by bracket matching instead of parsing them. Set to false to validate every byte of the export."));
+
+static TAutoConsoleVariable<bool> CVarFModelDescriptorCache(
+	TEXT("FModel.Parse.DescriptorCache"),
+	true,
+	TEXT("Cache parsed descriptors under Saved/FModelImport/DescriptorCache/, keyed by a hash of each export's bytes,\n")
+	TEXT("so byte-identical exports are not parsed again. Set to false to always parse."));
+
+static TAutoConsoleVariable<int32> CVarFModelDescriptorCacheMaxMB(
+	TEXT("FModel.Parse.DescriptorCacheMaxMB"),
+	256,
+	TEXT("Size budget of the descriptor cache in megabytes; least recently used entries are evicted beyond it."));
 
 bool UDummyBlueprintFunctionLibrary::AddFunctionStubToBlueprint(UBlueprint* Blueprint, FName FunctionName, bool bHasReturnValue, const FString& ReturnValueType)
+{
+	return AddFunctionStubFromTypeRef(Blueprint, FunctionName, bHasReturnValue, FFModelTypeRef::Parse(ReturnValueType));
+}
+
+bool UDummyBlueprintFunctionLibrary::AddFunctionStubFromTypeRef(UBlueprint* Blueprint, FName FunctionName, bool bHasReturnValue, const FFModelTypeRef& ReturnType)
 {
 	if (!Blueprint)
 	{
-		UE_LOG(LogTemp, Error, TEXT("AddFunctionStubToBlueprint: Blueprint is null"));
+		UE_LOG(LogTemp, Error, TEXT("AddFunctionStubFromTypeRef: Blueprint is null"));
 		return false;
 	}
 
 	// Validate function name
 	if (FunctionName.IsNone() || !FunctionName.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("AddFunctionStubToBlueprint: Invalid function name"));
+		UE_LOG(LogTemp, Error, TEXT("AddFunctionStubFromTypeRef: Invalid function name"));
 		return false;
 	}
 
@@ -47,33 +93,8 @@ bool UDummyBlueprintFunctionLibrary::AddFunctionStubToBlueprint(UBlueprint* Blue
 		return false;
 	}
 	
-	// Auto-detect if function should have return value based on naming convention
-	// Only use auto-detection if:
-	// 1. bHasReturnValue is false (no return type specified)
-	// 2. ReturnValueType is empty (not found in JSON at all)
-	// 3. ReturnValueType is NOT "VOID" (function found but confirmed no return)
-	// Functions starting with Get, Is, Can, Has, Should, Calc typically return values
-	if (!bHasReturnValue && ReturnValueType.IsEmpty())
-	{
-		if (FuncNameStr.StartsWith(TEXT("Get")) || 
-		    FuncNameStr.StartsWith(TEXT("Is")) ||
-		    FuncNameStr.StartsWith(TEXT("Can")) ||
-		    FuncNameStr.StartsWith(TEXT("Has")) ||
-		    FuncNameStr.StartsWith(TEXT("Should")) ||
-		    FuncNameStr.StartsWith(TEXT("Calc")) ||
-		    FuncNameStr.StartsWith(TEXT("Gey"))) // Typo in original: "GeyEjectionPortTransform"
-		{
-			bHasReturnValue = true;
-			UE_LOG(LogTemp, Log, TEXT("Auto-detected return value for function: %s (no explicit type info)"), *FuncNameStr);
-		}
-	}
-	
-	// If explicitly marked as VOID, ensure no return node is created
-	if (ReturnValueType == TEXT("VOID"))
-	{
-		bHasReturnValue = false;
-		UE_LOG(LogTemp, Log, TEXT("Function %s explicitly has no return value (VOID)"), *FuncNameStr);
-	}
+	// Functions with no type info fall back to the Get/Is/Can... naming convention; "VOID" never has a return node
+	bHasReturnValue = FModelTypeResolver::HasReturnValue(FuncNameStr, bHasReturnValue, ReturnType);
 
 	UE_LOG(LogTemp, Warning, TEXT("Creating graph for function: %s (HasReturnValue: %s)"), *FuncNameStr, bHasReturnValue ? TEXT("true") : TEXT("false"));
 
@@ -123,1025 +144,14 @@ bool UDummyBlueprintFunctionLibrary::AddFunctionStubToBlueprint(UBlueprint* Blue
 	UK2Node_FunctionResult* ResultNode = nullptr;
 	if (bHasReturnValue)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Creating return node for '%s' with type: '%s'"), *FuncNameStr, *ReturnValueType);
+		UE_LOG(LogTemp, Log, TEXT("Creating return node for '%s'"), *FuncNameStr);
 		
 		ResultNode = NewObject<UK2Node_FunctionResult>(NewGraph);
 		ResultNode->CreateNewGuid();
 		ResultNode->PostPlacedNewNode();
 		
-		// Determine the pin type based on ReturnValueType
-		// Format can be:
-		//   "PropertyType" - simple type
-		//   "PropertyType|ClassName" - for native classes/structs
-		//   "PropertyType|ClassName|ClassPath" - for Blueprint classes with full path
-		//   "ArrayProperty|InnerType" - for arrays of simple types
-		//   "ArrayProperty|InnerType|InnerClassName" - for arrays of objects/structs
-		//   "ArrayProperty|InnerType|InnerClassName|InnerClassPath" - for arrays of Blueprint classes
-		FString PropType = ReturnValueType;
-		FString ClassName;
-		FString ClassPath;
-		FString InnerType;  // For arrays
-		
-		int32 SeparatorIdx;
-		if (ReturnValueType.FindChar(TEXT('|'), SeparatorIdx))
-		{
-			PropType = ReturnValueType.Left(SeparatorIdx);
-			FString Remainder = ReturnValueType.Mid(SeparatorIdx + 1);
-			
-			// Special handling for ArrayProperty which has format: ArrayProperty|InnerType|...
-			if (PropType == TEXT("ArrayProperty"))
-			{
-				// Extract InnerType (second field)
-				int32 SecondSepIdx;
-				if (Remainder.FindChar(TEXT('|'), SecondSepIdx))
-				{
-					InnerType = Remainder.Left(SecondSepIdx);
-					Remainder = Remainder.Mid(SecondSepIdx + 1);
-					
-					// Check for ClassName and ClassPath
-					int32 ThirdSepIdx;
-					if (Remainder.FindChar(TEXT('|'), ThirdSepIdx))
-					{
-						ClassName = Remainder.Left(ThirdSepIdx);
-						ClassPath = Remainder.Mid(ThirdSepIdx + 1);
-					}
-					else
-					{
-						ClassName = Remainder;
-					}
-				}
-				else
-				{
-					InnerType = Remainder;
-				}
-			}
-			else
-			{
-				// Normal property: check if there's a second separator for ClassPath
-				int32 SecondSeparatorIdx;
-				if (Remainder.FindChar(TEXT('|'), SecondSeparatorIdx))
-				{
-					ClassName = Remainder.Left(SecondSeparatorIdx);
-					ClassPath = Remainder.Mid(SecondSeparatorIdx + 1);
-				}
-				else
-				{
-					ClassName = Remainder;
-				}
-			}
-		}
-		
-		FEdGraphPinType ReturnPinType;
-		
-		if (PropType.IsEmpty())
-		{
-			// No type specified, use wildcard
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
-		}
-		else if (PropType == TEXT("BoolProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-		}
-		else if (PropType == TEXT("IntProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Int;
-		}
-		else if (PropType == TEXT("FloatProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-			ReturnPinType.PinSubCategory = UEdGraphSchema_K2::PC_Float;
-		}
-		else if (PropType == TEXT("DoubleProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-			ReturnPinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
-		}
-		else if (PropType == TEXT("ByteProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-		}
-		else if (PropType == TEXT("StrProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_String;
-		}
-		else if (PropType == TEXT("NameProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Name;
-		}
-		else if (PropType == TEXT("TextProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Text;
-		}
-		else if (PropType == TEXT("Int64Property"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Int64;
-		}
-		else if (PropType == TEXT("EnumProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-			
-			// Try to extract the specific enum class from ClassName
-			if (!ClassName.IsEmpty())
-			{
-				// ClassName contains the enum class like "Class'EPalAdditionalEffectType'"
-				FString EnumClassName = ClassName;
-				if (EnumClassName.StartsWith(TEXT("Class'")))
-				{
-					EnumClassName.RemoveFromStart(TEXT("Class'"));
-					EnumClassName.RemoveFromEnd(TEXT("'"));
-				}
-				
-				UE_LOG(LogTemp, Log, TEXT("  Looking for enum class: %s"), *EnumClassName);
-				
-				// Try to find the enum
-				UEnum* EnumClass = FindObject<UEnum>(nullptr, *EnumClassName);
-				if (!EnumClass)
-				{
-					// Try with full path if provided
-					if (!ClassPath.IsEmpty())
-					{
-						FString FullEnumPath = ClassPath + TEXT(".") + EnumClassName;
-						EnumClass = FindObject<UEnum>(nullptr, *FullEnumPath);
-					}
-					
-					// Try common engine paths
-					if (!EnumClass)
-					{
-						TArray<FString> CommonPaths = {
-							FString::Printf(TEXT("/Script/Pal.%s"), *EnumClassName),
-							FString::Printf(TEXT("/Script/Engine.%s"), *EnumClassName),
-							FString::Printf(TEXT("/Script/CoreUObject.%s"), *EnumClassName)
-						};
-						
-						for (const FString& Path : CommonPaths)
-						{
-							EnumClass = FindObject<UEnum>(nullptr, *Path);
-							if (EnumClass)
-							{
-								UE_LOG(LogTemp, Log, TEXT("  ✓ Found enum at path: %s"), *Path);
-								break;
-							}
-						}
-					}
-				}
-				
-				if (EnumClass)
-				{
-					ReturnPinType.PinSubCategoryObject = EnumClass;
-					UE_LOG(LogTemp, Log, TEXT("  ✓ Set enum type to: %s"), *EnumClass->GetName());
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("  ✗ Could not find enum class: %s"), *EnumClassName);
-				}
-			}
-		}
-		else if (PropType == TEXT("StructProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
-			
-			// Try to find the specific struct if StructName was provided
-			if (!ClassName.IsEmpty())
-			{
-				UScriptStruct* FoundStruct = nullptr;
-				
-				// If we have a StructPath from JSON, try it first (for UserDefinedStruct)
-				if (!ClassPath.IsEmpty())
-				{
-					FString StructPath = ClassPath;
-					
-					// Remove the ".0" suffix if present
-					if (StructPath.EndsWith(TEXT(".0")))
-					{
-						StructPath = StructPath.LeftChop(2);
-					}
-					
-					// Construct full path: "/Game/Pal/Blueprint/Spawner/Other/F_NPC_PathWalkArray.F_NPC_PathWalkArray"
-					FString FullPath = FString::Printf(TEXT("%s.%s"), *StructPath, *ClassName);
-					
-					UE_LOG(LogTemp, Log, TEXT("  Attempting to load UserDefinedStruct: %s"), *FullPath);
-					
-					FoundStruct = FindObject<UScriptStruct>(nullptr, *FullPath);
-					if (!FoundStruct)
-					{
-						FoundStruct = LoadObject<UScriptStruct>(nullptr, *FullPath);
-					}
-					
-					if (FoundStruct)
-					{
-						UE_LOG(LogTemp, Log, TEXT("  ✓ Found UserDefinedStruct %s at: %s"), *ClassName, *FullPath);
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("  ✗ Could not load struct from path: %s"), *FullPath);
-					}
-				}
-				
-				// If no path or path failed, check if it's a UserDefinedStruct and try common content paths
-				if (!FoundStruct && (ClassName.StartsWith(TEXT("F_")) || ClassName.Contains(TEXT("UserDefined"))))
-				{
-					TArray<FString> ContentPathsToTry = {
-						FString::Printf(TEXT("/Game/Pal/DataTable/Struct/%s.%s"), *ClassName, *ClassName),
-						FString::Printf(TEXT("/Game/Pal/Blueprint/Struct/%s.%s"), *ClassName, *ClassName),
-						FString::Printf(TEXT("/Game/Pal/Struct/%s.%s"), *ClassName, *ClassName),
-						FString::Printf(TEXT("/Game/Struct/%s.%s"), *ClassName, *ClassName)
-					};
-					
-					for (const FString& ContentPath : ContentPathsToTry)
-					{
-						FoundStruct = FindObject<UScriptStruct>(nullptr, *ContentPath);
-						if (!FoundStruct)
-						{
-							FoundStruct = LoadObject<UScriptStruct>(nullptr, *ContentPath);
-						}
-						if (FoundStruct)
-						{
-							UE_LOG(LogTemp, Log, TEXT("  Found UserDefinedStruct %s at: %s"), *ClassName, *ContentPath);
-							break;
-						}
-					}
-				}
-				
-				// If not found as user-defined, try native struct paths
-				if (!FoundStruct)
-				{
-					TArray<FString> PathsToTry = {
-						FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName),
-						FString::Printf(TEXT("/Script/Engine.%s"), *ClassName),
-						FString::Printf(TEXT("/Script/Pal.%s"), *ClassName)
-					};
-					
-					for (const FString& StructPath : PathsToTry)
-					{
-						FoundStruct = LoadObject<UScriptStruct>(nullptr, *StructPath);
-						if (FoundStruct)
-						{
-							UE_LOG(LogTemp, Log, TEXT("  Found struct %s at path: %s"), *ClassName, *StructPath);
-							break;
-						}
-					}
-				}
-				
-				if (FoundStruct)
-				{
-					ReturnPinType.PinSubCategoryObject = FoundStruct;
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("  Could not find struct '%s', using generic struct type"), *ClassName);
-				}
-			}
-		}
-		else if (PropType == TEXT("SoftObjectProperty") || PropType == TEXT("SoftClassProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_SoftObject;
-		}
-		else if (PropType == TEXT("WeakObjectProperty"))
-		{
-			// Weak object references use PC_Object in UE5
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Object;
-			ReturnPinType.bIsWeakPointer = true;
-		}
-		else if (PropType == TEXT("InterfaceProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Interface;
-		}
-		else if (PropType == TEXT("DelegateProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Delegate;
-		}
-		else if (PropType == TEXT("MulticastDelegateProperty") || PropType == TEXT("MulticastInlineDelegateProperty"))
-		{
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_MCDelegate;
-		}
-		else if (PropType == TEXT("ClassProperty") || PropType == TEXT("ObjectProperty"))
-		{
-			// Object/Class reference
-			if (PropType == TEXT("ClassProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Class;
-			}
-			else
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Object;
-			}
-			
-			// Try to find the specific class if ClassName was provided
-			if (!ClassName.IsEmpty())
-			{
-				UClass* FoundClass = nullptr;
-				
-				// If we have a ClassPath from JSON, try it first
-				if (!ClassPath.IsEmpty())
-				{
-					// ClassPath is like "/Game/Pal/Blueprint/Character/Base/BP_ShooterAnime_BowBase.0"
-					// For Blueprint classes, construct the full path: "/Game/Path/ClassName.ClassName_C"
-					FString BlueprintPath = ClassPath;
-					
-					// Remove the ".0" suffix if present
-					if (BlueprintPath.EndsWith(TEXT(".0")))
-					{
-						BlueprintPath = BlueprintPath.LeftChop(2);
-					}
-					
-					// Append the _C class name
-					FString FullPath = FString::Printf(TEXT("%s.%s"), *BlueprintPath, *ClassName);
-					UE_LOG(LogTemp, Warning, TEXT("  Attempting to load Blueprint class: %s"), *FullPath);
-					UE_LOG(LogTemp, Warning, TEXT("    ClassName: %s, ClassPath: %s"), *ClassName, *ClassPath);
-					
-					FoundClass = LoadObject<UClass>(nullptr, *FullPath);
-					
-					if (FoundClass)
-					{
-						UE_LOG(LogTemp, Log, TEXT("  ✓ Found Blueprint class %s at path: %s"), *ClassName, *FullPath);
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("  ✗ Failed to load Blueprint class from path: %s"), *FullPath);
-					}
-				}
-				
-				// If not found via ClassPath, try common native class paths
-				if (!FoundClass)
-				{
-					TArray<FString> PathsToTry = {
-						FString::Printf(TEXT("/Script/Pal.%s"), *ClassName),
-						FString::Printf(TEXT("/Script/Engine.%s"), *ClassName),
-						FString::Printf(TEXT("/Script/Niagara.%s"), *ClassName),
-						FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName)
-					};
-					
-					for (const FString& NativeClassPath : PathsToTry)
-					{
-						FoundClass = LoadObject<UClass>(nullptr, *NativeClassPath);
-						if (FoundClass)
-						{
-							UE_LOG(LogTemp, Log, TEXT("  Found native class %s at path: %s"), *ClassName, *NativeClassPath);
-							break;
-						}
-					}
-				}
-				
-				if (FoundClass)
-				{
-					ReturnPinType.PinSubCategoryObject = FoundClass;
-				}
-				else
-				{
-					// Class not found yet (might not be generated)
-					// Try to use FindObject which doesn't trigger loading
-					if (!ClassPath.IsEmpty())
-					{
-						FString BlueprintPath = ClassPath;
-						if (BlueprintPath.EndsWith(TEXT(".0")))
-						{
-							BlueprintPath = BlueprintPath.LeftChop(2);
-						}
-						FString FullPath = FString::Printf(TEXT("%s.%s"), *BlueprintPath, *ClassName);
-						
-						// Use FindObject instead of LoadObject - won't load but will find if already in memory
-						FoundClass = FindObject<UClass>(nullptr, *FullPath);
-						
-						if (FoundClass)
-						{
-							UE_LOG(LogTemp, Log, TEXT("  Found already-loaded class: %s"), *ClassName);
-							ReturnPinType.PinSubCategoryObject = FoundClass;
-						}
-						else
-						{
-							UE_LOG(LogTemp, Warning, TEXT("  ⚠️ Class '%s' not found (may not be generated yet)"), *ClassName);
-							UE_LOG(LogTemp, Warning, TEXT("  📝 TODO: Regenerate this Blueprint after '%s' is created for proper typing"), *ClassName);
-							UE_LOG(LogTemp, Warning, TEXT("  📍 Missing dependency: %s"), *FullPath);
-							
-							// Use generic UObject as fallback with a note
-							if (ReturnPinType.PinCategory == UEdGraphSchema_K2::PC_Object)
-							{
-								ReturnPinType.PinSubCategoryObject = UObject::StaticClass();
-							}
-							else if (ReturnPinType.PinCategory == UEdGraphSchema_K2::PC_Class)
-							{
-								ReturnPinType.PinSubCategoryObject = UClass::StaticClass();
-							}
-						}
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("  Could not find class '%s', using generic object/class type"), *ClassName);
-						// Use a generic UObject class as fallback so the pin is valid
-						if (ReturnPinType.PinCategory == UEdGraphSchema_K2::PC_Object)
-						{
-							ReturnPinType.PinSubCategoryObject = UObject::StaticClass();
-						}
-						else if (ReturnPinType.PinCategory == UEdGraphSchema_K2::PC_Class)
-						{
-							ReturnPinType.PinSubCategoryObject = UClass::StaticClass();
-						}
-					}
-				}
-			}
-		}
-		else if (PropType == TEXT("ArrayProperty"))
-		{
-			// Array type - set as array container
-			ReturnPinType.ContainerType = EPinContainerType::Array;
-			
-			// Set the inner type based on InnerType
-			if (InnerType == TEXT("ObjectProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Object;
-				
-				// Try to find the specific class if ClassName is provided
-				if (!ClassName.IsEmpty())
-				{
-					UClass* FoundClass = nullptr;
-					
-					// Try ClassPath first for Blueprint classes
-					if (!ClassPath.IsEmpty())
-					{
-						FString BlueprintPath = ClassPath;
-						if (BlueprintPath.EndsWith(TEXT(".0")))
-						{
-							BlueprintPath = BlueprintPath.LeftChop(2);
-						}
-						FString FullPath = FString::Printf(TEXT("%s.%s"), *BlueprintPath, *ClassName);
-						FoundClass = LoadObject<UClass>(nullptr, *FullPath);
-						if (FoundClass)
-						{
-							UE_LOG(LogTemp, Log, TEXT("  Found Blueprint class %s for array inner type"), *ClassName);
-						}
-					}
-					
-					// Fall back to native class paths
-					if (!FoundClass)
-					{
-						TArray<FString> PathsToTry = {
-							FString::Printf(TEXT("/Script/Pal.%s"), *ClassName),
-							FString::Printf(TEXT("/Script/Engine.%s"), *ClassName),
-							FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName)
-						};
-						
-						for (const FString& NativeClassPath : PathsToTry)
-						{
-							FoundClass = LoadObject<UClass>(nullptr, *NativeClassPath);
-							if (FoundClass)
-							{
-								UE_LOG(LogTemp, Log, TEXT("  Found native class %s for array inner type"), *ClassName);
-								break;
-							}
-						}
-					}
-					
-					if (FoundClass)
-					{
-						ReturnPinType.PinSubCategoryObject = FoundClass;
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("  Could not find class '%s' for array inner type, using generic UObject"), *ClassName);
-						// Use generic UObject as fallback so the pin is valid
-						ReturnPinType.PinSubCategoryObject = UObject::StaticClass();
-					}
-				}
-				else
-				{
-					// No class name specified, use generic UObject
-					ReturnPinType.PinSubCategoryObject = UObject::StaticClass();
-				}
-			}
-			else if (InnerType == TEXT("StructProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
-				
-				// Try to find the specific struct
-				if (!ClassName.IsEmpty())
-				{
-					UScriptStruct* FoundStruct = nullptr;
-					
-					// Check if it's a UserDefinedStruct (Blueprint struct in /Game/)
-					if (ClassName.StartsWith(TEXT("F_")) || ClassName.Contains(TEXT("UserDefined")))
-					{
-						TArray<FString> ContentPathsToTry = {
-							FString::Printf(TEXT("/Game/Pal/DataTable/Struct/%s.%s"), *ClassName, *ClassName),
-							FString::Printf(TEXT("/Game/Pal/Blueprint/Struct/%s.%s"), *ClassName, *ClassName),
-							FString::Printf(TEXT("/Game/Pal/Struct/%s.%s"), *ClassName, *ClassName),
-							FString::Printf(TEXT("/Game/Struct/%s.%s"), *ClassName, *ClassName)
-						};
-						
-						for (const FString& ContentPath : ContentPathsToTry)
-						{
-							FoundStruct = FindObject<UScriptStruct>(nullptr, *ContentPath);
-							if (!FoundStruct)
-							{
-								FoundStruct = LoadObject<UScriptStruct>(nullptr, *ContentPath);
-							}
-							if (FoundStruct)
-							{
-								UE_LOG(LogTemp, Log, TEXT("  Found UserDefinedStruct %s for array inner type"), *ClassName);
-								break;
-							}
-						}
-					}
-					
-					// If not found as user-defined, try native struct paths
-					if (!FoundStruct)
-					{
-						TArray<FString> PathsToTry = {
-							FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName),
-							FString::Printf(TEXT("/Script/Engine.%s"), *ClassName),
-							FString::Printf(TEXT("/Script/Pal.%s"), *ClassName)
-						};
-						
-						for (const FString& StructPath : PathsToTry)
-						{
-							FoundStruct = LoadObject<UScriptStruct>(nullptr, *StructPath);
-							if (FoundStruct)
-							{
-								UE_LOG(LogTemp, Log, TEXT("  Found struct %s for array inner type"), *ClassName);
-								break;
-							}
-						}
-					}
-					
-					if (FoundStruct)
-					{
-						ReturnPinType.PinSubCategoryObject = FoundStruct;
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("  Could not find struct '%s' for array inner type"), *ClassName);
-					}
-				}
-			}
-			else if (InnerType == TEXT("IntProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Int;
-			}
-			else if (InnerType == TEXT("Int64Property"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Int64;
-			}
-			else if (InnerType == TEXT("ByteProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-			}
-			else if (InnerType == TEXT("BoolProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-			}
-			else if (InnerType == TEXT("FloatProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-				ReturnPinType.PinSubCategory = UEdGraphSchema_K2::PC_Float;
-			}
-			else if (InnerType == TEXT("DoubleProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-				ReturnPinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
-			}
-			else if (InnerType == TEXT("StrProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_String;
-			}
-			else if (InnerType == TEXT("NameProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Name;
-			}
-			else if (InnerType == TEXT("TextProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Text;
-			}
-			else if (InnerType == TEXT("EnumProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-				// TODO: Could extract enum type from JSON if needed
-			}
-			else if (InnerType == TEXT("ClassProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Class;
-				
-				// Try to find the specific class if ClassName is provided (similar to ObjectProperty handling)
-				if (!ClassName.IsEmpty())
-				{
-					UClass* FoundClass = nullptr;
-					
-					// Try ClassPath first for Blueprint classes
-					if (!ClassPath.IsEmpty())
-					{
-						FString BlueprintPath = ClassPath;
-						if (BlueprintPath.EndsWith(TEXT(".0")))
-						{
-							BlueprintPath = BlueprintPath.LeftChop(2);
-						}
-						FString FullPath = FString::Printf(TEXT("%s.%s"), *BlueprintPath, *ClassName);
-						FoundClass = LoadObject<UClass>(nullptr, *FullPath);
-						if (!FoundClass)
-						{
-							FoundClass = FindObject<UClass>(nullptr, *FullPath);
-						}
-					}
-					
-					// Fall back to native class paths
-					if (!FoundClass)
-					{
-						TArray<FString> PathsToTry = {
-							FString::Printf(TEXT("/Script/Pal.%s"), *ClassName),
-							FString::Printf(TEXT("/Script/Engine.%s"), *ClassName),
-							FString::Printf(TEXT("/Script/CoreUObject.%s"), *ClassName)
-						};
-						
-						for (const FString& NativeClassPath : PathsToTry)
-						{
-							FoundClass = LoadObject<UClass>(nullptr, *NativeClassPath);
-							if (FoundClass)
-							{
-								break;
-							}
-						}
-					}
-					
-					if (FoundClass)
-					{
-						ReturnPinType.PinSubCategoryObject = FoundClass;
-					}
-					else
-					{
-						UE_LOG(LogTemp, Warning, TEXT("  Could not find class '%s' for array inner ClassProperty, using generic UClass"), *ClassName);
-						ReturnPinType.PinSubCategoryObject = UClass::StaticClass();
-					}
-				}
-				else
-				{
-					// No class name specified, use generic UClass
-					ReturnPinType.PinSubCategoryObject = UClass::StaticClass();
-				}
-			}
-			else if (InnerType == TEXT("SoftObjectProperty") || InnerType == TEXT("SoftClassProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_SoftObject;
-				// TODO: Could extract specific soft object class if needed
-			}
-			else if (InnerType == TEXT("WeakObjectProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Object;
-				ReturnPinType.bIsWeakPointer = true;
-			}
-			else if (InnerType == TEXT("InterfaceProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Interface;
-				// TODO: Could extract specific interface type if needed
-			}
-			else if (InnerType == TEXT("DelegateProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Delegate;
-			}
-			else if (InnerType == TEXT("MulticastDelegateProperty") || InnerType == TEXT("MulticastInlineDelegateProperty"))
-			{
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_MCDelegate;
-			}
-			else
-			{
-				// Unknown inner type
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
-				UE_LOG(LogTemp, Warning, TEXT("Unknown array inner type '%s' for function '%s'"), *InnerType, *FuncNameStr);
-			}
-		}
-		else if (PropType == TEXT("MapProperty"))
-		{
-			// Map type - set as map container
-			ReturnPinType.ContainerType = EPinContainerType::Map;
-			
-			// Parse "MapProperty|KeyType|ValueType|KeyClassName|ValueClassName"
-			TArray<FString> MapParts;
-			ReturnValueType.ParseIntoArray(MapParts, TEXT("|"));
-			
-			if (MapParts.Num() >= 3)
-			{
-				FString KeyType = MapParts[1];
-				FString ValueType = MapParts[2];
-				FString KeyClassName = (MapParts.Num() > 3) ? MapParts[3] : TEXT("");
-				FString ValueClassName = (MapParts.Num() > 4) ? MapParts[4] : TEXT("");
-				
-				UE_LOG(LogTemp, Log, TEXT("  Processing Map return type: Key=%s, Value=%s"), *KeyType, *ValueType);
-				
-				// Set VALUE type (PinCategory)
-				if (ValueType == TEXT("BoolProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-				}
-				else if (ValueType == TEXT("IntProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Int;
-				}
-				else if (ValueType == TEXT("Int64Property"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Int64;
-				}
-				else if (ValueType == TEXT("ByteProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-				}
-				else if (ValueType == TEXT("FloatProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-					ReturnPinType.PinSubCategory = UEdGraphSchema_K2::PC_Float;
-				}
-				else if (ValueType == TEXT("DoubleProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-					ReturnPinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
-				}
-				else if (ValueType == TEXT("StrProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_String;
-				}
-				else if (ValueType == TEXT("NameProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Name;
-				}
-				else if (ValueType == TEXT("TextProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Text;
-				}
-				else if (ValueType == TEXT("EnumProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-				}
-				else if (ValueType == TEXT("ObjectProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Object;
-					// Try to resolve value class
-					if (!ValueClassName.IsEmpty())
-					{
-						UClass* FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Pal.%s"), *ValueClassName));
-						if (!FoundClass)
-						{
-							FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *ValueClassName));
-						}
-						if (FoundClass)
-						{
-							ReturnPinType.PinSubCategoryObject = FoundClass;
-						}
-						else
-						{
-							ReturnPinType.PinSubCategoryObject = UObject::StaticClass();
-						}
-					}
-					else
-					{
-						ReturnPinType.PinSubCategoryObject = UObject::StaticClass();
-					}
-				}
-				else if (ValueType == TEXT("ClassProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Class;
-					if (!ValueClassName.IsEmpty())
-					{
-						UClass* FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Pal.%s"), *ValueClassName));
-						if (!FoundClass)
-						{
-							FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *ValueClassName));
-						}
-						if (FoundClass)
-						{
-							ReturnPinType.PinSubCategoryObject = FoundClass;
-						}
-						else
-						{
-							ReturnPinType.PinSubCategoryObject = UClass::StaticClass();
-						}
-					}
-					else
-					{
-						ReturnPinType.PinSubCategoryObject = UClass::StaticClass();
-					}
-				}
-				else if (ValueType == TEXT("StructProperty"))
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Struct;
-					if (!ValueClassName.IsEmpty())
-					{
-						UScriptStruct* FoundStruct = nullptr;
-						
-						// Check if it's a UserDefinedStruct
-						if (ValueClassName.StartsWith(TEXT("F_")) || ValueClassName.Contains(TEXT("UserDefined")))
-						{
-							TArray<FString> ContentPathsToTry = {
-								FString::Printf(TEXT("/Game/Pal/DataTable/Struct/%s.%s"), *ValueClassName, *ValueClassName),
-								FString::Printf(TEXT("/Game/Pal/Blueprint/Struct/%s.%s"), *ValueClassName, *ValueClassName),
-								FString::Printf(TEXT("/Game/Pal/Struct/%s.%s"), *ValueClassName, *ValueClassName),
-								FString::Printf(TEXT("/Game/Struct/%s.%s"), *ValueClassName, *ValueClassName)
-							};
-							
-							for (const FString& ContentPath : ContentPathsToTry)
-							{
-								FoundStruct = FindObject<UScriptStruct>(nullptr, *ContentPath);
-								if (!FoundStruct)
-								{
-									FoundStruct = LoadObject<UScriptStruct>(nullptr, *ContentPath);
-								}
-								if (FoundStruct) break;
-							}
-						}
-						
-						// Try native struct paths
-						if (!FoundStruct)
-						{
-							FoundStruct = FindObject<UScriptStruct>(nullptr, *FString::Printf(TEXT("/Script/CoreUObject.%s"), *ValueClassName));
-							if (!FoundStruct)
-							{
-								FoundStruct = FindObject<UScriptStruct>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *ValueClassName));
-							}
-							if (!FoundStruct)
-							{
-								FoundStruct = FindObject<UScriptStruct>(nullptr, *FString::Printf(TEXT("/Script/Pal.%s"), *ValueClassName));
-							}
-						}
-						
-						if (FoundStruct)
-						{
-							ReturnPinType.PinSubCategoryObject = FoundStruct;
-						}
-					}
-				}
-				else
-				{
-					ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
-					UE_LOG(LogTemp, Warning, TEXT("Unknown map value type '%s'"), *ValueType);
-				}
-				
-				// Set KEY type (PinValueType)
-				if (KeyType == TEXT("BoolProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Boolean;
-				}
-				else if (KeyType == TEXT("IntProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Int;
-				}
-				else if (KeyType == TEXT("Int64Property"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Int64;
-				}
-				else if (KeyType == TEXT("ByteProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Byte;
-				}
-				else if (KeyType == TEXT("FloatProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Real;
-					ReturnPinType.PinValueType.TerminalSubCategory = UEdGraphSchema_K2::PC_Float;
-				}
-				else if (KeyType == TEXT("DoubleProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Real;
-					ReturnPinType.PinValueType.TerminalSubCategory = UEdGraphSchema_K2::PC_Double;
-				}
-				else if (KeyType == TEXT("StrProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_String;
-				}
-				else if (KeyType == TEXT("NameProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Name;
-				}
-				else if (KeyType == TEXT("TextProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Text;
-				}
-				else if (KeyType == TEXT("EnumProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Byte;
-					// Try to find the enum type if KeyClassName is provided
-					if (!KeyClassName.IsEmpty())
-					{
-						UEnum* FoundEnum = FindObject<UEnum>(nullptr, *FString::Printf(TEXT("/Script/Pal.%s"), *KeyClassName));
-						if (!FoundEnum)
-						{
-							FoundEnum = FindObject<UEnum>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *KeyClassName));
-						}
-						if (FoundEnum)
-						{
-							ReturnPinType.PinValueType.TerminalSubCategoryObject = FoundEnum;
-							UE_LOG(LogTemp, Log, TEXT("  Found enum type for map key: %s"), *KeyClassName);
-						}
-					}
-				}
-				else if (KeyType == TEXT("ObjectProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Object;
-					if (!KeyClassName.IsEmpty())
-					{
-						UClass* FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Pal.%s"), *KeyClassName));
-						if (!FoundClass)
-						{
-							FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *KeyClassName));
-						}
-						if (FoundClass)
-						{
-							ReturnPinType.PinValueType.TerminalSubCategoryObject = FoundClass;
-						}
-						else
-						{
-							ReturnPinType.PinValueType.TerminalSubCategoryObject = UObject::StaticClass();
-						}
-					}
-					else
-					{
-						ReturnPinType.PinValueType.TerminalSubCategoryObject = UObject::StaticClass();
-					}
-				}
-				else if (KeyType == TEXT("ClassProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Class;
-					if (!KeyClassName.IsEmpty())
-					{
-						UClass* FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Pal.%s"), *KeyClassName));
-						if (!FoundClass)
-						{
-							FoundClass = FindObject<UClass>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *KeyClassName));
-						}
-						if (FoundClass)
-						{
-							ReturnPinType.PinValueType.TerminalSubCategoryObject = FoundClass;
-						}
-						else
-						{
-							ReturnPinType.PinValueType.TerminalSubCategoryObject = UClass::StaticClass();
-						}
-					}
-					else
-					{
-						ReturnPinType.PinValueType.TerminalSubCategoryObject = UClass::StaticClass();
-					}
-				}
-				else if (KeyType == TEXT("StructProperty"))
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Struct;
-					if (!KeyClassName.IsEmpty())
-					{
-						UScriptStruct* FoundStruct = nullptr;
-						
-						// Check if it's a UserDefinedStruct
-						if (KeyClassName.StartsWith(TEXT("F_")) || KeyClassName.Contains(TEXT("UserDefined")))
-						{
-							TArray<FString> ContentPathsToTry = {
-								FString::Printf(TEXT("/Game/Pal/DataTable/Struct/%s.%s"), *KeyClassName, *KeyClassName),
-								FString::Printf(TEXT("/Game/Pal/Blueprint/Struct/%s.%s"), *KeyClassName, *KeyClassName),
-								FString::Printf(TEXT("/Game/Pal/Struct/%s.%s"), *KeyClassName, *KeyClassName),
-								FString::Printf(TEXT("/Game/Struct/%s.%s"), *KeyClassName, *KeyClassName)
-							};
-							
-							for (const FString& ContentPath : ContentPathsToTry)
-							{
-								FoundStruct = FindObject<UScriptStruct>(nullptr, *ContentPath);
-								if (!FoundStruct)
-								{
-									FoundStruct = LoadObject<UScriptStruct>(nullptr, *ContentPath);
-								}
-								if (FoundStruct) break;
-							}
-						}
-						
-						// Try native struct paths
-						if (!FoundStruct)
-						{
-							FoundStruct = FindObject<UScriptStruct>(nullptr, *FString::Printf(TEXT("/Script/CoreUObject.%s"), *KeyClassName));
-							if (!FoundStruct)
-							{
-								FoundStruct = FindObject<UScriptStruct>(nullptr, *FString::Printf(TEXT("/Script/Engine.%s"), *KeyClassName));
-							}
-							if (!FoundStruct)
-							{
-								FoundStruct = FindObject<UScriptStruct>(nullptr, *FString::Printf(TEXT("/Script/Pal.%s"), *KeyClassName));
-							}
-						}
-						
-						if (FoundStruct)
-						{
-							ReturnPinType.PinValueType.TerminalSubCategoryObject = FoundStruct;
-						}
-					}
-				}
-				else
-				{
-					ReturnPinType.PinValueType.TerminalCategory = UEdGraphSchema_K2::PC_Wildcard;
-					UE_LOG(LogTemp, Warning, TEXT("Unknown map key type '%s'"), *KeyType);
-				}
-				
-				UE_LOG(LogTemp, Log, TEXT("  Created Map<%s, %s> return type"), *KeyType, *ValueType);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Invalid MapProperty format: %s"), *ReturnValueType);
-				ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
-			}
-		}
-		else
-		{
-			// Unknown type, default to wildcard
-			ReturnPinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
-			UE_LOG(LogTemp, Warning, TEXT("Unknown return type '%s' for function '%s', using wildcard"), *PropType, *FuncNameStr);
-		}
+		FModelTypeResolver::FUnresolvedTypes Unresolved;
+		FEdGraphPinType ReturnPinType = FModelTypeResolver::ResolveReturnType(ReturnType, &Unresolved);
 		
 		// Add user-defined pin for return value
 		TSharedPtr<FUserPinInfo> ReturnPin = MakeShareable(new FUserPinInfo());
@@ -1149,6 +159,9 @@ bool UDummyBlueprintFunctionLibrary::AddFunctionStubToBlueprint(UBlueprint* Blue
 		ReturnPin->PinType = ReturnPinType;
 		ReturnPin->DesiredPinDirection = EGPD_Input;
 		ResultNode->UserDefinedPins.Add(ReturnPin);
+
+		// A type that does not exist yet (e.g., a Blueprint later in the import) is patched in once it does
+		FModelPinFixups::RecordIfDeferred(Blueprint, NewGraph->GetFName(), ReturnPin->PinName, ReturnType, Unresolved);
 		
 		// Force reconstruction of pins to ensure proper type matching
 		ResultNode->ReconstructNode();
@@ -1178,16 +191,45 @@ bool UDummyBlueprintFunctionLibrary::AddFunctionStubToBlueprint(UBlueprint* Blue
 }
 
 int32 UDummyBlueprintFunctionLibrary::AddMultipleFunctionStubsToBlueprint(UBlueprint* Blueprint, const TArray<FName>& FunctionNames, const TArray<FString>& ReturnTypes)
+{
+	TArray<FFModelFunctionDescriptor> Functions;
+	Functions.Reserve(FunctionNames.Num());
+	for (int32 i = 0; i < FunctionNames.Num(); i++)
+	{
+		FFModelFunctionDescriptor& Function = Functions.AddDefaulted_GetRef();
+		Function.Name = FunctionNames[i];
+		// Get return type if available
+		if (i < ReturnTypes.Num())
+		{
+			Function.ReturnType = FFModelTypeRef::Parse(ReturnTypes[i]);
+		}
+	}
+
+	return AddFunctionDescriptorsToBlueprint(Blueprint, Functions);
+}
+
+int32 UDummyBlueprintFunctionLibrary::AddFunctionDescriptorsToBlueprint(UBlueprint* Blueprint, const TArray<FFModelFunctionDescriptor>& Functions)
 {
 	if (!Blueprint)
 	{
 		return 0;
 	}
 
+	// Function graphs already in this Blueprint, kept up to date as stubs are added
+	TSet<FName> ExistingGraphNames;
+	ExistingGraphNames.Reserve(Blueprint->FunctionGraphs.Num() + Functions.Num());
+	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (Graph)
+		{
+			ExistingGraphNames.Add(Graph->GetFName());
+		}
+	}
+
 	int32 SuccessCount = 0;
-	for (int32 i = 0; i < FunctionNames.Num(); i++)
+	for (const FFModelFunctionDescriptor& Function : Functions)
 	{
-		const FName& FuncName = FunctionNames[i];
+		const FName& FuncName = Function.Name;
 		
 		// Skip empty names and Ubergraph (that's the event graph)
 		if (FuncName.IsNone() || FuncName.ToString().Contains(TEXT("ExecuteUbergraph")))
@@ -1196,17 +238,11 @@ int32 UDummyBlueprintFunctionLibrary::AddMultipleFunctionStubsToBlueprint(UBluep
 		}
 
 		// Check if function already exists (either in this Blueprint or inherited from parent)
-		bool bExists = false;
-		
 		// Check if it's already in this Blueprint's function graphs
-		for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+		const bool bExists = ExistingGraphNames.Contains(FuncName);
+		if (bExists)
 		{
-			if (Graph && Graph->GetFName() == FuncName)
-			{
-				bExists = true;
-				UE_LOG(LogTemp, Warning, TEXT("Function %s already exists in this Blueprint, skipping"), *FuncName.ToString());
-				break;
-			}
+			UE_LOG(LogTemp, Warning, TEXT("Function %s already exists in this Blueprint, skipping"), *FuncName.ToString());
 		}
 		
 		// For dummy Blueprints, we want to create override functions even if they exist in parent
@@ -1235,12 +271,12 @@ int32 UDummyBlueprintFunctionLibrary::AddMultipleFunctionStubsToBlueprint(UBluep
 
 		if (!bExists)
 		{
-			// Get return type if available
-			FString ReturnType = (i < ReturnTypes.Num()) ? ReturnTypes[i] : TEXT("");
+			const FFModelTypeRef& ReturnType = Function.ReturnType;
 			bool bHasReturn = !ReturnType.IsEmpty();
 			
-			if (AddFunctionStubToBlueprint(Blueprint, FuncName, bHasReturn, ReturnType))
+			if (AddFunctionStubFromTypeRef(Blueprint, FuncName, bHasReturn, ReturnType))
 			{
+				ExistingGraphNames.Add(FuncName);
 				SuccessCount++;
 			}
 		}
@@ -1355,94 +391,39 @@ int32 UDummyBlueprintFunctionLibrary::AddVariablesToBlueprint(UBlueprint* Bluepr
 		return 0;
 	}
 
+	TArray<FFModelVariableDescriptor> Variables;
+	Variables.Reserve(VariableNames.Num());
+	for (int32 i = 0; i < VariableNames.Num(); i++)
+	{
+		FFModelVariableDescriptor& Variable = Variables.AddDefaulted_GetRef();
+		Variable.Name = VariableNames[i];
+		Variable.Type = VariableTypes[i];
+	}
+
+	return AddVariableDescriptorsToBlueprint(Blueprint, Variables);
+}
+
+int32 UDummyBlueprintFunctionLibrary::AddVariableDescriptorsToBlueprint(UBlueprint* Blueprint, const TArray<FFModelVariableDescriptor>& Variables)
+{
+	if (!Blueprint)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AddVariableDescriptorsToBlueprint: Invalid input - Blueprint: NULL"));
+		return 0;
+	}
+
 	int32 SuccessCount = 0;
 
-	for (int32 i = 0; i < VariableNames.Num(); i++)
+	for (int32 i = 0; i < Variables.Num(); i++)
 	{
-		FName VarName = VariableNames[i];
-		FString VarType = VariableTypes[i];
+		const FName VarName = Variables[i].Name;
+		const FString& VarType = Variables[i].Type;
 
 		UE_LOG(LogTemp, Log, TEXT("Processing variable %d: %s (%s)"), i, *VarName.ToString(), *VarType);
 
 		// Get the property type
 		FEdGraphPinType PinType;
-		
-		if (VarType == TEXT("bool"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Boolean;
-		}
-		else if (VarType == TEXT("int32"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Int;
-		}
-		else if (VarType == TEXT("float"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-			PinType.PinSubCategory = UEdGraphSchema_K2::PC_Float;
-		}
-		else if (VarType == TEXT("double"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Real;
-			PinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
-		}
-		else if (VarType == TEXT("uint8"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Byte;
-		}
-		else if (VarType == TEXT("FString"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_String;
-		}
-		else if (VarType == TEXT("FName"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Name;
-		}
-		else if (VarType == TEXT("FText"))
-		{
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Text;
-		}
-		else if (VarType.StartsWith(TEXT("ObjectProperty|")))
-		{
-			// Handle ObjectProperty|ComponentClass|/Script/Engine format for component references
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Object;
-			
-			// Parse the format: ObjectProperty|ComponentClass|/Script/Engine
-			TArray<FString> Parts;
-			VarType.ParseIntoArray(Parts, TEXT("|"));
-			
-			if (Parts.Num() >= 2)
-			{
-				FString ComponentClass = Parts[1];
-				FString ClassPath = FString::Printf(TEXT("/Script/Engine.%s"), *ComponentClass);
-				
-				UE_LOG(LogTemp, Log, TEXT("  Component reference variable - trying to load class: %s"), *ClassPath);
-				
-				UClass* FoundClass = LoadObject<UClass>(nullptr, *ClassPath);
-				if (FoundClass)
-				{
-					PinType.PinSubCategoryObject = FoundClass;
-					UE_LOG(LogTemp, Log, TEXT("  ✅ Found component class: %s"), *ComponentClass);
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("  ⚠️ Could not load component class: %s, using generic UObject"), *ComponentClass);
-					PinType.PinSubCategoryObject = UObject::StaticClass();
-				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("  ⚠️ Invalid ObjectProperty format: %s"), *VarType);
-				PinType.PinSubCategoryObject = UObject::StaticClass();
-			}
-		}
-		else if (VarType.StartsWith(TEXT("TArray<")))
-		{
-			// Handle TArray types
-			PinType.ContainerType = EPinContainerType::Array;
-			PinType.PinCategory = UEdGraphSchema_K2::PC_Object;
-			PinType.PinSubCategoryObject = UObject::StaticClass();  // Simplified for now
-		}
-		else
+		FModelTypeResolver::FUnresolvedTypes Unresolved;
+		if (!FModelTypeResolver::ResolveVariableType(VarType, PinType, &Unresolved))
 		{
 			UE_LOG(LogTemp, Warning, TEXT("Unknown variable type: %s for variable %s"), *VarType, *VarName.ToString());
 			continue;
@@ -1454,6 +435,7 @@ int32 UDummyBlueprintFunctionLibrary::AddVariablesToBlueprint(UBlueprint* Bluepr
 		if (FBlueprintEditorUtils::AddMemberVariable(Blueprint, VarName, PinType))
 		{
 			SuccessCount++;
+			FModelPinFixups::RecordIfDeferred(Blueprint, VarName, VarType, Unresolved);
 			UE_LOG(LogTemp, Log, TEXT("✅ Added variable: %s (%s)"), *VarName.ToString(), *VarType);
 		}
 		else
@@ -1470,914 +452,493 @@ int32 UDummyBlueprintFunctionLibrary::AddVariablesToBlueprint(UBlueprint* Bluepr
 	return SuccessCount;
 }
 
+/** How exports are parsed, read from the console variables once per call so every file of an import parses alike */
+struct FDescriptorParseSettings
+{
+	bool bStreaming = true;
+	bool bMappedInput = true;
+	bool bUseCache = true;
+	FFModelParseOptions ParseOptions;
+	FModelDescriptorCache::EParseSettings CacheSettings = FModelDescriptorCache::EParseSettings::None;
+	int64 MaxCacheBytes = 0;
+};
+
+static FDescriptorParseSettings GetDescriptorParseSettings()
+{
+	FDescriptorParseSettings Settings;
+	Settings.bStreaming = CVarFModelStreamingParse.GetValueOnAnyThread();
+	Settings.ParseOptions.bSkipIrrelevantEntries = CVarFModelSkipIrrelevantEntries.GetValueOnAnyThread();
+	Settings.bMappedInput = Settings.bStreaming && CVarFModelMappedInput.GetValueOnAnyThread();
+	Settings.bUseCache = CVarFModelDescriptorCache.GetValueOnAnyThread();
+	Settings.MaxCacheBytes = int64(FMath::Max(CVarFModelDescriptorCacheMaxMB.GetValueOnAnyThread(), 1)) * 1024 * 1024;
+
+	// Only the streaming front-end skips entries, so the option does not split DOM entries
+	if (Settings.bStreaming)
+	{
+		Settings.CacheSettings |= FModelDescriptorCache::EParseSettings::Streaming;
+		if (Settings.ParseOptions.bSkipIrrelevantEntries)
+		{
+			Settings.CacheSettings |= FModelDescriptorCache::EParseSettings::SkipIrrelevantEntries;
+		}
+	}
+	return Settings;
+}
+
+static FXxHash64 GetContentHash(const FFModelParseResult& Result)
+{
+	FXxHash64 ContentHash;
+	ContentHash.Hash = Result.ContentHash;
+	return ContentHash;
+}
+
+/**
+ * First half of parsing Item.Result.JsonFilePath: open the file and hash it, taking the descriptor from the cache
+ * if it is there (Item.bParsed). Touches no UObjects, so it is safe on worker threads.
+ * @param bNeedHash - Hash the file even without the cache, for FFModelParseResult::ContentHash
+ */
+static void ReadDescriptorFile(const FDescriptorParseSettings& Settings, bool bNeedHash, FModelImportPipeline::FItem& Item)
+{
+	FFModelParseResult& Result = Item.Result;
+	Item.bOpened = (Settings.bMappedInput || Settings.bUseCache || bNeedHash) && Item.File.Open(Result.JsonFilePath);
+	if (!Item.bOpened)
+	{
+		return;
+	}
+
+	// Hash the bytes as stored, so a re-export that only changed encoding is a miss rather than a wrong hit
+	if (Settings.bUseCache || bNeedHash)
+	{
+		const TArrayView64<const uint8> Bytes = Item.File.GetBytes();
+		Result.ContentHash = FXxHash64::HashBuffer(Bytes.GetData(), Bytes.Num()).Hash;
+	}
+
+	if (Settings.bUseCache && FModelDescriptorCache::Load(GetContentHash(Result), Settings.CacheSettings, Result.Descriptor))
+	{
+		Item.bParsed = true;
+		Result.bSuccess = true;
+	}
+}
+
+/** Second half: parse the file ReadDescriptorFile opened into Item.Result. Safe on worker threads. */
+static void ParseReadDescriptor(const FDescriptorParseSettings& Settings, FModelImportPipeline::FItem& Item)
+{
+	FFModelParseResult& Result = Item.Result;
+
+	// Parent class, Children, ChildProperties, class-level properties and Function entries
+	// are all gathered into the accumulator; the descriptor is only written if the whole file parsed
+	FFModelExportAccumulator Accumulator;
+	bool bParsed = false;
+
+	if (Settings.bMappedInput && Item.bOpened && Item.File.CanParseInPlace())
+	{
+		// Parse the file bytes directly; only the strings we keep are ever converted to TCHAR
+		bParsed = FModelExportParser::ParseStreaming(Item.File.GetUtf8Text(), Accumulator, Settings.ParseOptions);
+	}
+	else
+	{
+		// Convert the bytes already read; a file that was not opened is loaded here
+		FString JsonString;
+		const TArrayView64<const uint8> Bytes = Item.File.GetBytes();
+		if (Item.bOpened && Bytes.Num() <= MAX_int32)
+		{
+			FFileHelper::BufferToString(JsonString, Bytes.GetData(), static_cast<int32>(Bytes.Num()));
+		}
+		else if (!FFileHelper::LoadFileToString(JsonString, *Result.JsonFilePath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load JSON file: %s"), *Result.JsonFilePath);
+			Result.Error = TEXT("Failed to load JSON file");
+			return;
+		}
+
+		bParsed = Settings.bStreaming
+			? FModelExportParser::ParseStreaming(JsonString, Accumulator, Settings.ParseOptions)
+			: FModelExportParser::ParseDom(JsonString, Accumulator);
+	}
+
+	if (!bParsed)
+	{
+		Result.Error = TEXT("Failed to parse JSON");
+		return;
+	}
+
+	Accumulator.Finish(Result.Descriptor);
+
+	if (Settings.bUseCache && Item.bOpened)
+	{
+		FModelDescriptorCache::Store(GetContentHash(Result), Settings.CacheSettings, Result.Descriptor, Settings.MaxCacheBytes);
+	}
+
+	// Even if no functions/components/variables found, still succeed for valid Blueprint JSON
+	// Simple Blueprints that just inherit from parents are valid and should be created
+	Result.bSuccess = true;
+}
+
+/**
+ * Parse one export file into a descriptor. Touches no UObjects, so it is safe on worker threads.
+ * @param OutError - Why parsing failed, if it did
+ */
+static bool ParseDescriptorFile(const FString& JsonFilePath, FFModelClassDescriptor& OutDescriptor, FString& OutError)
+{
+	const FDescriptorParseSettings Settings = GetDescriptorParseSettings();
+
+	FModelImportPipeline::FItem Item;
+	Item.Result.JsonFilePath = JsonFilePath;
+	ReadDescriptorFile(Settings, false, Item);
+	if (!Item.bParsed)
+	{
+		ParseReadDescriptor(Settings, Item);
+	}
+
+	if (!Item.Result.bSuccess)
+	{
+		OutError = MoveTemp(Item.Result.Error);
+		return false;
+	}
+	OutDescriptor = MoveTemp(Item.Result.Descriptor);
+	return true;
+}
+
+bool UDummyBlueprintFunctionLibrary::ParseFModelClassDescriptor(const FString& JsonFilePath, FFModelClassDescriptor& OutDescriptor)
+{
+	FString Error;
+	return ParseDescriptorFile(JsonFilePath, OutDescriptor, Error);
+}
+
+TArray<FFModelParseResult> UDummyBlueprintFunctionLibrary::ParseFModelJSONBatch(const TArray<FString>& JsonFilePaths)
+{
+	TArray<FFModelParseResult> Results;
+	Results.SetNum(JsonFilePaths.Num());
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Export sizes vary by orders of magnitude, so let idle workers pick up the remaining files
+	ParallelFor(JsonFilePaths.Num(), [&JsonFilePaths, &Results](int32 Index)
+	{
+		FFModelParseResult& Result = Results[Index];
+		Result.JsonFilePath = JsonFilePaths[Index];
+		Result.bSuccess = ParseDescriptorFile(Result.JsonFilePath, Result.Descriptor, Result.Error);
+	}, EParallelForFlags::Unbalanced);
+
+	int32 FailedCount = 0;
+	for (const FFModelParseResult& Result : Results)
+	{
+		FailedCount += Result.bSuccess ? 0 : 1;
+	}
+	UE_LOG(LogTemp, Log, TEXT("Parsed %d JSON files in %.2fs (%d failed)"), Results.Num(), FPlatformTime::Seconds() - StartTime, FailedCount);
+
+	return Results;
+}
+
 bool UDummyBlueprintFunctionLibrary::ParseFModelJSON(const FString& JsonFilePath, TArray<FName>& OutFunctionNames, TArray<FName>& OutComponentNames, TArray<FString>& OutComponentClasses, TArray<FName>& OutVariableNames, TArray<FString>& OutVariableTypes, TArray<FString>& OutFunctionReturnTypes, FString& OutParentClassPath)
 {
-	// Load JSON file
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *JsonFilePath))
+	FFModelClassDescriptor Descriptor;
+	if (!ParseFModelClassDescriptor(JsonFilePath, Descriptor))
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to load JSON file: %s"), *JsonFilePath);
 		return false;
 	}
 
-	// Parse JSON
-	TSharedPtr<FJsonValue> JsonValue;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	
-	if (!FJsonSerializer::Deserialize(Reader, JsonValue) || !JsonValue.IsValid())
+	if (!Descriptor.ParentClassPath.IsEmpty())
+	{
+		OutParentClassPath = MoveTemp(Descriptor.ParentClassPath);
+	}
+
+	// OutFunctionReturnTypes stays parallel to OutFunctionNames
+	for (FFModelFunctionDescriptor& Function : Descriptor.Functions)
+	{
+		OutFunctionNames.Add(Function.Name);
+		OutFunctionReturnTypes.Add(Function.ReturnType.ToString());
+	}
+
+	for (FFModelVariableDescriptor& Variable : Descriptor.Variables)
+	{
+		OutVariableNames.Add(Variable.Name);
+		OutVariableTypes.Add(MoveTemp(Variable.Type));
+	}
+
+	for (FFModelComponentDescriptor& Component : Descriptor.Components)
+	{
+		OutComponentNames.Add(Component.Name);
+		OutComponentClasses.Add(MoveTemp(Component.ComponentClass));
+	}
+
+	return true;
+}
+
+FString UDummyBlueprintFunctionLibrary::FModelTypeRefToString(const FFModelTypeRef& TypeRef)
+{
+	return TypeRef.ToString();
+}
+
+FFModelTypeRef UDummyBlueprintFunctionLibrary::ParseFModelTypeRef(const FString& TypeString)
+{
+	return FFModelTypeRef::Parse(TypeString);
+}
+
+bool UDummyBlueprintFunctionLibrary::ClassifyFModelJSON(const FString& JsonFilePath, FFModelExportSummary& OutSummary)
+{
+	if (!FModelExportClassifier::ClassifyFile(JsonFilePath, OutSummary))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to read JSON file for classification: %s"), *JsonFilePath);
+		return false;
+	}
+	return true;
+}
+
+TArray<FFModelExportSummary> UDummyBlueprintFunctionLibrary::ClassifyFModelJSONFiles(const TArray<FString>& JsonFilePaths)
+{
+	TArray<FFModelExportSummary> Summaries;
+	Summaries.SetNum(JsonFilePaths.Num());
+
+	// The scan stops at the first complete Blueprint class, which keeps per-file cost even enough for a balanced split
+	ParallelFor(JsonFilePaths.Num(), [&JsonFilePaths, &Summaries](int32 Index)
+	{
+		FModelExportClassifier::ClassifyFile(JsonFilePaths[Index], Summaries[Index]);
+	});
+
+	int32 BlueprintCount = 0;
+	for (const FFModelExportSummary& Summary : Summaries)
+	{
+		BlueprintCount += Summary.bHasBlueprintClass ? 1 : 0;
+	}
+	UE_LOG(LogTemp, Log, TEXT("Classified %d JSON files (%d Blueprints)"), Summaries.Num(), BlueprintCount);
+
+	return Summaries;
+}
+
+TArray<FFModelExportSummary> UDummyBlueprintFunctionLibrary::IndexFModelExportFolder(const FString& JsonFolder)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FModelExportIndex::FRefreshStats Stats;
+	TArray<FFModelExportSummary> Summaries = FModelExportIndex::Refresh(JsonFolder, &Stats);
+
+	UE_LOG(LogTemp, Log, TEXT("Indexed %d JSON files in %.2fs (%d reclassified, %d removed, %d unreadable%s)"),
+		Stats.NumFiles, FPlatformTime::Seconds() - StartTime, Stats.NumReclassified, Stats.NumRemoved, Stats.NumUnreadable,
+		Stats.bLoadedIndex ? TEXT("") : TEXT(", new index"));
+
+	return Summaries;
+}
+
+FFModelImportPlan UDummyBlueprintFunctionLibrary::PlanFModelBlueprintImport(const TArray<FFModelExportSummary>& Summaries)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FFModelImportPlan Plan = FModelImportScheduler::BuildPlan(Summaries);
+
+	UE_LOG(LogTemp, Log, TEXT("Planned %d Blueprints in %.3fs (%d depths, %d missing parents, %d cyclic, %d duplicates)"),
+		Plan.Entries.Num(), FPlatformTime::Seconds() - StartTime, Plan.NumDepths,
+		Plan.MissingParentClassNames.Num(), Plan.CyclicJsonFilePaths.Num(), Plan.DuplicateJsonFilePaths.Num());
+
+	return Plan;
+}
+
+FFModelDryRunResult UDummyBlueprintFunctionLibrary::DryRunFModelBlueprintImport(const TArray<FFModelExportSummary>& Summaries, int32 MaxBufferedDescriptors)
+{
+	check(IsInGameThread());
+
+	FFModelDryRunResult DryRun;
+	DryRun.Plan = PlanFModelBlueprintImport(Summaries);
+	const TArray<FFModelImportPlanEntry>& Entries = DryRun.Plan.Entries;
+
+	// Blueprints the import creates itself cannot be found yet, but are not missing either
+	TSet<FString> PlannedClassNames;
+	PlannedClassNames.Reserve(Entries.Num());
+	for (const FFModelImportPlanEntry& Entry : Entries)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON"));
-		return false;
+		PlannedClassNames.Add(Entry.BlueprintClassName);
 	}
 
-	// JSON should be an array
-	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
-	if (!JsonValue->TryGetArray(JsonArray))
+	// Same for the structs ImportStructs creates before any Blueprint; the dry run does not create them
+	TSet<FString> PlannedStructNames;
+	for (const FFModelExportSummary& Summary : Summaries)
 	{
-		return false;
+		if (Summary.bIsExportArray && Summary.FirstEntryType == TEXT("UserDefinedStruct") && !Summary.FirstEntryName.IsEmpty())
+		{
+			PlannedStructNames.Add(Summary.FirstEntryName);
+		}
 	}
 
-	// Find the BlueprintGeneratedClass entry
-	for (const TSharedPtr<FJsonValue>& Entry : *JsonArray)
+	// Kind + name -> index in DryRun.UnresolvedTypes
+	TMap<FString, int32> UnresolvedIndices;
+	FModelTypeResolver::FUnresolvedTypes Unresolved;
+
+	// Count one type reference, folding whatever it could not resolve into the result
+	auto RecordReference = [&DryRun, &PlannedClassNames, &PlannedStructNames, &UnresolvedIndices, &Unresolved](const FString& JsonFilePath)
 	{
-		const TSharedPtr<FJsonObject>* EntryObj;
-		if (!Entry->TryGetObject(EntryObj))
+		if (Unresolved.Num() == 0)
 		{
-			continue;
+			++DryRun.NumTypesResolved;
+			return;
 		}
 
-		FString Type;
-		if ((*EntryObj)->TryGetStringField(TEXT("Type"), Type) && Type == TEXT("BlueprintGeneratedClass"))
+		for (FModelTypeResolver::FUnresolvedType& Type : Unresolved)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Found BlueprintGeneratedClass"));
-			
-			// Extract parent class from Super field (Blueprint parent)
-			const TSharedPtr<FJsonObject>* SuperObj;
-			if ((*EntryObj)->TryGetObjectField(TEXT("Super"), SuperObj))
-			{
-				FString SuperObjectPath;
-				if ((*SuperObj)->TryGetStringField(TEXT("ObjectPath"), SuperObjectPath))
-				{
-					UE_LOG(LogTemp, Warning, TEXT("Found Super ObjectPath: %s"), *SuperObjectPath);
-					OutParentClassPath = SuperObjectPath;
-				}
-			}
-			// If no Super field, check for SuperStruct (C++ parent class)
-			else
-			{
-				const TSharedPtr<FJsonObject>* SuperStructObj;
-				if ((*EntryObj)->TryGetObjectField(TEXT("SuperStruct"), SuperStructObj))
-				{
-					FString SuperStructName;
-					if ((*SuperStructObj)->TryGetStringField(TEXT("ObjectName"), SuperStructName))
-					{
-						// Extract class name from "Class'PalWeaponBase'" -> "PalWeaponBase"
-						if (SuperStructName.StartsWith(TEXT("Class'")))
-						{
-							SuperStructName.RemoveFromStart(TEXT("Class'"));
-							SuperStructName.RemoveFromEnd(TEXT("'"));
-							UE_LOG(LogTemp, Warning, TEXT("Found SuperStruct class name: %s"), *SuperStructName);
-							// Store with special prefix to indicate it's a C++ class
-							OutParentClassPath = TEXT("CPP:") + SuperStructName;
-						}
-					}
-				}
-			}
-			
-			// Extract function names from Children array
-			const TArray<TSharedPtr<FJsonValue>>* Children;
-			if ((*EntryObj)->TryGetArrayField(TEXT("Children"), Children))
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Found Children array with %d entries"), Children->Num());
-				
-				for (const TSharedPtr<FJsonValue>& Child : *Children)
-				{
-					const TSharedPtr<FJsonObject>* ChildObj;
-					if (Child->TryGetObject(ChildObj))
-					{
-						FString ObjectName;
-						if ((*ChildObj)->TryGetStringField(TEXT("ObjectName"), ObjectName))
-						{
-							UE_LOG(LogTemp, Warning, TEXT("Found ObjectName: %s"), *ObjectName);
-							
-							// Extract function name from "Function'BP_Item_C:GetName'"
-							if (ObjectName.StartsWith(TEXT("Function'")))
-							{
-								int32 ColonIndex;
-								if (ObjectName.FindChar(':', ColonIndex))
-								{
-									FString FuncName = ObjectName.Mid(ColonIndex + 1);
-									FuncName.RemoveFromEnd(TEXT("'"));
-									
-									// Replace spaces with underscores (FName doesn't handle spaces well)
-									FuncName = FuncName.Replace(TEXT(" "), TEXT("_"));
-									
-									// Validate the function name
-									if (!FuncName.IsEmpty() && FuncName != TEXT("None"))
-									{
-										UE_LOG(LogTemp, Warning, TEXT("Extracted function name: %s"), *FuncName);
-										
-										// Create FName and verify it's valid
-										FName FuncFName(*FuncName);
-										if (FuncFName.IsValid() && !FuncFName.IsNone())
-										{
-											// Use AddUnique to avoid duplicate function names from JSON
-											OutFunctionNames.AddUnique(FuncFName);
-										}
-										else
-										{
-											UE_LOG(LogTemp, Error, TEXT("Failed to create valid FName from: %s"), *FuncName);
-										}
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-			else
+			const bool bIsStruct = FCString::Strcmp(Type.Kind, TEXT("Struct")) == 0;
+			if (bIsStruct ? PlannedStructNames.Contains(Type.Name) : PlannedClassNames.Contains(Type.Name))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("Children array not found"));
+				++DryRun.NumTypesFromPlan;
+				continue;
 			}
 
-			// Extract component names and variable properties from ChildProperties array
-			const TArray<TSharedPtr<FJsonValue>>* ChildProperties;
-			if ((*EntryObj)->TryGetArrayField(TEXT("ChildProperties"), ChildProperties))
+			const FString Key = FString::Printf(TEXT("%s|%s"), Type.Kind, *Type.Name);
+			int32& Index = UnresolvedIndices.FindOrAdd(Key, INDEX_NONE);
+			if (Index == INDEX_NONE)
 			{
-				for (const TSharedPtr<FJsonValue>& Prop : *ChildProperties)
-				{
-					const TSharedPtr<FJsonObject>* PropObj;
-					if (Prop->TryGetObject(PropObj))
-					{
-						FString PropType;
-						(*PropObj)->TryGetStringField(TEXT("Type"), PropType);
-						
-						FString PropName;
-						(*PropObj)->TryGetStringField(TEXT("Name"), PropName);
-						
-						// Skip certain system properties
-						if (PropName == TEXT("UberGraphFrame"))
-						{
-							continue;
-						}
-						
-						if (PropType == TEXT("ObjectProperty"))
-						{
-							const TSharedPtr<FJsonObject>* PropertyClass;
-							if ((*PropObj)->TryGetObjectField(TEXT("PropertyClass"), PropertyClass))
-							{
-								FString ClassName;
-								(*PropertyClass)->TryGetStringField(TEXT("ObjectName"), ClassName);
-								
-								UE_LOG(LogTemp, Warning, TEXT("Found ObjectProperty: %s with class: %s"), *PropName, *ClassName);
-								
-								// Check if it's a component class
-								if (ClassName.Contains(TEXT("Component")))
-								{
-									if (!PropName.IsEmpty())
-									{
-										// Clean up class name: "Class'SceneComponent'" -> "SceneComponent"
-										ClassName.RemoveFromStart(TEXT("Class'"));
-										ClassName.RemoveFromEnd(TEXT("'"));
-										
-										UE_LOG(LogTemp, Warning, TEXT("*** ADDING COMPONENT REFERENCE VARIABLE: %s (%s)"), *PropName, *ClassName);
-										
-										// Add as a variable reference instead of actual component
-										FString VarType = FString::Printf(TEXT("ObjectProperty|%s|/Script/Engine"), *ClassName);
-										OutVariableNames.Add(FName(*PropName));
-										OutVariableTypes.Add(VarType);
-									}
-								}
-							}
-						}
-						// Handle Blueprint variables (non-component properties)
-						else if (PropType == TEXT("BoolProperty") || 
-						         PropType == TEXT("IntProperty") || 
-						         PropType == TEXT("FloatProperty") || 
-						         PropType == TEXT("DoubleProperty") ||
-						         PropType == TEXT("ByteProperty") ||
-						         PropType == TEXT("StrProperty") ||
-						         PropType == TEXT("NameProperty") ||
-						         PropType == TEXT("TextProperty") ||
-						         PropType == TEXT("ArrayProperty"))
-						{
-							if (!PropName.IsEmpty())
-							{
-								// Check PropertyFlags to determine if it's a user-created variable
-								FString PropertyFlags;
-								(*PropObj)->TryGetStringField(TEXT("PropertyFlags"), PropertyFlags);
-								
-								// Only include properties that are Blueprint-visible/editable
-								// Skip function-internal variables (CallFunc_, K2Node_, etc.)
-								if (!PropName.StartsWith(TEXT("CallFunc_")) && 
-								    !PropName.StartsWith(TEXT("K2Node_")) &&
-								    !PropName.StartsWith(TEXT("Temp_")))
-								{
-									FString VarType;
-									
-									// Map FModel property types to Unreal variable types
-									if (PropType == TEXT("BoolProperty"))
-										VarType = TEXT("bool");
-									else if (PropType == TEXT("IntProperty"))
-										VarType = TEXT("int32");
-									else if (PropType == TEXT("FloatProperty"))
-										VarType = TEXT("float");
-									else if (PropType == TEXT("DoubleProperty"))
-										VarType = TEXT("double");
-									else if (PropType == TEXT("ByteProperty"))
-										VarType = TEXT("uint8");
-									else if (PropType == TEXT("StrProperty"))
-										VarType = TEXT("FString");
-									else if (PropType == TEXT("NameProperty"))
-										VarType = TEXT("FName");
-									else if (PropType == TEXT("TextProperty"))
-										VarType = TEXT("FText");
-									else if (PropType == TEXT("ArrayProperty"))
-										VarType = TEXT("TArray<UObject*>"); // Simplified for now
-									
-									if (!VarType.IsEmpty())
-									{
-										UE_LOG(LogTemp, Log, TEXT("Found variable: %s (%s)"), *PropName, *VarType);
-										OutVariableNames.AddUnique(FName(*PropName));
-										OutVariableTypes.Add(VarType);  // Use Add instead of AddUnique - types must match names array
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-			
-			// Also scan for properties stored directly on the BlueprintGeneratedClass (not in ChildProperties)
-			// These are often component references and class-level variables like MuzzleArray, LaserRoot, etc.
-			UE_LOG(LogTemp, Warning, TEXT("=== SCANNING CLASS-LEVEL PROPERTIES ==="));
-			for (auto& Elem : (*EntryObj)->Values)
-			{
-				FString PropName = Elem.Key;
-				
-				// Skip known structural fields
-				if (PropName == TEXT("Type") || PropName == TEXT("Name") || PropName == TEXT("Class") || 
-				    PropName == TEXT("Super") || PropName == TEXT("Flags") || PropName == TEXT("Properties") ||
-				    PropName == TEXT("Children") || PropName == TEXT("ChildProperties") || PropName == TEXT("FuncMap") ||
-				    PropName == TEXT("ClassFlags") || PropName == TEXT("ClassWithin") || PropName == TEXT("ClassConfigName") ||
-				    PropName == TEXT("bCooked") || PropName == TEXT("ClassDefaultObject") || PropName == TEXT("EditorTags"))
-				{
-					continue;
-				}
-				
-				UE_LOG(LogTemp, Warning, TEXT("Checking class property: %s"), *PropName);
-				
-				if (Elem.Value.IsValid() && Elem.Value->Type == EJson::Object)
-				{
-					const TSharedPtr<FJsonObject>* PropObj;
-					if (Elem.Value->TryGetObject(PropObj) && PropObj->IsValid())
-					{
-						FString PropType;
-						if ((*PropObj)->TryGetStringField(TEXT("Type"), PropType))
-						{
-							UE_LOG(LogTemp, Log, TEXT("Found additional class property: %s (%s)"), *PropName, *PropType);
-							
-							if (PropType == TEXT("ObjectProperty"))
-							{
-								// Check if it's a component
-								const TSharedPtr<FJsonObject>* PropertyClass;
-								if ((*PropObj)->TryGetObjectField(TEXT("PropertyClass"), PropertyClass))
-								{
-									FString ClassName;
-									(*PropertyClass)->TryGetStringField(TEXT("ObjectName"), ClassName);
-									
-									UE_LOG(LogTemp, Warning, TEXT("Class-level ObjectProperty: %s with class: %s"), *PropName, *ClassName);
-									
-									if (ClassName.Contains(TEXT("Component")))
-									{
-										ClassName.RemoveFromStart(TEXT("Class'"));
-										ClassName.RemoveFromEnd(TEXT("'"));
-										
-										// Add as a variable reference instead of actual component
-										FString VarType = FString::Printf(TEXT("ObjectProperty|%s|/Script/Engine"), *ClassName);
-										OutVariableNames.Add(FName(*PropName));
-										OutVariableTypes.Add(VarType);
-										UE_LOG(LogTemp, Log, TEXT("*** ADDED CLASS-LEVEL COMPONENT REFERENCE VARIABLE: %s (%s)"), *PropName, *ClassName);
-									}
-								}
-							}
-							else if (PropType == TEXT("ArrayProperty"))
-							{
-								// Handle array properties (like MuzzleArray)
-								OutVariableNames.AddUnique(FName(*PropName));
-								OutVariableTypes.Add(TEXT("TArray<UObject*>")); // Simplified array type
-								UE_LOG(LogTemp, Log, TEXT("Added class-level array variable: %s"), *PropName);
-							}
-							else if (PropType == TEXT("BoolProperty") || PropType == TEXT("IntProperty") || 
-							         PropType == TEXT("FloatProperty") || PropType == TEXT("DoubleProperty") ||
-							         PropType == TEXT("ByteProperty") || PropType == TEXT("StrProperty") ||
-							         PropType == TEXT("NameProperty") || PropType == TEXT("TextProperty"))
-							{
-								// Handle other variable types
-								FString VarType;
-								if (PropType == TEXT("BoolProperty"))
-									VarType = TEXT("bool");
-								else if (PropType == TEXT("IntProperty"))
-									VarType = TEXT("int32");
-								else if (PropType == TEXT("FloatProperty"))
-									VarType = TEXT("float");
-								else if (PropType == TEXT("DoubleProperty"))
-									VarType = TEXT("double");
-								else if (PropType == TEXT("ByteProperty"))
-									VarType = TEXT("uint8");
-								else if (PropType == TEXT("StrProperty"))
-									VarType = TEXT("FString");
-								else if (PropType == TEXT("NameProperty"))
-									VarType = TEXT("FName");
-								else if (PropType == TEXT("TextProperty"))
-									VarType = TEXT("FText");
-								
-								if (!VarType.IsEmpty())
-								{
-									OutVariableNames.AddUnique(FName(*PropName));
-									OutVariableTypes.Add(VarType);
-									UE_LOG(LogTemp, Log, TEXT("Added class-level variable: %s (%s)"), *PropName, *VarType);
-								}
-							}
-						}
-					}
-				}
+				Index = DryRun.UnresolvedTypes.Num();
+				FFModelUnresolvedType& NewType = DryRun.UnresolvedTypes.AddDefaulted_GetRef();
+				NewType.Kind = Type.Kind;
+				NewType.Name = MoveTemp(Type.Name);
+				NewType.Path = MoveTemp(Type.Path);
+				NewType.FirstJsonFilePath = JsonFilePath;
 			}
-
-			break;
+			++DryRun.UnresolvedTypes[Index].NumReferences;
 		}
-	}
+		Unresolved.Reset();
+	};
 
-	// Parse Function objects to extract return types AND add function names
-	// Build a map of function name -> return type info (Type|ClassName format)
-	TMap<FString, FString> FunctionReturnTypeMap;
-	
-	UE_LOG(LogTemp, Log, TEXT("Parsing Function objects for return types AND function names..."));
-	
-	for (const TSharedPtr<FJsonValue>& Entry : *JsonArray)
+	// Index native types and content before the clock starts, not on the first lookup
+	FModelNativeTypeIndex::EnsureBuilt();
+	FModelAssetIndex::EnsureBuilt();
+	const FModelTypeResolver::FCacheStats CacheStatsBefore = FModelTypeResolver::GetCacheStats();
+	const FModelProbeOrder::FStats ProbeStatsBefore = FModelProbeOrder::GetStats();
+
+	const FDescriptorParseSettings ParseSettings = GetDescriptorParseSettings();
+	TMap<FName, int32> LoadRequests;
+
+	// Same read, parse and resolve stages as the pipelined import; the build stage resolves instead of creating
+	FModelImportPipeline::FOptions Options;
+	Options.MaxBuffered = MaxBufferedDescriptors;
+	Options.NumParseWorkers = FPlatformMisc::NumberOfWorkerThreadsToSpawn();
+
+	FModelImportPipeline::FStages Stages;
+	Stages.Read = [&Entries, &ParseSettings](int32 Index, FModelImportPipeline::FItem& Item)
 	{
-		const TSharedPtr<FJsonObject>* EntryObj;
-		if (!Entry->TryGetObject(EntryObj))
+		Item.Result.JsonFilePath = Entries[Index].JsonFilePath;
+		ReadDescriptorFile(ParseSettings, false, Item);
+	};
+	Stages.Parse = [&ParseSettings](int32 Index, FModelImportPipeline::FItem& Item)
+	{
+		ParseReadDescriptor(ParseSettings, Item);
+	};
+	Stages.Resolve = [&LoadRequests](int32 Index, FModelImportPipeline::FItem& Item)
+	{
+		if (Item.Result.bSuccess)
 		{
-			continue;
+			FModelTypeResolver::PrefetchDescriptorTypes(Item.Result.Descriptor, TSet<FName>(), LoadRequests, Item.LoadRequests);
 		}
-
-		FString EntryType;
-		(*EntryObj)->TryGetStringField(TEXT("Type"), EntryType);
-		
-		if (EntryType == TEXT("Function"))
+	};
+	Stages.Build = [&DryRun, &Entries, &Unresolved, &RecordReference](int32 Index, FModelImportPipeline::FItem& Item)
+	{
+		const FFModelParseResult& Result = Item.Result;
+		if (!Result.bSuccess)
 		{
-			FString FuncName;
-			(*EntryObj)->TryGetStringField(TEXT("Name"), FuncName);
-			
-			if (FuncName.IsEmpty())
-			{
-				continue;
-			}
-			
-			// Replace spaces with underscores to match how we process Children array
-			FuncName = FuncName.Replace(TEXT(" "), TEXT("_"));
-			
-			// ADD THIS FUNCTION TO THE OUTPUT LIST (this was missing!)
-			if (!FuncName.IsEmpty() && FuncName != TEXT("None"))
-			{
-				FName FuncFName(*FuncName);
-				if (FuncFName.IsValid() && !FuncFName.IsNone())
-				{
-					UE_LOG(LogTemp, Warning, TEXT("Adding function from standalone Function entry: %s"), *FuncName);
-					OutFunctionNames.AddUnique(FuncFName);
-				}
-			}
-			
-			// Track that we found this function (even if it has no return value)
-			bool bFoundReturnParam = false;
-			
-			// Look for return parameter in ChildProperties
-			const TArray<TSharedPtr<FJsonValue>>* ChildProps;
-			if ((*EntryObj)->TryGetArrayField(TEXT("ChildProperties"), ChildProps))
-			{
-				for (const TSharedPtr<FJsonValue>& Prop : *ChildProps)
-				{
-					const TSharedPtr<FJsonObject>* PropObj;
-					if (!Prop->TryGetObject(PropObj))
-					{
-						continue;
-					}
-					
-					FString PropertyFlags;
-					(*PropObj)->TryGetStringField(TEXT("PropertyFlags"), PropertyFlags);
-					
-					// Check if this is a return parameter
-					// ReturnParm - explicit return value
-					// OutParm without ReferenceParm - also a return value
-					// OutParm WITH ReferenceParm - this is a reference parameter (like C# ref), NOT a return
-					bool bIsReturnParam = PropertyFlags.Contains(TEXT("ReturnParm"));
-					bool bIsOutParam = PropertyFlags.Contains(TEXT("OutParm")) && !PropertyFlags.Contains(TEXT("ReferenceParm"));
-					
-					if (PropertyFlags.Contains(TEXT("Parm")) && (bIsReturnParam || bIsOutParam))
-					{
-						FString PropType;
-						(*PropObj)->TryGetStringField(TEXT("Type"), PropType);
-						FString ReturnTypeInfo; // Store the formatted return type info
-						
-						// For Class/Object types, try to get the specific class name from MetaClass or PropertyClass
-						if (PropType == TEXT("ClassProperty") || PropType == TEXT("ObjectProperty"))
-						{
-							FString ClassName;
-							FString ClassPath;
-							
-							// Try MetaClass first (used by ClassProperty)
-							const TSharedPtr<FJsonObject>* MetaClassObj;
-							if ((*PropObj)->TryGetObjectField(TEXT("MetaClass"), MetaClassObj))
-							{
-								(*MetaClassObj)->TryGetStringField(TEXT("ObjectName"), ClassName);
-								(*MetaClassObj)->TryGetStringField(TEXT("ObjectPath"), ClassPath);
-							}
-							// Try PropertyClass (used by ObjectProperty)
-							else
-							{
-								const TSharedPtr<FJsonObject>* PropClassObj;
-								if ((*PropObj)->TryGetObjectField(TEXT("PropertyClass"), PropClassObj))
-								{
-									(*PropClassObj)->TryGetStringField(TEXT("ObjectName"), ClassName);
-									(*PropClassObj)->TryGetStringField(TEXT("ObjectPath"), ClassPath);
-								}
-							}
-							
-							if (!ClassName.IsEmpty())
-							{
-								// ObjectName is like "Class'PalBullet'" or "BlueprintGeneratedClass'BP_ShooterAnime_BowBase_C'" - extract just the name
-								if (ClassName.Contains(TEXT("'")))
-								{
-									int32 StartIdx = ClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-									int32 EndIdx = ClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-									if (StartIdx > 0 && EndIdx > StartIdx)
-									{
-										ClassName = ClassName.Mid(StartIdx, EndIdx - StartIdx);
-									}
-								}
-								
-								// Store as "Type|ClassName|ClassPath" format (path may be empty for native classes)
-								ReturnTypeInfo = PropType + TEXT("|") + ClassName;
-								if (!ClassPath.IsEmpty())
-								{
-									ReturnTypeInfo += TEXT("|") + ClassPath;
-								}
-								UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s (Class: %s, Path: %s)"), *FuncName, *PropType, *ClassName, *ClassPath);
-							}
-						}
-						// For Enum types, try to get the specific enum class name from Enum field
-						else if (PropType == TEXT("EnumProperty"))
-						{
-							FString EnumClassName;
-							FString EnumPath;
-							
-							const TSharedPtr<FJsonObject>* EnumObj;
-							if ((*PropObj)->TryGetObjectField(TEXT("Enum"), EnumObj))
-							{
-								(*EnumObj)->TryGetStringField(TEXT("ObjectName"), EnumClassName);
-								(*EnumObj)->TryGetStringField(TEXT("ObjectPath"), EnumPath);
-								
-								if (!EnumClassName.IsEmpty())
-								{
-									// ObjectName is like "Class'EPalAdditionalEffectType'" - extract just the name
-									if (EnumClassName.Contains(TEXT("'")))
-									{
-										int32 StartIdx = EnumClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-										int32 EndIdx = EnumClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-										if (StartIdx > 0 && EndIdx > StartIdx)
-										{
-											EnumClassName = EnumClassName.Mid(StartIdx, EndIdx - StartIdx);
-										}
-									}
-									
-									// Store as "Type|EnumClassName|EnumPath" format
-									ReturnTypeInfo = PropType + TEXT("|") + EnumClassName;
-									if (!EnumPath.IsEmpty())
-									{
-										ReturnTypeInfo += TEXT("|") + EnumPath;
-									}
-									UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s (Enum: %s, Path: %s)"), *FuncName, *PropType, *EnumClassName, *EnumPath);
-								}
-							}
-						}
-						// For Struct types, try to get the specific struct name
-						else if (PropType == TEXT("StructProperty"))
-						{
-							const TSharedPtr<FJsonObject>* StructObj;
-							if ((*PropObj)->TryGetObjectField(TEXT("Struct"), StructObj))
-							{
-								FString StructName;
-								FString StructPath;
-								
-								if ((*StructObj)->TryGetStringField(TEXT("ObjectName"), StructName))
-								{
-									// ObjectName is like "Class'Transform'" or "UserDefinedStruct'F_NPC_PathWalkArray'" - extract just the name
-									if (StructName.Contains(TEXT("'")))
-									{
-										int32 StartIdx = StructName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-										int32 EndIdx = StructName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-										if (StartIdx > 0 && EndIdx > StartIdx)
-										{
-											StructName = StructName.Mid(StartIdx, EndIdx - StartIdx);
-										}
-									}
-								}
-								
-								// Also get ObjectPath for user-defined structs
-								(*StructObj)->TryGetStringField(TEXT("ObjectPath"), StructPath);
-								
-								// Store as "Type|StructName|StructPath" format (path may be empty for native structs)
-								ReturnTypeInfo = PropType + TEXT("|") + StructName;
-								if (!StructPath.IsEmpty())
-								{
-									ReturnTypeInfo += TEXT("|") + StructPath;
-								}
-								
-								UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s (Struct: %s, Path: %s)"), *FuncName, *PropType, *StructName, *StructPath);
-							}
-						}
-						// For Array types, extract the inner type
-						else if (PropType == TEXT("ArrayProperty"))
-						{
-							const TSharedPtr<FJsonObject>* InnerObj;
-							if ((*PropObj)->TryGetObjectField(TEXT("Inner"), InnerObj))
-							{
-								FString InnerType;
-								(*InnerObj)->TryGetStringField(TEXT("Type"), InnerType);
-								
-								// For arrays of objects/classes, get the specific class
-								if (InnerType == TEXT("ObjectProperty") || InnerType == TEXT("ClassProperty"))
-								{
-									FString InnerClassName;
-									FString InnerClassPath;
-									
-									const TSharedPtr<FJsonObject>* InnerPropClassObj;
-									if ((*InnerObj)->TryGetObjectField(TEXT("PropertyClass"), InnerPropClassObj))
-									{
-										(*InnerPropClassObj)->TryGetStringField(TEXT("ObjectName"), InnerClassName);
-										(*InnerPropClassObj)->TryGetStringField(TEXT("ObjectPath"), InnerClassPath);
-									}
-									
-									if (!InnerClassName.IsEmpty())
-									{
-										// Extract class name from "Class'Actor'" format
-										if (InnerClassName.Contains(TEXT("'")))
-										{
-											int32 StartIdx = InnerClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-											int32 EndIdx = InnerClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-											if (StartIdx > 0 && EndIdx > StartIdx)
-											{
-												InnerClassName = InnerClassName.Mid(StartIdx, EndIdx - StartIdx);
-											}
-										}
-										
-										// Store as "ArrayProperty|InnerType|InnerClassName|InnerClassPath"
-										ReturnTypeInfo = PropType + TEXT("|") + InnerType + TEXT("|") + InnerClassName;
-										if (!InnerClassPath.IsEmpty())
-										{
-											ReturnTypeInfo += TEXT("|") + InnerClassPath;
-										}
-										UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Array<%s> (Class: %s)"), *FuncName, *InnerType, *InnerClassName);
-									}
-									else
-									{
-										// Array of objects but no class specified
-										ReturnTypeInfo = PropType + TEXT("|") + InnerType;
-										UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Array<%s>"), *FuncName, *InnerType);
-									}
-								}
-								// For arrays of structs, get the struct name
-								else if (InnerType == TEXT("StructProperty"))
-								{
-									const TSharedPtr<FJsonObject>* InnerStructObj;
-									if ((*InnerObj)->TryGetObjectField(TEXT("Struct"), InnerStructObj))
-									{
-										FString InnerStructName;
-										if ((*InnerStructObj)->TryGetStringField(TEXT("ObjectName"), InnerStructName))
-										{
-											// Extract struct name from "Class'Vector'" format
-											if (InnerStructName.Contains(TEXT("'")))
-											{
-												int32 StartIdx = InnerStructName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-												int32 EndIdx = InnerStructName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-												if (StartIdx > 0 && EndIdx > StartIdx)
-												{
-													InnerStructName = InnerStructName.Mid(StartIdx, EndIdx - StartIdx);
-												}
-											}
-											
-											// Store as "ArrayProperty|StructProperty|StructName"
-											ReturnTypeInfo = PropType + TEXT("|") + InnerType + TEXT("|") + InnerStructName;
-											UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Array<Struct:%s>"), *FuncName, *InnerStructName);
-										}
-									}
-								}
-								else
-								{
-									// Simple array (int, bool, etc.)
-									ReturnTypeInfo = PropType + TEXT("|") + InnerType;
-									UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Array<%s>"), *FuncName, *InnerType);
-								}
-							}
-						}
-						// For Map types, extract both key and value types
-						else if (PropType == TEXT("MapProperty"))
-						{
-							FString KeyType, ValueType;
-							FString KeyClassName, ValueClassName;
-							
-							// Extract KeyProp
-							const TSharedPtr<FJsonObject>* KeyPropObj;
-							if ((*PropObj)->TryGetObjectField(TEXT("KeyProp"), KeyPropObj))
-							{
-								(*KeyPropObj)->TryGetStringField(TEXT("Type"), KeyType);
-								
-								// If key is an object/class, get the class name
-								if (KeyType == TEXT("ObjectProperty") || KeyType == TEXT("ClassProperty"))
-								{
-									const TSharedPtr<FJsonObject>* KeyClassObj;
-									if ((*KeyPropObj)->TryGetObjectField(TEXT("PropertyClass"), KeyClassObj))
-									{
-										(*KeyClassObj)->TryGetStringField(TEXT("ObjectName"), KeyClassName);
-										if (KeyClassName.Contains(TEXT("'")))
-										{
-											int32 StartIdx = KeyClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-											int32 EndIdx = KeyClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-											if (StartIdx > 0 && EndIdx > StartIdx)
-											{
-												KeyClassName = KeyClassName.Mid(StartIdx, EndIdx - StartIdx);
-											}
-										}
-									}
-								}
-								// If key is a struct, get the struct name
-								else if (KeyType == TEXT("StructProperty"))
-								{
-									const TSharedPtr<FJsonObject>* KeyStructObj;
-									if ((*KeyPropObj)->TryGetObjectField(TEXT("Struct"), KeyStructObj))
-									{
-										(*KeyStructObj)->TryGetStringField(TEXT("ObjectName"), KeyClassName);
-										if (KeyClassName.Contains(TEXT("'")))
-										{
-											int32 StartIdx = KeyClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-											int32 EndIdx = KeyClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-											if (StartIdx > 0 && EndIdx > StartIdx)
-											{
-												KeyClassName = KeyClassName.Mid(StartIdx, EndIdx - StartIdx);
-											}
-										}
-									}
-								}
-								// If key is an enum, get the enum type
-								else if (KeyType == TEXT("EnumProperty"))
-								{
-									const TSharedPtr<FJsonObject>* EnumObj;
-									if ((*KeyPropObj)->TryGetObjectField(TEXT("Enum"), EnumObj))
-									{
-										(*EnumObj)->TryGetStringField(TEXT("ObjectName"), KeyClassName);
-										if (KeyClassName.Contains(TEXT("'")))
-										{
-											int32 StartIdx = KeyClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-											int32 EndIdx = KeyClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-											if (StartIdx > 0 && EndIdx > StartIdx)
-											{
-												KeyClassName = KeyClassName.Mid(StartIdx, EndIdx - StartIdx);
-											}
-										}
-									}
-								}
-							}
-							
-							// Extract ValueProp
-							const TSharedPtr<FJsonObject>* ValuePropObj;
-							if ((*PropObj)->TryGetObjectField(TEXT("ValueProp"), ValuePropObj))
-							{
-								(*ValuePropObj)->TryGetStringField(TEXT("Type"), ValueType);
-								
-								// If value is an object/class, get the class name
-								if (ValueType == TEXT("ObjectProperty") || ValueType == TEXT("ClassProperty"))
-								{
-									const TSharedPtr<FJsonObject>* ValueClassObj;
-									if ((*ValuePropObj)->TryGetObjectField(TEXT("PropertyClass"), ValueClassObj))
-									{
-										(*ValueClassObj)->TryGetStringField(TEXT("ObjectName"), ValueClassName);
-										if (ValueClassName.Contains(TEXT("'")))
-										{
-											int32 StartIdx = ValueClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-											int32 EndIdx = ValueClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-											if (StartIdx > 0 && EndIdx > StartIdx)
-											{
-												ValueClassName = ValueClassName.Mid(StartIdx, EndIdx - StartIdx);
-											}
-										}
-									}
-								}
-								// If value is a struct, get the struct name
-								else if (ValueType == TEXT("StructProperty"))
-								{
-									const TSharedPtr<FJsonObject>* ValueStructObj;
-									if ((*ValuePropObj)->TryGetObjectField(TEXT("Struct"), ValueStructObj))
-									{
-										(*ValueStructObj)->TryGetStringField(TEXT("ObjectName"), ValueClassName);
-										if (ValueClassName.Contains(TEXT("'")))
-										{
-											int32 StartIdx = ValueClassName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
-											int32 EndIdx = ValueClassName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-											if (StartIdx > 0 && EndIdx > StartIdx)
-											{
-												ValueClassName = ValueClassName.Mid(StartIdx, EndIdx - StartIdx);
-											}
-										}
-									}
-								}
-							}
-							
-							// Build MapProperty format: "MapProperty|KeyType|ValueType|KeyClassName|ValueClassName"
-							// KeyClassName and ValueClassName may be empty for primitive types
-							ReturnTypeInfo = PropType + TEXT("|") + KeyType + TEXT("|") + ValueType;
-							if (!KeyClassName.IsEmpty())
-							{
-								ReturnTypeInfo += TEXT("|") + KeyClassName;
-							}
-							else
-							{
-								ReturnTypeInfo += TEXT("|");  // Empty slot
-							}
-							if (!ValueClassName.IsEmpty())
-							{
-								ReturnTypeInfo += TEXT("|") + ValueClassName;
-							}
-							
-							UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Map<%s, %s>"), *FuncName, *KeyType, *ValueType);
-							if (!KeyClassName.IsEmpty() || !ValueClassName.IsEmpty())
-							{
-								UE_LOG(LogTemp, Log, TEXT("    Key class: %s, Value class: %s"), 
-									KeyClassName.IsEmpty() ? TEXT("(primitive)") : *KeyClassName,
-									ValueClassName.IsEmpty() ? TEXT("(primitive)") : *ValueClassName);
-							}
-						}
-						else
-						{
-							// Simple type (BoolProperty, IntProperty, etc.)
-							ReturnTypeInfo = PropType;
-							UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s"), *FuncName, *PropType);
-						}
-						
-						// Store the return type for this function
-						FunctionReturnTypeMap.Add(FuncName, ReturnTypeInfo);
-						bFoundReturnParam = true;
-						break; // Only care about first return param
-					}
-				}
-			}
-			
-			// If function was found but has no return parameter, mark it explicitly with "VOID"
-			// This prevents auto-detection from kicking in
-			if (!bFoundReturnParam)
-			{
-				FunctionReturnTypeMap.Add(FuncName, TEXT("VOID"));
-				UE_LOG(LogTemp, Log, TEXT("  Function '%s' has no return value"), *FuncName);
-			}
+			DryRun.ParseErrors.Add(FString::Printf(TEXT("%s: %s"), *Result.Error, *Result.JsonFilePath));
+			return;
 		}
-	}
-	
-	UE_LOG(LogTemp, Log, TEXT("Found %d functions with return types"), FunctionReturnTypeMap.Num());
-	
-	// Build OutFunctionReturnTypes array parallel to OutFunctionNames
-	UE_LOG(LogTemp, Log, TEXT("Building return types array for %d functions"), OutFunctionNames.Num());
-	for (const FName& FuncName : OutFunctionNames)
-	{
-		FString* ReturnType = FunctionReturnTypeMap.Find(FuncName.ToString());
-		if (ReturnType)
+
+		const FFModelClassDescriptor& Descriptor = Result.Descriptor;
+
+		// A parent in the plan is created before this entry, so only parents outside the tree are looked up
+		if (Entries[Index].ParentIndex != INDEX_NONE)
 		{
-			// If marked as VOID (function exists but has no return), convert to empty string
-			// But mark it differently than "not found" so auto-detection doesn't kick in
-			if (*ReturnType == TEXT("VOID"))
-			{
-				OutFunctionReturnTypes.Add(TEXT("VOID"));  // Keep VOID marker
-				UE_LOG(LogTemp, Log, TEXT("  %s -> VOID (no return)"), *FuncName.ToString());
-			}
-			else
-			{
-				OutFunctionReturnTypes.Add(*ReturnType);
-				UE_LOG(LogTemp, Log, TEXT("  %s -> %s"), *FuncName.ToString(), **ReturnType);
-			}
+			++DryRun.NumTypesFromPlan;
 		}
 		else
 		{
-			// Function not found in JSON, add empty string (will trigger auto-detection)
-			OutFunctionReturnTypes.Add(TEXT(""));
-			UE_LOG(LogTemp, Log, TEXT("  %s -> (not in JSON, will auto-detect)"), *FuncName.ToString());
+			FModelTypeResolver::ResolveParentClass(Descriptor.ParentClassPath, &Unresolved);
+			RecordReference(Result.JsonFilePath);
 		}
-	}
-
-	// Even if no functions/components/variables found, still return true for valid Blueprint JSON
-	// Simple Blueprints that just inherit from parents are valid and should be created
-	return true;
-}
-
-UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromFModelJSON(const FString& JsonFilePath, const FString& DestinationPath, const FString& AssetName)
-{
-	// Parse JSON first
-	TArray<FName> FunctionNames;
-	TArray<FName> ComponentNames;
-	TArray<FString> ComponentClasses;
-	TArray<FName> VariableNames;
-	TArray<FString> VariableTypes;
-	TArray<FString> FunctionReturnTypes;
-	FString ParentClassPath;
-	
-	if (!ParseFModelJSON(JsonFilePath, FunctionNames, ComponentNames, ComponentClasses, VariableNames, VariableTypes, FunctionReturnTypes, ParentClassPath))
-	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON file: %s"), *JsonFilePath);
-		return nullptr;
-	}
 
-	// Determine parent class
-	UClass* ParentClass = AActor::StaticClass(); // Default to Actor
-	
-	if (!ParentClassPath.IsEmpty())
-	{
-		// Check if it's a C++ class (prefixed with "CPP:")
-		if (ParentClassPath.StartsWith(TEXT("CPP:")))
+		for (const FFModelVariableDescriptor& Variable : Descriptor.Variables)
 		{
-			FString ClassName = ParentClassPath.Mid(4); // Remove "CPP:" prefix
-			UE_LOG(LogTemp, Log, TEXT("Looking for C++ parent class: %s"), *ClassName);
-			
-			// Try to find the C++ class
-			UClass* FoundClass = FindObject<UClass>(ANY_PACKAGE, *ClassName);
-			if (FoundClass)
-			{
-				ParentClass = FoundClass;
-				UE_LOG(LogTemp, Log, TEXT("✅ Using C++ parent class: %s"), *ParentClass->GetName());
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("❌ C++ class '%s' not found, defaulting to AActor"), *ClassName);
-			}
+			FEdGraphPinType PinType;
+			FModelTypeResolver::ResolveVariableType(Variable.Type, PinType, &Unresolved);
+			RecordReference(Result.JsonFilePath);
+			++DryRun.NumVariables;
 		}
-		else
+
+		// Same filter and return-node rule as AddFunctionDescriptorsToBlueprint / AddFunctionStubToBlueprint
+		for (const FFModelFunctionDescriptor& Function : Descriptor.Functions)
 		{
-			// It's a Blueprint parent class
-			// Convert ObjectPath format to asset path
-			// From: "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.0"
-			// To: "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.BP_GatlingGun"
-			FString AssetPath = ParentClassPath;
-			
-			// Remove the .0 or other numeric suffix
-			int32 DotIndex;
-			if (AssetPath.FindLastChar('.', DotIndex))
-			{
-				FString NumericPart = AssetPath.Mid(DotIndex + 1);
-				if (NumericPart.IsNumeric())
-				{
-					AssetPath = AssetPath.Left(DotIndex);
-				}
-			}
-			
-			// Extract asset name from path
-			FString AssetName;
-			if (AssetPath.Split(TEXT("/"), nullptr, &AssetName, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
-			{
-				// Build proper asset reference: /Path/To/Asset.AssetName
-				AssetPath = AssetPath + TEXT(".") + AssetName;
-			}
-			
-			UE_LOG(LogTemp, Log, TEXT("Trying to load parent Blueprint: %s"), *AssetPath);
-			
-			// Try to load the parent Blueprint
-			UBlueprint* ParentBlueprint = LoadObject<UBlueprint>(nullptr, *AssetPath);
-			
-			// If not found, try alternate path with /Content/Pal/ insertion (for old incorrectly nested assets)
-			if (!ParentBlueprint && AssetPath.StartsWith(TEXT("/Game/Pal/")) && !AssetPath.Contains(TEXT("/Content/")))
-			{
-				FString AlternatePath = AssetPath.Replace(TEXT("/Game/Pal/"), TEXT("/Game/Pal/Content/Pal/"));
-				UE_LOG(LogTemp, Log, TEXT("Trying legacy nested path: %s"), *AlternatePath);
-				ParentBlueprint = LoadObject<UBlueprint>(nullptr, *AlternatePath);
-			}
-			
-			if (ParentBlueprint)
-			{
-				// Skip compilation for performance - parent should already be available
-				UE_LOG(LogTemp, Log, TEXT("Using parent Blueprint without compilation for performance"));
-			
-			if (ParentBlueprint->GeneratedClass)
+			const FString FunctionName = Function.Name.ToString();
+			if (Function.Name.IsNone() || FunctionName.Contains(TEXT("ExecuteUbergraph")))
 			{
-				ParentClass = ParentBlueprint->GeneratedClass;
-				UE_LOG(LogTemp, Log, TEXT("✅ Using parent class: %s"), *ParentClass->GetName());
+				continue;
 			}
-			else
+			++DryRun.NumFunctions;
+
+			if (FModelTypeResolver::HasReturnValue(FunctionName, !Function.ReturnType.IsEmpty(), Function.ReturnType))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("❌ Parent Blueprint failed to compile, defaulting to AActor"));
+				FModelTypeResolver::ResolveReturnType(Function.ReturnType, &Unresolved);
+				RecordReference(Result.JsonFilePath);
 			}
 		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("❌ Parent Blueprint not found: %s, defaulting to AActor"), *AssetPath);
-		}
-		} // End of Blueprint parent handling
+	};
+	const FModelImportPipeline::FStats Stats = FModelImportPipeline::Run(Entries.Num(), Options, Stages);
+
+	DryRun.UnresolvedTypes.StableSort([](const FFModelUnresolvedType& A, const FFModelUnresolvedType& B)
+	{
+		return A.NumReferences > B.NumReferences;
+	});
+
+	DryRun.TotalSeconds = Stats.TotalSeconds;
+	DryRun.ReadSeconds = Stats.ReadSeconds;
+	DryRun.ParseSeconds = Stats.ParseSeconds;
+	DryRun.ResolveSeconds = Stats.ResolveSeconds + Stats.LoadWaitSeconds + Stats.BuildSeconds;
+
+	const FModelTypeResolver::FCacheStats CacheStats = FModelTypeResolver::GetCacheStats();
+	const FModelProbeOrder::FStats ProbeStats = FModelProbeOrder::GetStats();
+	DryRun.NumProbedTypes = ProbeStats.NumResolved - ProbeStatsBefore.NumResolved;
+	DryRun.NumTypeProbes = ProbeStats.NumResolvedProbes - ProbeStatsBefore.NumResolvedProbes;
+	FModelProbeOrder::Save();
+
+	UE_LOG(LogTemp, Log, TEXT("Dry run of %d Blueprints in %.2fs: read %.2fs, parse %.2fs (all workers), resolve %.2fs; %d types resolved, %d from the plan, %d unresolved, %d parse errors; type lookups %d cached, %d probed (%.2f probes per resolved type)"),
+		Entries.Num(), DryRun.TotalSeconds, DryRun.ReadSeconds, DryRun.ParseSeconds, DryRun.ResolveSeconds,
+		DryRun.NumTypesResolved, DryRun.NumTypesFromPlan, DryRun.UnresolvedTypes.Num(), DryRun.ParseErrors.Num(),
+		CacheStats.NumHits - CacheStatsBefore.NumHits, CacheStats.NumMisses - CacheStatsBefore.NumMisses,
+		DryRun.NumProbedTypes > 0 ? double(DryRun.NumTypeProbes) / DryRun.NumProbedTypes : 0.0);
+
+	return DryRun;
+}
+
+/** Error reported for a Blueprint that CreateBlueprintFromDescriptor did not return */
+static const TCHAR* GetCreateFailureMessage(EFModelCreateStatus Status)
+{
+	return Status == EFModelCreateStatus::SaveFailed ? TEXT("Failed to save Blueprint package") : TEXT("Failed to create Blueprint");
+}
+
+/**
+ * Undo the creation of an asset whose package could not be saved. It leaves the asset registry and gives up its
+ * name, so a later attempt in this session creates it again instead of finding an unsaved copy in memory.
+ */
+static void DiscardUnsavedAsset(UObject* Asset)
+{
+	UPackage* Package = Asset->GetOutermost();
+	FAssetRegistryModule::AssetDeleted(Asset);
+
+	if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+	{
+		// The generated classes are looked up by name just like the Blueprint
+		FBlueprintEditorUtils::RemoveGeneratedClasses(Blueprint);
+
+		// The sweep could neither find nor load it
+		FModelPinFixups::Forget(Blueprint);
 	}
+
+	Asset->ClearFlags(RF_Public | RF_Standalone);
+	Asset->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty | REN_ForceNoResetLoaders);
+	Asset->MarkAsGarbage();
+
+	// Left empty; CreateAsset reuses it if the asset is created again
+	Package->SetDirtyFlag(false);
+}
+
+/**
+ * Create a Blueprint asset deriving from ParentClass and add the descriptor's variables and functions, without saving it
+ * @return The new Blueprint, or nullptr if the asset could not be created
+ */
+static UBlueprint* BuildBlueprintFromDescriptor(const FFModelClassDescriptor& Descriptor, UClass* ParentClass, const FString& DestinationPath, const FString& AssetName)
+{
 	// Create Blueprint asset
 	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
 	
@@ -2398,18 +959,18 @@ UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromFModelJSON(const
 	}
 
 	// Log what we parsed
-	UE_LOG(LogTemp, Log, TEXT("Parsed: %d functions, %d component references (as variables), %d variables"), FunctionNames.Num(), ComponentNames.Num(), VariableNames.Num());
+	UE_LOG(LogTemp, Log, TEXT("Parsed: %d functions, %d component references (as variables), %d variables"), Descriptor.Functions.Num(), Descriptor.Components.Num(), Descriptor.Variables.Num());
 	
 	// Skip component creation - components are now added as reference variables instead
 	UE_LOG(LogTemp, Log, TEXT("Skipping component creation - using component reference variables instead"));
 
 	// Add variables (including component references)
-	UE_LOG(LogTemp, Log, TEXT("Attempting to add %d variables..."), VariableNames.Num());
-	int32 VarCount = AddVariablesToBlueprint(NewBlueprint, VariableNames, VariableTypes);
+	UE_LOG(LogTemp, Log, TEXT("Attempting to add %d variables..."), Descriptor.Variables.Num());
+	int32 VarCount = UDummyBlueprintFunctionLibrary::AddVariableDescriptorsToBlueprint(NewBlueprint, Descriptor.Variables);
 	UE_LOG(LogTemp, Log, TEXT("Added %d variables"), VarCount);
 
 	// Add functions with return type information
-	int32 FuncCount = AddMultipleFunctionStubsToBlueprint(NewBlueprint, FunctionNames, FunctionReturnTypes);
+	int32 FuncCount = UDummyBlueprintFunctionLibrary::AddFunctionDescriptorsToBlueprint(NewBlueprint, Descriptor.Functions);
 	UE_LOG(LogTemp, Log, TEXT("Added %d functions"), FuncCount);
 
 	// Skip compilation for performance - dummy Blueprints don't need to be executable
@@ -2431,18 +992,285 @@ UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromFModelJSON(const
 		UE_LOG(LogTemp, Log, TEXT("Successfully created Blueprint with GeneratedClass: %s"), *NewBlueprint->GeneratedClass->GetName());
 	}
 
+	return NewBlueprint;
+}
+
+FFModelWaveResult UDummyBlueprintFunctionLibrary::CreateBlueprintWaveFromFModelJSON(const TArray<FString>& JsonFilePaths, const TArray<FString>& DestinationPaths, const TArray<FString>& AssetNames)
+{
+	check(IsInGameThread());
+
+	FFModelWaveResult Wave;
+	if (DestinationPaths.Num() != JsonFilePaths.Num() || AssetNames.Num() != JsonFilePaths.Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("CreateBlueprintWaveFromFModelJSON: got %d files, %d destination paths and %d asset names"), JsonFilePaths.Num(), DestinationPaths.Num(), AssetNames.Num());
+		return Wave;
+	}
+
+	Wave.Blueprints.SetNumZeroed(JsonFilePaths.Num());
+	Wave.Errors.SetNum(JsonFilePaths.Num());
+
+	// Nothing in a wave depends on another member, so every parse can run at once;
+	// their parents were created by earlier waves
+	double StartTime = FPlatformTime::Seconds();
+	TArray<FFModelParseResult> ParseResults = ParseFModelJSONBatch(JsonFilePaths);
+	Wave.ParseSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// UObject creation is game-thread only
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < ParseResults.Num(); ++Index)
+	{
+		FFModelParseResult& Result = ParseResults[Index];
+		if (!Result.bSuccess)
+		{
+			Wave.Errors[Index] = MoveTemp(Result.Error);
+			continue;
+		}
+
+		EFModelCreateStatus Status;
+		Wave.Blueprints[Index] = CreateBlueprintFromDescriptor(MoveTemp(Result.Descriptor), DestinationPaths[Index], AssetNames[Index], &Status);
+		if (Wave.Blueprints[Index])
+		{
+			++Wave.NumCreated;
+		}
+		else
+		{
+			Wave.Errors[Index] = GetCreateFailureMessage(Status);
+		}
+	}
+	Wave.CreateSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogTemp, Log, TEXT("Wave of %d Blueprints: parse %.2fs, create %.2fs (%d created)"),
+		JsonFilePaths.Num(), Wave.ParseSeconds, Wave.CreateSeconds, Wave.NumCreated);
+
+	return Wave;
+}
+
+FFModelPipelineResult UDummyBlueprintFunctionLibrary::ImportFModelBlueprintsPipelined(const TArray<FString>& JsonFilePaths, const TArray<FString>& DestinationPaths, const TArray<FString>& AssetNames, int32 MaxBufferedDescriptors)
+{
+	return ImportBlueprintsPipelined(JsonFilePaths, DestinationPaths, AssetNames, MaxBufferedDescriptors, [](int32, UBlueprint*, const FString&, uint64) {});
+}
+
+FFModelPipelineResult UDummyBlueprintFunctionLibrary::ImportBlueprintsPipelined(const TArray<FString>& JsonFilePaths, const TArray<FString>& DestinationPaths, const TArray<FString>& AssetNames, int32 MaxBufferedDescriptors, FModelPipelinedImport::FOnBlueprintDone OnBlueprintDone)
+{
+	check(IsInGameThread());
+
+	FFModelPipelineResult Pipeline;
+	if (DestinationPaths.Num() != JsonFilePaths.Num() || AssetNames.Num() != JsonFilePaths.Num())
+	{
+		UE_LOG(LogTemp, Error, TEXT("ImportFModelBlueprintsPipelined: got %d files, %d destination paths and %d asset names"), JsonFilePaths.Num(), DestinationPaths.Num(), AssetNames.Num());
+		return Pipeline;
+	}
+
+	Pipeline.Blueprints.SetNumZeroed(JsonFilePaths.Num());
+	Pipeline.Errors.SetNum(JsonFilePaths.Num());
+
+	FModelNativeTypeIndex::EnsureBuilt();
+	FModelAssetIndex::EnsureBuilt();
+	const FModelTypeResolver::FCacheStats CacheStatsBefore = FModelTypeResolver::GetCacheStats();
+	const FModelProbeOrder::FStats ProbeStatsBefore = FModelProbeOrder::GetStats();
+
+	const FDescriptorParseSettings ParseSettings = GetDescriptorParseSettings();
+	TArray<uint64> ContentHashes;
+	ContentHashes.SetNumZeroed(JsonFilePaths.Num());
+
+	// The packages this import creates are never loaded ahead: they are replaced, not read
+	TSet<FName> DestinationPackages;
+	for (int32 Index = 0; Index < JsonFilePaths.Num(); ++Index)
+	{
+		DestinationPackages.Add(FName(*(DestinationPaths[Index] / AssetNames[Index])));
+	}
+	TMap<FName, int32> LoadRequests;
+
+	// Items finish once their package is on disk, still in input order
+	FModelImportPipeline::FAsyncSaveQueue Saves(MaxBufferedDescriptors, [&Pipeline, &ContentHashes, &OnBlueprintDone](int32 Index, bool bSaved)
+	{
+		TObjectPtr<UBlueprint>& Blueprint = Pipeline.Blueprints[Index];
+		if (Blueprint && bSaved)
+		{
+			++Pipeline.NumCreated;
+		}
+		else if (Blueprint)
+		{
+			// Nothing usable is on disk, so the import must not count it as done
+			DiscardUnsavedAsset(Blueprint);
+			Blueprint = nullptr;
+			Pipeline.Errors[Index] = GetCreateFailureMessage(EFModelCreateStatus::SaveFailed);
+		}
+
+		OnBlueprintDone(Index, Blueprint, Pipeline.Errors[Index], ContentHashes[Index]);
+	});
+
+	// Read and parse on worker threads; resolve, create and save on the game thread, which type lookups and
+	// asset creation need. The resolve stage only starts package loads, so they overlap with earlier builds.
+	FModelImportPipeline::FOptions Options;
+	Options.MaxBuffered = MaxBufferedDescriptors;
+	Options.NumParseWorkers = FPlatformMisc::NumberOfWorkerThreadsToSpawn();
+
+	FModelImportPipeline::FStages Stages;
+	Stages.Read = [&JsonFilePaths, &ParseSettings](int32 Index, FModelImportPipeline::FItem& Item)
+	{
+		Item.Result.JsonFilePath = JsonFilePaths[Index];
+		ReadDescriptorFile(ParseSettings, true, Item);
+	};
+	Stages.Parse = [&ParseSettings](int32 Index, FModelImportPipeline::FItem& Item)
+	{
+		ParseReadDescriptor(ParseSettings, Item);
+	};
+	Stages.Resolve = [&DestinationPackages, &LoadRequests](int32 Index, FModelImportPipeline::FItem& Item)
+	{
+		if (Item.Result.bSuccess)
+		{
+			FModelTypeResolver::PrefetchDescriptorTypes(Item.Result.Descriptor, DestinationPackages, LoadRequests, Item.LoadRequests);
+		}
+	};
+	Stages.Build = [&Pipeline, &ContentHashes, &DestinationPaths, &AssetNames, &Saves](int32 Index, FModelImportPipeline::FItem& Item)
+	{
+		FFModelParseResult& Result = Item.Result;
+		ContentHashes[Index] = Result.ContentHash;
+		if (!Result.bSuccess)
+		{
+			Pipeline.Errors[Index] = MoveTemp(Result.Error);
+			Saves.Skip(Index);
+			return;
+		}
+
+		// A parent whose write is still in flight may yet fail and be discarded: find out before deriving from it
+		UClass* ParentClass = FModelTypeResolver::ResolveParentClass(Result.Descriptor.ParentClassPath);
+		if (Saves.IsPending(UBlueprint::GetBlueprintFromClass(ParentClass)))
+		{
+			Saves.Flush();
+			ParentClass = FModelTypeResolver::ResolveParentClass(Result.Descriptor.ParentClassPath);
+		}
+
+		UBlueprint* Blueprint = BuildBlueprintFromDescriptor(Result.Descriptor, ParentClass, DestinationPaths[Index], AssetNames[Index]);
+		if (!Blueprint)
+		{
+			Pipeline.Errors[Index] = GetCreateFailureMessage(EFModelCreateStatus::CreateFailed);
+			Saves.Skip(Index);
+			return;
+		}
+
+		Pipeline.Blueprints[Index] = Blueprint;
+		const FString PackageName = Blueprint->GetOutermost()->GetName();
+		Saves.Save(Index, Blueprint, FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension()));
+	};
+
+	const double StartTime = FPlatformTime::Seconds();
+	const FModelImportPipeline::FStats Stats = FModelImportPipeline::Run(JsonFilePaths.Num(), Options, Stages);
+
+	// Saving is timed on its own; the writes waited for inside Build are not creation time either
+	const double SaveWaitInBuildSeconds = Saves.GetWaitSeconds();
+	Saves.Flush();
+
+	Pipeline.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	Pipeline.ReadSeconds = Stats.ReadSeconds;
+	Pipeline.ParseSeconds = Stats.ParseSeconds;
+	Pipeline.ResolveSeconds = Stats.ResolveSeconds + Stats.LoadWaitSeconds;
+	Pipeline.CreateSeconds = Stats.BuildSeconds - Saves.GetSaveSeconds() - SaveWaitInBuildSeconds;
+	Pipeline.CreateStallSeconds = Stats.BuildStallSeconds;
+	Pipeline.SaveSeconds = Saves.GetSaveSeconds();
+	Pipeline.SaveWaitSeconds = Saves.GetWaitSeconds();
+	Pipeline.PeakBufferedDescriptors = Stats.PeakBuffered;
+
+	const FModelTypeResolver::FCacheStats CacheStats = FModelTypeResolver::GetCacheStats();
+	const FModelProbeOrder::FStats ProbeStats = FModelProbeOrder::GetStats();
+	Pipeline.NumProbedTypes = ProbeStats.NumResolved - ProbeStatsBefore.NumResolved;
+	Pipeline.NumTypeProbes = ProbeStats.NumResolvedProbes - ProbeStatsBefore.NumResolvedProbes;
+	FModelProbeOrder::Save();
+
+	UE_LOG(LogTemp, Log, TEXT("Pipelined %d Blueprints in %.2fs: read %.2fs, parse %.2fs (all workers), resolve %.2fs, create %.2fs, save %.2fs, waited for parse %.2fs, for writes %.2fs, peak %d buffered (%d created); type lookups %d cached, %d probed (%.2f probes per resolved type)"),
+		JsonFilePaths.Num(), Pipeline.TotalSeconds, Pipeline.ReadSeconds, Pipeline.ParseSeconds, Pipeline.ResolveSeconds, Pipeline.CreateSeconds,
+		Pipeline.SaveSeconds, Pipeline.CreateStallSeconds, Pipeline.SaveWaitSeconds, Pipeline.PeakBufferedDescriptors, Pipeline.NumCreated,
+		CacheStats.NumHits - CacheStatsBefore.NumHits, CacheStats.NumMisses - CacheStatsBefore.NumMisses,
+		Pipeline.NumProbedTypes > 0 ? double(Pipeline.NumTypeProbes) / Pipeline.NumProbedTypes : 0.0);
+
+	return Pipeline;
+}
+
+FFModelPinFixupResult UDummyBlueprintFunctionLibrary::ApplyFModelPinFixups()
+{
+	const FModelPinFixups::FApplyStats Stats = FModelPinFixups::Apply();
+
+	FFModelPinFixupResult Result;
+	Result.NumPatched = Stats.NumPatched;
+	Result.NumUnresolved = Stats.NumUnresolved;
+	Result.NumBlueprintsSaved = Stats.NumBlueprintsSaved;
+	Result.NumBlueprintsNotSaved = Stats.NumBlueprintsNotSaved;
+	Result.Seconds = Stats.Seconds;
+	return Result;
+}
+
+UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromFModelJSON(const FString& JsonFilePath, const FString& DestinationPath, const FString& AssetName)
+{
+	EFModelCreateStatus Status;
+	return CreateBlueprintFromFModelJSONWithStatus(JsonFilePath, DestinationPath, AssetName, Status);
+}
+
+UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromFModelJSONWithStatus(const FString& JsonFilePath, const FString& DestinationPath, const FString& AssetName, EFModelCreateStatus& OutStatus)
+{
+	// Parse JSON first
+	FFModelClassDescriptor Descriptor;
+	if (!ParseFModelClassDescriptor(JsonFilePath, Descriptor))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON file: %s"), *JsonFilePath);
+		OutStatus = EFModelCreateStatus::ParseFailed;
+		return nullptr;
+	}
+
+	return CreateBlueprintFromDescriptor(MoveTemp(Descriptor), DestinationPath, AssetName, &OutStatus);
+}
+
+UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromParsedDescriptor(const FFModelClassDescriptor& Descriptor, const FString& DestinationPath, const FString& AssetName)
+{
+	return CreateBlueprintFromDescriptor(FFModelClassDescriptor(Descriptor), DestinationPath, AssetName);
+}
+
+UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromParsedDescriptorWithStatus(const FFModelClassDescriptor& Descriptor, const FString& DestinationPath, const FString& AssetName, EFModelCreateStatus& OutStatus)
+{
+	return CreateBlueprintFromDescriptor(FFModelClassDescriptor(Descriptor), DestinationPath, AssetName, &OutStatus);
+}
+
+UBlueprint* UDummyBlueprintFunctionLibrary::CreateBlueprintFromDescriptor(FFModelClassDescriptor&& Descriptor, const FString& DestinationPath, const FString& AssetName, EFModelCreateStatus* OutStatus)
+{
+	EFModelCreateStatus IgnoredStatus;
+	EFModelCreateStatus& Status = OutStatus ? *OutStatus : IgnoredStatus;
+
+	// Determine parent class (AActor if there is none or it was not found)
+	UClass* ParentClass = FModelTypeResolver::ResolveParentClass(Descriptor.ParentClassPath);
+
+	UBlueprint* NewBlueprint = BuildBlueprintFromDescriptor(Descriptor, ParentClass, DestinationPath, AssetName);
+	if (!NewBlueprint)
+	{
+		Status = EFModelCreateStatus::CreateFailed;
+		return nullptr;
+	}
+
 	// Save
 	FString PackageName = DestinationPath + TEXT("/") + AssetName;
 	UPackage* Package = NewBlueprint->GetOutermost();
 	FSavePackageArgs SaveArgs;
 	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
-	UPackage::SavePackage(Package, NewBlueprint, *PackageFileName, SaveArgs);
+	if (!UPackage::SavePackage(Package, NewBlueprint, *PackageFileName, SaveArgs))
+	{
+		// Nothing usable is on disk, so the import must not count it as done
+		UE_LOG(LogTemp, Error, TEXT("Failed to save Blueprint package: %s"), *PackageFileName);
+		DiscardUnsavedAsset(NewBlueprint);
+		Status = EFModelCreateStatus::SaveFailed;
+		return nullptr;
+	}
 
+	Status = EFModelCreateStatus::Created;
 	return NewBlueprint;
 }
 
 UUserDefinedStruct* UDummyBlueprintFunctionLibrary::CreateUserDefinedStructFromJSON(const FString& JsonFilePath, const FString& DestinationPath, const FString& StructName)
+{
+	EFModelCreateStatus Status;
+	return CreateUserDefinedStructFromJSONWithStatus(JsonFilePath, DestinationPath, StructName, Status);
+}
+
+UUserDefinedStruct* UDummyBlueprintFunctionLibrary::CreateUserDefinedStructFromJSONWithStatus(const FString& JsonFilePath, const FString& DestinationPath, const FString& StructName, EFModelCreateStatus& OutStatus)
 {
 	UE_LOG(LogTemp, Log, TEXT("Creating UserDefinedStruct: %s at %s"), *StructName, *DestinationPath);
 
@@ -2452,6 +1280,7 @@ UUserDefinedStruct* UDummyBlueprintFunctionLibrary::CreateUserDefinedStructFromJ
 	if (!Package)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Failed to create package for struct: %s"), *PackageName);
+		OutStatus = EFModelCreateStatus::CreateFailed;
 		return nullptr;
 	}
 
@@ -2460,6 +1289,7 @@ UUserDefinedStruct* UDummyBlueprintFunctionLibrary::CreateUserDefinedStructFromJ
 	if (!NewStruct)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Failed to create UserDefinedStruct: %s"), *StructName);
+		OutStatus = EFModelCreateStatus::CreateFailed;
 		return nullptr;
 	}
 
@@ -2503,8 +1333,15 @@ UUserDefinedStruct* UDummyBlueprintFunctionLibrary::CreateUserDefinedStructFromJ
 	FSavePackageArgs SaveArgs;
 	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
 	FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
-	UPackage::SavePackage(Package, NewStruct, *PackageFileName, SaveArgs);
+	if (!UPackage::SavePackage(Package, NewStruct, *PackageFileName, SaveArgs))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to save UserDefinedStruct package: %s"), *PackageFileName);
+		DiscardUnsavedAsset(NewStruct);
+		OutStatus = EFModelCreateStatus::SaveFailed;
+		return nullptr;
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("✅ Successfully created UserDefinedStruct: %s"), *StructName);
+	OutStatus = EFModelCreateStatus::Created;
 	return NewStruct;
 }
@@ -0,0 +1,172 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelAssetIndex.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+namespace
+{
+	/** Asset name -> packages holding an asset of that name; almost always exactly one */
+	using FPackagesByName = TMap<FName, TArray<FName, TInlineAllocator<1>>>;
+
+	FPackagesByName Blueprints;
+	FPackagesByName Structs;
+	FModelAssetIndex::FBuildStats BuildStats;
+	bool bIsBuilt = false;
+	FDelegateHandle AssetCreatedHandle;
+	FDelegateHandle AssetRemovedHandle;
+
+	void AddPackage(FPackagesByName& Packages, FName AssetName, FName PackageName)
+	{
+		TArray<FName, TInlineAllocator<1>>& Found = Packages.FindOrAdd(AssetName);
+		if (Found.Contains(PackageName))
+		{
+			return;
+		}
+		if (Found.Num() == 1)
+		{
+			++BuildStats.NumAmbiguous;
+		}
+		Found.Add(PackageName);
+	}
+
+	void RemovePackage(FPackagesByName& Packages, FName AssetName, FName PackageName)
+	{
+		if (TArray<FName, TInlineAllocator<1>>* Found = Packages.Find(AssetName))
+		{
+			Found->Remove(PackageName);
+			if (Found->Num() == 0)
+			{
+				Packages.Remove(AssetName);
+			}
+		}
+	}
+
+	FName FindPackage(const FPackagesByName& Packages, FName AssetName, FName PreferredPackage)
+	{
+		FModelAssetIndex::EnsureBuilt();
+
+		const TArray<FName, TInlineAllocator<1>>* Found = Packages.Find(AssetName);
+		if (!Found || Found->Num() == 0)
+		{
+			return NAME_None;
+		}
+		if (Found->Num() > 1 && Found->Contains(PreferredPackage))
+		{
+			return PreferredPackage;
+		}
+		return (*Found)[0];
+	}
+
+	void OnAssetCreated(UObject* Asset)
+	{
+		if (Cast<UBlueprint>(Asset))
+		{
+			AddPackage(Blueprints, Asset->GetFName(), Asset->GetOutermost()->GetFName());
+		}
+		else if (Cast<UUserDefinedStruct>(Asset))
+		{
+			AddPackage(Structs, Asset->GetFName(), Asset->GetOutermost()->GetFName());
+		}
+	}
+
+	void OnAssetRemoved(const FAssetData& AssetData)
+	{
+		RemovePackage(Blueprints, AssetData.AssetName, AssetData.PackageName);
+		RemovePackage(Structs, AssetData.AssetName, AssetData.PackageName);
+	}
+}
+
+namespace FModelAssetIndex
+{
+	FBuildStats Build()
+	{
+		check(IsInGameThread());
+		const double StartTime = FPlatformTime::Seconds();
+
+		// An asset the initial scan has not reached yet would look missing. A commandlet does no initial scan
+		// at all, so without this it would only see assets already in memory
+		IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+		if (AssetRegistry.IsLoadingAssets() || IsRunningCommandlet())
+		{
+			AssetRegistry.SearchAllAssets(true);
+		}
+
+		if (!AssetCreatedHandle.IsValid())
+		{
+			AssetCreatedHandle = AssetRegistry.OnInMemoryAssetCreated().AddStatic(&OnAssetCreated);
+			AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&OnAssetRemoved);
+		}
+
+		Blueprints.Reset();
+		Structs.Reset();
+		BuildStats = FBuildStats();
+
+		const FTopLevelAssetPath StructClassPath = UUserDefinedStruct::StaticClass()->GetClassPathName();
+
+		// Blueprint subclasses (widget, animation, ...) generate BP_Foo_C classes too
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+		Filter.ClassPaths.Add(StructClassPath);
+		Filter.bRecursiveClasses = true;
+
+		AssetRegistry.EnumerateAssets(Filter, [&StructClassPath](const FAssetData& AssetData)
+		{
+			AddPackage(AssetData.AssetClassPath == StructClassPath ? Structs : Blueprints, AssetData.AssetName, AssetData.PackageName);
+			return true;
+		});
+
+		bIsBuilt = true;
+		BuildStats.NumBlueprints = Blueprints.Num();
+		BuildStats.NumStructs = Structs.Num();
+		BuildStats.Seconds = FPlatformTime::Seconds() - StartTime;
+
+		UE_LOG(LogTemp, Log, TEXT("Asset index: %d Blueprints, %d UserDefinedStructs in %.1fms (%d names in several packages)"),
+			BuildStats.NumBlueprints, BuildStats.NumStructs, BuildStats.Seconds * 1000.0, BuildStats.NumAmbiguous);
+
+		return BuildStats;
+	}
+
+	void EnsureBuilt()
+	{
+		if (!bIsBuilt)
+		{
+			Build();
+		}
+	}
+
+	FBuildStats GetBuildStats()
+	{
+		return BuildStats;
+	}
+
+	FName FindBlueprintPackage(FName AssetName, FName PreferredPackage)
+	{
+		return FindPackage(Blueprints, AssetName, PreferredPackage);
+	}
+
+	FName FindStructPackage(FName AssetName, FName PreferredPackage)
+	{
+		return FindPackage(Structs, AssetName, PreferredPackage);
+	}
+
+	void Shutdown()
+	{
+		if (AssetCreatedHandle.IsValid())
+		{
+			if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+			{
+				AssetRegistry->OnInMemoryAssetCreated().Remove(AssetCreatedHandle);
+				AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+			}
+			AssetCreatedHandle.Reset();
+			AssetRemovedHandle.Reset();
+		}
+		Blueprints.Empty();
+		Structs.Empty();
+		bIsBuilt = false;
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Asset name -> package for every Blueprint and UserDefinedStruct the asset registry knows, built from
+ * one GetAssets query and kept current as assets are created or removed. Lets the type resolver load
+ * the one package that holds a type, or nothing, instead of trying folders until a load succeeds.
+ * Game thread only.
+ */
+namespace FModelAssetIndex
+{
+	struct FBuildStats
+	{
+		int32 NumBlueprints = 0;
+		int32 NumStructs = 0;
+		/** Asset names held by more than one package */
+		int32 NumAmbiguous = 0;
+		double Seconds = 0.0;
+	};
+
+	/** Query the asset registry (waiting for its initial scan, or running one in a commandlet) and replace the index */
+	FBuildStats Build();
+
+	/** Build the index unless it was built already; it is kept current from then on */
+	void EnsureBuilt();
+
+	FBuildStats GetBuildStats();
+
+	/**
+	 * Package holding the Blueprint or UserDefinedStruct named AssetName ("BP_Foo", "F_Bar")
+	 * @param PreferredPackage - Package the export hinted at; wins when several packages hold that name
+	 * @return NAME_None if the asset registry knows no such asset
+	 */
+	FName FindBlueprintPackage(FName AssetName, FName PreferredPackage = NAME_None);
+	FName FindStructPackage(FName AssetName, FName PreferredPackage = NAME_None);
+
+	/** Release the index and the asset registry hooks; called on module shutdown */
+	void Shutdown();
+}
@@ -0,0 +1,276 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelDescriptorCache.h"
+#include "FModelClassDescriptor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	/** "FMDC" */
+	constexpr uint32 CacheMagic = 0x43444D46;
+
+	/** Tracked size of the cache directory in bytes, -1 until the first Store measures it */
+	int64 CacheBytes = -1;
+	FCriticalSection CacheBytesLock;
+
+	/** Set by SetCacheDir; empty for the default location. Guarded by CacheBytesLock */
+	FString CacheDirOverride;
+
+	/** Caller holds CacheBytesLock */
+	FString GetCacheDirLocked()
+	{
+		if (!CacheDirOverride.IsEmpty())
+		{
+			return CacheDirOverride;
+		}
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("FModelImport"), TEXT("DescriptorCache"));
+	}
+
+	FString GetCacheDir()
+	{
+		FScopeLock Lock(&CacheBytesLock);
+		return GetCacheDirLocked();
+	}
+
+	FString GetEntryPath(const FXxHash64& ContentHash)
+	{
+		// Fan out on the first two hex digits so no directory holds more than a few hundred entries
+		const FString HashText = FString::Printf(TEXT("%016llx"), ContentHash.Hash);
+		return FPaths::Combine(GetCacheDir(), HashText.Left(2), HashText + TEXT(".bin"));
+	}
+
+	void SerializeName(FArchive& Ar, FName& Name)
+	{
+		FString NameString;
+		if (Ar.IsSaving())
+		{
+			NameString = Name.ToString();
+		}
+		Ar << NameString;
+		if (Ar.IsLoading())
+		{
+			Name = FName(*NameString);
+		}
+	}
+
+	void SerializeTypeRef(FArchive& Ar, FFModelTypeRef& TypeRef)
+	{
+		Ar << TypeRef.Kind;
+		Ar << TypeRef.Container;
+		Ar << TypeRef.KeyKind;
+		SerializeName(Ar, TypeRef.ClassName);
+		Ar << TypeRef.ClassPath;
+		SerializeName(Ar, TypeRef.KeyClassName);
+		if (Ar.IsLoading() && (TypeRef.Kind >= EFModelPropertyKind::Count || TypeRef.KeyKind >= EFModelPropertyKind::Count || TypeRef.Container > EFModelContainerKind::Map))
+		{
+			Ar.SetError();
+		}
+	}
+
+	/** Array count, rejecting counts a corrupt entry could not possibly hold */
+	bool SerializeNum(FArchive& Ar, int32& Num)
+	{
+		Ar << Num;
+		if (Ar.IsLoading() && (Num < 0 || Num > Ar.TotalSize() - Ar.Tell()))
+		{
+			Ar.SetError();
+		}
+		return !Ar.IsError();
+	}
+
+	void SerializeDescriptor(FArchive& Ar, FFModelClassDescriptor& Descriptor)
+	{
+		Ar << Descriptor.ParentClassPath;
+
+		int32 NumFunctions = Descriptor.Functions.Num();
+		if (!SerializeNum(Ar, NumFunctions))
+		{
+			return;
+		}
+		Descriptor.Functions.SetNum(NumFunctions);
+		for (FFModelFunctionDescriptor& Function : Descriptor.Functions)
+		{
+			SerializeName(Ar, Function.Name);
+			SerializeTypeRef(Ar, Function.ReturnType);
+		}
+
+		int32 NumVariables = Descriptor.Variables.Num();
+		if (!SerializeNum(Ar, NumVariables))
+		{
+			return;
+		}
+		Descriptor.Variables.SetNum(NumVariables);
+		for (FFModelVariableDescriptor& Variable : Descriptor.Variables)
+		{
+			SerializeName(Ar, Variable.Name);
+			Ar << Variable.Type;
+		}
+
+		int32 NumComponents = Descriptor.Components.Num();
+		if (!SerializeNum(Ar, NumComponents))
+		{
+			return;
+		}
+		Descriptor.Components.SetNum(NumComponents);
+		for (FFModelComponentDescriptor& Component : Descriptor.Components)
+		{
+			SerializeName(Ar, Component.Name);
+			Ar << Component.ComponentClass;
+		}
+	}
+
+	/**
+	 * Delete least recently used entries until the cache is at most TargetBytes.
+	 * Hits refresh an entry's timestamp, so the modification time is its last use. Only entries count: the
+	 * temp files of stores still being written by other workers are neither measured nor deleted.
+	 * Caller holds CacheBytesLock.
+	 * @return The size of the cache afterwards
+	 */
+	int64 EvictLeastRecentlyUsed(int64 TargetBytes)
+	{
+		struct FCacheFile
+		{
+			FString Path;
+			int64 Size;
+			FDateTime LastUsed;
+		};
+
+		TArray<FCacheFile> Files;
+		int64 TotalBytes = 0;
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		PlatformFile.IterateDirectoryStatRecursively(*GetCacheDirLocked(), [&Files, &TotalBytes](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			if (!StatData.bIsDirectory && FStringView(FilenameOrDirectory).EndsWith(TEXT(".bin")))
+			{
+				Files.Add({ FilenameOrDirectory, StatData.FileSize, StatData.ModificationTime });
+				TotalBytes += StatData.FileSize;
+			}
+			return true;
+		});
+
+		if (TotalBytes <= TargetBytes)
+		{
+			return TotalBytes;
+		}
+
+		Files.Sort([](const FCacheFile& A, const FCacheFile& B) { return A.LastUsed < B.LastUsed; });
+
+		int32 NumEvicted = 0;
+		for (const FCacheFile& File : Files)
+		{
+			if (TotalBytes <= TargetBytes)
+			{
+				break;
+			}
+			if (IFileManager::Get().Delete(*File.Path, false, false, true))
+			{
+				TotalBytes -= File.Size;
+				++NumEvicted;
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("🧹 Descriptor cache: evicted %d entries, %lld KB remain"), NumEvicted, TotalBytes / 1024);
+		return TotalBytes;
+	}
+}
+
+bool FModelDescriptorCache::Load(const FXxHash64& ContentHash, EParseSettings Settings, FFModelClassDescriptor& OutDescriptor)
+{
+	const FString EntryPath = GetEntryPath(ContentHash);
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *EntryPath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 StoredSettings = 0;
+	uint64 Hash = 0;
+	Reader << Magic;
+	Reader << Version;
+	Reader << StoredSettings;
+	Reader << Hash;
+	if (Reader.IsError() || Magic != CacheMagic || Version != ParserVersion || Hash != ContentHash.Hash)
+	{
+		// Written by another parser version (or damaged): it can never hit again, so drop it now
+		IFileManager::Get().Delete(*EntryPath, false, false, true);
+		return false;
+	}
+	if (StoredSettings != uint32(Settings))
+	{
+		// Still valid for the settings it was parsed with; the next store replaces it
+		return false;
+	}
+
+	FFModelClassDescriptor Descriptor;
+	SerializeDescriptor(Reader, Descriptor);
+	if (Reader.IsError())
+	{
+		IFileManager::Get().Delete(*EntryPath, false, false, true);
+		return false;
+	}
+
+	// Mark the entry as recently used for eviction
+	IFileManager::Get().SetTimeStamp(*EntryPath, FDateTime::UtcNow());
+
+	OutDescriptor = MoveTemp(Descriptor);
+	return true;
+}
+
+void FModelDescriptorCache::Store(const FXxHash64& ContentHash, EParseSettings Settings, const FFModelClassDescriptor& Descriptor, int64 MaxCacheBytes)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	uint32 Magic = CacheMagic;
+	uint32 Version = ParserVersion;
+	uint32 StoredSettings = uint32(Settings);
+	uint64 Hash = ContentHash.Hash;
+	Writer << Magic;
+	Writer << Version;
+	Writer << StoredSettings;
+	Writer << Hash;
+	SerializeDescriptor(Writer, const_cast<FFModelClassDescriptor&>(Descriptor));
+
+	// Workers may store the same content concurrently; each writes its own temp file and the last move wins
+	const FString EntryPath = GetEntryPath(ContentHash);
+	const FString TempPath = FString::Printf(TEXT("%s.%s.tmp"), *EntryPath, *FGuid::NewGuid().ToString());
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*EntryPath, *TempPath, true, true))
+	{
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		return;
+	}
+
+	FScopeLock Lock(&CacheBytesLock);
+	if (CacheBytes < 0)
+	{
+		// First store of the session: measure the cache (evicting if a smaller budget was configured since)
+		CacheBytes = EvictLeastRecentlyUsed(MaxCacheBytes);
+	}
+	else
+	{
+		CacheBytes += Bytes.Num();
+	}
+
+	if (CacheBytes > MaxCacheBytes)
+	{
+		// Evict down to 3/4 of the budget so eviction does not run again on the very next store
+		CacheBytes = EvictLeastRecentlyUsed(MaxCacheBytes / 4 * 3);
+	}
+}
+
+void FModelDescriptorCache::SetCacheDir(const FString& Dir)
+{
+	FScopeLock Lock(&CacheBytesLock);
+	CacheDirOverride = Dir;
+	// Measured again by the next store
+	CacheBytes = -1;
+}
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+
+struct FFModelClassDescriptor;
+
+/**
+ * On-disk cache of parsed descriptors under Saved/FModelImport/DescriptorCache/, keyed by the xxHash64
+ * of each export's bytes. Byte-identical exports (most of a re-exported game patch) are deserialized
+ * instead of parsed. Entries written by another parser version are ignored and replaced, entries parsed
+ * with other settings miss, and the least recently used entries are evicted once the cache grows past
+ * its size budget.
+ * Safe to call from worker threads.
+ */
+namespace FModelDescriptorCache
+{
+	/**
+	 * Bump whenever the parser's output for the same input can change, so older entries stop matching
+	 */
+	constexpr uint32 ParserVersion = 3;
+
+	/** Parser settings that change which exports parse, recorded in each entry so it only hits under the same ones */
+	enum class EParseSettings : uint32
+	{
+		None = 0,
+		/** Streaming front-end rather than the FJsonSerializer DOM */
+		Streaming = 1 << 0,
+		/** FModel.Parse.SkipIrrelevantEntries, which lets malformed JSON in skipped entries through */
+		SkipIrrelevantEntries = 1 << 1,
+	};
+	ENUM_CLASS_FLAGS(EParseSettings);
+
+	/**
+	 * Look up the descriptor of an export.
+	 * @param ContentHash - xxHash64 of the export's bytes
+	 * @param Settings - Settings the export would be parsed with
+	 * @param OutDescriptor - Filled on a hit
+	 * @return True on a hit
+	 */
+	bool Load(const FXxHash64& ContentHash, EParseSettings Settings, FFModelClassDescriptor& OutDescriptor);
+
+	/**
+	 * Store the descriptor of an export, evicting old entries if the cache is over budget.
+	 * @param ContentHash - xxHash64 of the export's bytes
+	 * @param Settings - Settings the export was parsed with
+	 * @param Descriptor - The parse result
+	 * @param MaxCacheBytes - Size budget of the whole cache
+	 */
+	void Store(const FXxHash64& ContentHash, EParseSettings Settings, const FFModelClassDescriptor& Descriptor, int64 MaxCacheBytes);
+
+	/**
+	 * Keep the cache in Dir instead of Saved/FModelImport/DescriptorCache/, e.g. so automation tests never touch
+	 * the real one; empty restores the default. Loads and stores already running may finish in the old directory.
+	 */
+	void SetCacheDir(const FString& Dir);
+}
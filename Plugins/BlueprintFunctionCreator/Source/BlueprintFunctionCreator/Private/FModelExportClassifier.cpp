@@ -0,0 +1,215 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelExportClassifier.h"
+#include "FModelStructuralScan.h"
+#include "FModelExportFile.h"
+#include "FModelJsonCursor.h"
+#include "FModelKeys.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+	/** The members of one top-level entry, as views into the text */
+	struct FEntryScan
+	{
+		FFModelJsonString Type;
+		FFModelJsonString Name;
+		bool bHasSuper = false;
+		FFModelJsonString SuperObjectName;
+		FFModelJsonString SuperObjectPath;
+	};
+
+	/** JSON nesting depth of the members of a top-level entry: [ { "Key": ... } ] */
+	constexpr int32 EntryMemberDepth = 2;
+
+	/** Depth of the members of an entry's "Super" object */
+	constexpr int32 SuperMemberDepth = 3;
+
+	/**
+	 * Record a finished entry.
+	 * @return True once nothing later in the file can change the summary
+	 */
+	bool FinishEntry(const FEntryScan& Entry, int32 EntryIndex, FFModelExportSummary& OutSummary)
+	{
+		if (EntryIndex == 0)
+		{
+			OutSummary.FirstEntryType = Entry.Type.ToString();
+			OutSummary.FirstEntryName = Entry.Name.ToString();
+		}
+
+		if (!OutSummary.bHasBlueprintClass && Entry.Type.Equals(TEXT("BlueprintGeneratedClass")))
+		{
+			OutSummary.bHasBlueprintClass = true;
+			OutSummary.BlueprintClassName = Entry.Name.ToString();
+			OutSummary.bHasSuper = Entry.bHasSuper;
+			OutSummary.SuperObjectName = Entry.SuperObjectName.ToString();
+			OutSummary.SuperObjectPath = Entry.SuperObjectPath.ToString();
+		}
+
+		return OutSummary.bHasBlueprintClass;
+	}
+}
+
+void FModelExportClassifier::Summarize(FUtf8StringView JsonText, FFModelExportSummary& OutSummary)
+{
+	const UTF8CHAR* Cur = JsonText.GetData();
+	const UTF8CHAR* const End = Cur + JsonText.Len();
+
+	// Exports are a top-level array of entries
+	Cur = FModelStructuralScan::SkipWhitespace(Cur, End);
+	if (Cur >= End || static_cast<uint8>(*Cur) != '[')
+	{
+		return;
+	}
+	OutSummary.bIsExportArray = true;
+
+	int32 Depth = 0;
+	int32 EntryIndex = -1;
+	FEntryScan Entry;
+	EFModelKey EntryKey = EFModelKey::Unknown;
+	EFModelKey SuperKey = EFModelKey::Unknown;
+	bool bInSuper = false;
+
+	while (Cur < End)
+	{
+		Cur = FModelStructuralScan::FindStructural(Cur, End);
+		if (Cur >= End)
+		{
+			break;
+		}
+
+		const uint8 C = static_cast<uint8>(*Cur);
+		switch (C)
+		{
+		case '"':
+		{
+			bool bEscaped = false;
+			const UTF8CHAR* StringStart = Cur + 1;
+			const UTF8CHAR* StringEnd = FModelStructuralScan::FindStringEnd(StringStart, End, bEscaped);
+			if (StringEnd >= End)
+			{
+				// Unterminated string: the rest of the file is unusable
+				return;
+			}
+			Cur = StringEnd + 1;
+
+			// Strings deeper than the entry members (or its Super members) never matter
+			const bool bEntryMember = (Depth == EntryMemberDepth);
+			if (!bEntryMember && !(Depth == SuperMemberDepth && bInSuper))
+			{
+				break;
+			}
+
+			FFModelJsonString Token;
+			Token.Data = StringStart;
+			Token.Len = UE_PTRDIFF_TO_INT32(StringEnd - StringStart);
+			Token.bUtf8 = true;
+			Token.bEscaped = bEscaped;
+
+			const UTF8CHAR* Next = FModelStructuralScan::SkipWhitespace(Cur, End);
+			const bool bIsKey = Next < End && static_cast<uint8>(*Next) == ':';
+
+			if (bIsKey)
+			{
+				(bEntryMember ? EntryKey : SuperKey) = FModelKeys::Lookup(Token);
+			}
+			else if (bEntryMember)
+			{
+				if (EntryKey == EFModelKey::Type)
+				{
+					Entry.Type = Token;
+				}
+				else if (EntryKey == EFModelKey::Name)
+				{
+					Entry.Name = Token;
+				}
+			}
+			else if (SuperKey == EFModelKey::ObjectName)
+			{
+				Entry.SuperObjectName = Token;
+			}
+			else if (SuperKey == EFModelKey::ObjectPath)
+			{
+				Entry.SuperObjectPath = Token;
+			}
+			break;
+		}
+
+		case '\\':
+			// Only valid inside strings, which are skipped whole; tolerate it like any other stray byte
+			++Cur;
+			break;
+
+		case '{':
+		case '[':
+			if (C == '{' && Depth == 1)
+			{
+				++EntryIndex;
+				Entry = FEntryScan();
+				EntryKey = EFModelKey::Unknown;
+			}
+			else if (C == '{' && Depth == EntryMemberDepth && EntryKey == EFModelKey::Super)
+			{
+				// Super is only a reference when it is an object; a later duplicate replaces it
+				bInSuper = true;
+				Entry.bHasSuper = true;
+				Entry.SuperObjectName = FFModelJsonString();
+				Entry.SuperObjectPath = FFModelJsonString();
+				SuperKey = EFModelKey::Unknown;
+			}
+			++Depth;
+			++Cur;
+			break;
+
+		default:
+			// '}' or ']'
+			--Depth;
+			++Cur;
+			if (Depth == EntryMemberDepth)
+			{
+				bInSuper = false;
+			}
+			else if (Depth == 1 && C == '}' && EntryIndex >= 0)
+			{
+				if (FinishEntry(Entry, EntryIndex, OutSummary))
+				{
+					return;
+				}
+			}
+			else if (Depth <= 0)
+			{
+				return;
+			}
+			break;
+		}
+	}
+}
+
+bool FModelExportClassifier::ClassifyFile(const FString& JsonFilePath, FFModelExportSummary& OutSummary)
+{
+	OutSummary = FFModelExportSummary();
+	OutSummary.JsonFilePath = JsonFilePath;
+
+	FFModelExportFile ExportFile;
+	if (!ExportFile.Open(JsonFilePath))
+	{
+		return false;
+	}
+
+	if (ExportFile.CanParseInPlace())
+	{
+		Summarize(ExportFile.GetUtf8Text(), OutSummary);
+		return true;
+	}
+
+	// UTF-16 exports are rare; convert them once rather than scanning two encodings
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *JsonFilePath))
+	{
+		return false;
+	}
+
+	FTCHARToUTF8 Utf8(*JsonString, JsonString.Len());
+	Summarize(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()), OutSummary);
+	return true;
+}
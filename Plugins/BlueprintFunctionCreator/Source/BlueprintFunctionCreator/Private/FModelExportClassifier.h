@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelExportSummary.h"
+
+/**
+ * Classifies FModel exports from their top-level structure only.
+ * Walks the structural bytes found by FModelStructuralScan, reads just the "Type", "Name" and "Super"
+ * members of each top-level entry, and stops as soon as the first BlueprintGeneratedClass is complete.
+ * It does not validate the JSON; the full parse still does that when the file is imported.
+ */
+namespace FModelExportClassifier
+{
+	/** Summarize UTF-8 export text (BOM already stripped) */
+	void Summarize(FUtf8StringView JsonText, FFModelExportSummary& OutSummary);
+
+	/**
+	 * Read the file (memory-mapped where possible) and summarize it. Safe to call from worker threads.
+	 * @return False if the file could not be read
+	 */
+	bool ClassifyFile(const FString& JsonFilePath, FFModelExportSummary& OutSummary);
+}
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelExportFile.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+	bool HasUtf8Bom(const uint8* Bytes, int64 Size)
+	{
+		return Size >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF;
+	}
+
+	bool HasUtf16Bom(const uint8* Bytes, int64 Size)
+	{
+		return Size >= 2 && ((Bytes[0] == 0xFF && Bytes[1] == 0xFE) || (Bytes[0] == 0xFE && Bytes[1] == 0xFF));
+	}
+}
+
+bool FFModelExportFile::Open(const FString& FilePath)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	MappedHandle.Reset(PlatformFile.OpenMapped(*FilePath));
+	if (MappedHandle.IsValid() && MappedHandle->GetFileSize() > 0)
+	{
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	}
+
+	if (MappedRegion.IsValid())
+	{
+		Bytes = MappedRegion->GetMappedPtr();
+		Size = MappedRegion->GetMappedSize();
+		return true;
+	}
+
+	// Mapping is not available everywhere (pak files, some platforms), and empty files cannot be mapped
+	MappedHandle.Reset();
+	if (!FFileHelper::LoadFileToArray(Buffer, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	Bytes = Buffer.GetData();
+	Size = Buffer.Num();
+	return true;
+}
+
+bool FFModelExportFile::CanParseInPlace() const
+{
+	// Exports without a BOM are treated as UTF-8, which is also what LoadFileToString does
+	return Size <= MAX_int32 && !HasUtf16Bom(Bytes, Size);
+}
+
+FUtf8StringView FFModelExportFile::GetUtf8Text() const
+{
+	const int64 Skip = HasUtf8Bom(Bytes, Size) ? 3 : 0;
+	return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Bytes + Skip), static_cast<int32>(Size - Skip));
+}
+
+void FFModelExportFile::Close()
+{
+	// The region must be released before the handle it maps
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	Buffer.Empty();
+	Bytes = nullptr;
+	Size = 0;
+}
@@ -0,0 +1,43 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/MappedFileHandle.h"
+
+/**
+ * Read-only view of an FModel export file's bytes.
+ * The file is memory-mapped where the platform supports it, otherwise read into a buffer once;
+ * either way the text is handed to the parser as-is, without an FString copy.
+ */
+class FFModelExportFile
+{
+public:
+	/** Map or read the file; false if it cannot be opened */
+	bool Open(const FString& FilePath);
+
+	/** True if the bytes can be parsed as UTF-8 in place (not UTF-16, not over 2 GB) */
+	bool CanParseInPlace() const;
+
+	/** The UTF-8 text, without its BOM */
+	FUtf8StringView GetUtf8Text() const;
+
+	/** The file bytes exactly as stored, BOM included */
+	TArrayView64<const uint8> GetBytes() const { return TArrayView64<const uint8>(Bytes, Size); }
+
+	bool IsMapped() const { return MappedRegion.IsValid(); }
+
+	/** Release the mapping or buffer; the view is empty afterwards */
+	void Close();
+
+private:
+	/** Declared before the region so the region is released first */
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Used when the platform file layer cannot map the file */
+	TArray64<uint8> Buffer;
+
+	const uint8* Bytes = nullptr;
+	int64 Size = 0;
+};
@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelExportIndex.h"
+#include "FModelExportClassifier.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Count.h"
+
+namespace
+{
+	/** "FMIX" */
+	constexpr uint32 IndexMagic = 0x58494D46;
+
+	/** Bump whenever FFModelExportSummary or the classifier's output changes, so stale indexes are rebuilt */
+	constexpr uint32 IndexVersion = 1;
+
+	struct FIndexEntry
+	{
+		/** Relative to the indexed root, '/' separated */
+		FString RelativePath;
+		int64 Size = 0;
+		int64 ModificationTicks = 0;
+		FFModelExportSummary Summary;
+		/** Could not be read this run; never saved, so the next Refresh classifies the file again */
+		bool bUnreadable = false;
+	};
+
+	/** Summary fields only; JsonFilePath is rebuilt from the root so the index survives moving the tree */
+	void SerializeSummary(FArchive& Ar, FFModelExportSummary& Summary)
+	{
+		Ar << Summary.bIsExportArray;
+		Ar << Summary.FirstEntryType;
+		Ar << Summary.FirstEntryName;
+		Ar << Summary.bHasBlueprintClass;
+		Ar << Summary.BlueprintClassName;
+		Ar << Summary.bHasSuper;
+		Ar << Summary.SuperObjectName;
+		Ar << Summary.SuperObjectPath;
+	}
+
+	FArchive& operator<<(FArchive& Ar, FIndexEntry& Entry)
+	{
+		Ar << Entry.RelativePath;
+		Ar << Entry.Size;
+		Ar << Entry.ModificationTicks;
+		SerializeSummary(Ar, Entry.Summary);
+		return Ar;
+	}
+
+	FString NormalizeRoot(const FString& RootFolder)
+	{
+		FString Root = FPaths::ConvertRelativePathToFull(RootFolder);
+		FPaths::NormalizeDirectoryName(Root);
+		return Root;
+	}
+
+	bool LoadIndex(const FString& IndexFilePath, TArray<FIndexEntry>& OutEntries)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *IndexFilePath, FILEREAD_Silent))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes);
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		Reader << Magic;
+		Reader << Version;
+		if (Magic != IndexMagic || Version != IndexVersion)
+		{
+			return false;
+		}
+
+		Reader << OutEntries;
+		if (Reader.IsError())
+		{
+			OutEntries.Reset();
+			return false;
+		}
+		return true;
+	}
+
+	bool SaveIndex(const FString& IndexFilePath, TArray<FIndexEntry>& Entries)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		uint32 Magic = IndexMagic;
+		uint32 Version = IndexVersion;
+		Writer << Magic;
+		Writer << Version;
+
+		// Same layout as serializing the array, minus the entries that could not be read
+		int32 NumSaved = static_cast<int32>(Algo::CountIf(Entries, [](const FIndexEntry& Entry) { return !Entry.bUnreadable; }));
+		Writer << NumSaved;
+		for (FIndexEntry& Entry : Entries)
+		{
+			if (!Entry.bUnreadable)
+			{
+				Writer << Entry;
+			}
+		}
+
+		// Write next to the index and swap it in, so an interrupted save never leaves a truncated index behind.
+		// Shards of one import save the same index concurrently; each writes its own temp file and the last move wins
+		const FString TempFilePath = FString::Printf(TEXT("%s.%s.tmp"), *IndexFilePath, *FGuid::NewGuid().ToString());
+		if (!FFileHelper::SaveArrayToFile(Bytes, *TempFilePath) || !IFileManager::Get().Move(*IndexFilePath, *TempFilePath, true, true))
+		{
+			IFileManager::Get().Delete(*TempFilePath, false, false, true);
+			return false;
+		}
+		return true;
+	}
+}
+
+FString FModelExportIndex::GetIndexFilePath(const FString& RootFolder)
+{
+	// One index per export tree; the root is case-folded so Windows spellings of the same path share it
+	const FString Root = NormalizeRoot(RootFolder);
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("FModelImport"), FString::Printf(TEXT("ExportIndex_%08x.bin"), GetTypeHash(Root.ToLower())));
+}
+
+TArray<FFModelExportSummary> FModelExportIndex::Refresh(const FString& RootFolder, FRefreshStats* OutStats)
+{
+	FRefreshStats Stats;
+	const FString Root = NormalizeRoot(RootFolder);
+	const FString IndexFilePath = GetIndexFilePath(Root);
+
+	TArray<FIndexEntry> OldEntries;
+	Stats.bLoadedIndex = LoadIndex(IndexFilePath, OldEntries);
+
+	TMap<FString, int32> OldEntryByPath;
+	OldEntryByPath.Reserve(OldEntries.Num());
+	for (int32 Index = 0; Index < OldEntries.Num(); ++Index)
+	{
+		OldEntryByPath.Add(OldEntries[Index].RelativePath, Index);
+	}
+
+	// One stat walk of the tree; unchanged files are taken from the old index without being opened
+	TArray<FIndexEntry> Entries;
+	Entries.Reserve(OldEntries.Num());
+	TArray<int32> StaleEntries;
+	int32 NumMatched = 0;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.IterateDirectoryStatRecursively(*Root, [&](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+	{
+		if (StatData.bIsDirectory || !FStringView(FilenameOrDirectory).EndsWith(TEXT(".json"), ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+
+		FString RelativePath = FilenameOrDirectory;
+		FPaths::MakePathRelativeTo(RelativePath, *(Root + TEXT("/")));
+
+		FIndexEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Size = StatData.FileSize;
+		Entry.ModificationTicks = StatData.ModificationTime.GetTicks();
+
+		const int32* OldIndex = OldEntryByPath.Find(RelativePath);
+		NumMatched += OldIndex ? 1 : 0;
+		if (OldIndex && OldEntries[*OldIndex].Size == Entry.Size && OldEntries[*OldIndex].ModificationTicks == Entry.ModificationTicks)
+		{
+			Entry.Summary = MoveTemp(OldEntries[*OldIndex].Summary);
+		}
+		else
+		{
+			StaleEntries.Add(Entries.Num() - 1);
+		}
+		Entry.RelativePath = MoveTemp(RelativePath);
+		return true;
+	});
+
+	// Only new and changed files are read
+	ParallelFor(StaleEntries.Num(), [&Entries, &StaleEntries, &Root](int32 Index)
+	{
+		FIndexEntry& Entry = Entries[StaleEntries[Index]];
+		Entry.bUnreadable = !FModelExportClassifier::ClassifyFile(FPaths::Combine(Root, Entry.RelativePath), Entry.Summary);
+	}, EParallelForFlags::Unbalanced);
+
+	Stats.NumFiles = Entries.Num();
+	Stats.NumReclassified = StaleEntries.Num();
+	for (const int32 EntryIndex : StaleEntries)
+	{
+		if (Entries[EntryIndex].bUnreadable)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("⚠️ Could not read FModel export, will retry on the next refresh: %s"), *Entries[EntryIndex].RelativePath);
+			++Stats.NumUnreadable;
+		}
+	}
+	Stats.NumRemoved = OldEntries.Num() - NumMatched;
+
+	Entries.Sort([](const FIndexEntry& A, const FIndexEntry& B) { return A.RelativePath < B.RelativePath; });
+
+	if (!Stats.bLoadedIndex || Stats.NumReclassified > 0 || Stats.NumRemoved > 0)
+	{
+		if (!SaveIndex(IndexFilePath, Entries))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("⚠️ Could not save FModel export index: %s"), *IndexFilePath);
+		}
+	}
+
+	TArray<FFModelExportSummary> Summaries;
+	Summaries.Reserve(Entries.Num());
+	for (FIndexEntry& Entry : Entries)
+	{
+		FFModelExportSummary& Summary = Summaries.Add_GetRef(MoveTemp(Entry.Summary));
+		Summary.JsonFilePath = FPaths::Combine(Root, Entry.RelativePath);
+		Summary.FileSize = Entry.Size;
+		Summary.ModificationTime = FDateTime(Entry.ModificationTicks);
+	}
+
+	if (OutStats)
+	{
+		*OutStats = Stats;
+	}
+	return Summaries;
+}
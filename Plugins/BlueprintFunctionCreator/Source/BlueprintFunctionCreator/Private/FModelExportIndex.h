@@ -0,0 +1,38 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelExportSummary.h"
+
+/**
+ * Persistent index of an FModel export tree, stored under Saved/FModelImport/.
+ * Holds each JSON file's size, modification time and structural summary, so later runs
+ * revalidate the tree with one stat walk and only re-read files that are new or changed.
+ */
+namespace FModelExportIndex
+{
+	/** What the last Refresh did */
+	struct FRefreshStats
+	{
+		int32 NumFiles = 0;
+		/** New or changed files that were classified again */
+		int32 NumReclassified = 0;
+		/** Index entries whose file no longer exists */
+		int32 NumRemoved = 0;
+		/** Files that could not be read; returned as non-exports but left out of the saved index */
+		int32 NumUnreadable = 0;
+		bool bLoadedIndex = false;
+	};
+
+	/**
+	 * Bring the index of a folder up to date and return it.
+	 * @param RootFolder - Folder holding the FModel export tree
+	 * @param OutStats - Optional counts for logging
+	 * @return A summary for every .json file under RootFolder, sorted by path
+	 */
+	TArray<FFModelExportSummary> Refresh(const FString& RootFolder, FRefreshStats* OutStats = nullptr);
+
+	/** Where the index of RootFolder is stored */
+	FString GetIndexFilePath(const FString& RootFolder);
+}
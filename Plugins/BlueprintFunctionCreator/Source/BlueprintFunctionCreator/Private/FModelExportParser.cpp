@@ -0,0 +1,1185 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelExportParser.h"
+#include "FModelKeys.h"
+#include "FModelPropertyFlags.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+
+namespace
+{
+	/** Extract "Name" from "Class'Name'" / "BlueprintGeneratedClass'Name'" style object names */
+	void ExtractQuotedName(FString& InOutName)
+	{
+		if (InOutName.Contains(TEXT("'")))
+		{
+			int32 StartIdx = InOutName.Find(TEXT("'"), ESearchCase::CaseSensitive) + 1;
+			int32 EndIdx = InOutName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+			if (StartIdx > 0 && EndIdx > StartIdx)
+			{
+				InOutName = InOutName.Mid(StartIdx, EndIdx - StartIdx);
+			}
+		}
+	}
+
+	/** Interned kind of a property's "Type", read from the JSON text without decoding it unless it has escapes */
+	EFModelPropertyKind FindPropertyKind(const FFModelJsonString& Type)
+	{
+		if (Type.bOwned)
+		{
+			return FFModelTypeRef::FindKind(FStringView(Type.Owned));
+		}
+
+		if (Type.bEscaped)
+		{
+			return FFModelTypeRef::FindKind(FStringView(Type.ToString()));
+		}
+
+		if (Type.Data == nullptr)
+		{
+			return EFModelPropertyKind::None;
+		}
+
+		return Type.bUtf8
+			? FFModelTypeRef::FindKind(FUtf8StringView(static_cast<const UTF8CHAR*>(Type.Data), Type.Len))
+			: FFModelTypeRef::FindKind(FStringView(static_cast<const TCHAR*>(Type.Data), Type.Len));
+	}
+
+	/** Set a type reference's kind; an unknown one keeps its exported name so it can still be reported */
+	void SetKind(EFModelPropertyKind& OutKind, FName& OutUnknownName, EFModelPropertyKind Kind, const FFModelJsonString& Type)
+	{
+		OutKind = Kind;
+		if (Kind == EFModelPropertyKind::Unknown)
+		{
+			OutUnknownName = FName(*Type.ToString());
+		}
+	}
+
+	/** "Name" of an object reference's "Class'Name'" ObjectName, None if it has none */
+	FName GetReferencedName(const FFModelObjectRefRecord& Ref)
+	{
+		FString Name = Ref.ObjectName.ToString();
+		ExtractQuotedName(Name);
+		return Name.IsEmpty() ? NAME_None : FName(*Name);
+	}
+
+	FString ToLogString(FName Name)
+	{
+		return Name.IsNone() ? FString() : Name.ToString();
+	}
+
+	/** Map FModel property types to the variable type strings AddVariablesToBlueprint understands */
+	FString GetVariableTypeForProperty(const FFModelJsonString& PropType)
+	{
+		if (PropType.Equals(TEXT("BoolProperty")))
+			return TEXT("bool");
+		if (PropType.Equals(TEXT("IntProperty")))
+			return TEXT("int32");
+		if (PropType.Equals(TEXT("FloatProperty")))
+			return TEXT("float");
+		if (PropType.Equals(TEXT("DoubleProperty")))
+			return TEXT("double");
+		if (PropType.Equals(TEXT("ByteProperty")))
+			return TEXT("uint8");
+		if (PropType.Equals(TEXT("StrProperty")))
+			return TEXT("FString");
+		if (PropType.Equals(TEXT("NameProperty")))
+			return TEXT("FName");
+		if (PropType.Equals(TEXT("TextProperty")))
+			return TEXT("FText");
+		if (PropType.Equals(TEXT("ArrayProperty")))
+			return TEXT("TArray<UObject*>"); // Simplified for now
+		return FString();
+	}
+}
+
+void FFModelExportAccumulator::AddVariable(TArray<FVariableOp>& Ops, const FString& Name, FString&& Type, bool bUniqueName)
+{
+	FVariableOp& Op = Ops.AddDefaulted_GetRef();
+	Op.Name = FName(*Name);
+	Op.Type = MoveTemp(Type);
+	Op.bUniqueName = bUniqueName;
+}
+
+void FFModelExportAccumulator::AddBlueprintClassEntry(const FFModelEntryRecord& Entry)
+{
+	UE_LOG(LogTemp, Warning, TEXT("Found BlueprintGeneratedClass"));
+
+	// Extract parent class from Super field (Blueprint parent)
+	if (Entry.Super.bPresent)
+	{
+		if (Entry.Super.ObjectPath.IsSet())
+		{
+			ParentClassPath = Entry.Super.ObjectPath.ToString();
+			bHasParentClassPath = true;
+			UE_LOG(LogTemp, Warning, TEXT("Found Super ObjectPath: %s"), *ParentClassPath);
+		}
+	}
+	// If no Super field, check for SuperStruct (C++ parent class)
+	else if (Entry.SuperStruct.bPresent && Entry.SuperStruct.ObjectName.IsSet())
+	{
+		FString SuperStructName = Entry.SuperStruct.ObjectName.ToString();
+
+		// Extract class name from "Class'PalWeaponBase'" -> "PalWeaponBase"
+		if (SuperStructName.StartsWith(TEXT("Class'")))
+		{
+			SuperStructName.RemoveFromStart(TEXT("Class'"));
+			SuperStructName.RemoveFromEnd(TEXT("'"));
+			UE_LOG(LogTemp, Warning, TEXT("Found SuperStruct class name: %s"), *SuperStructName);
+			// Store with special prefix to indicate it's a C++ class
+			ParentClassPath = TEXT("CPP:") + SuperStructName;
+			bHasParentClassPath = true;
+		}
+	}
+
+	// Extract function names from Children array
+	if (Entry.bHasChildren)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Found Children array with %d entries"), Entry.Children.Num());
+
+		for (const FFModelJsonString& ChildObjectName : Entry.Children)
+		{
+			if (!ChildObjectName.IsSet())
+			{
+				continue;
+			}
+
+			FString ObjectName = ChildObjectName.ToString();
+			UE_LOG(LogTemp, Warning, TEXT("Found ObjectName: %s"), *ObjectName);
+
+			// Extract function name from "Function'BP_Item_C:GetName'"
+			int32 ColonIndex;
+			if (ObjectName.StartsWith(TEXT("Function'")) && ObjectName.FindChar(':', ColonIndex))
+			{
+				FString FuncName = ObjectName.Mid(ColonIndex + 1);
+				FuncName.RemoveFromEnd(TEXT("'"));
+
+				// Replace spaces with underscores (FName doesn't handle spaces well)
+				FuncName = FuncName.Replace(TEXT(" "), TEXT("_"));
+
+				// Validate the function name
+				if (!FuncName.IsEmpty() && FuncName != TEXT("None"))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Extracted function name: %s"), *FuncName);
+
+					// Create FName and verify it's valid
+					FName FuncFName(*FuncName);
+					if (FuncFName.IsValid() && !FuncFName.IsNone())
+					{
+						ChildFunctionNames.Add(FuncFName);
+					}
+					else
+					{
+						UE_LOG(LogTemp, Error, TEXT("Failed to create valid FName from: %s"), *FuncName);
+					}
+				}
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Children array not found"));
+	}
+
+	// Extract component references and variable properties from ChildProperties array
+	for (const FFModelPropertyRecord& Prop : Entry.ChildProperties)
+	{
+		// Skip certain system properties
+		if (Prop.Name.Equals(TEXT("UberGraphFrame")))
+		{
+			continue;
+		}
+
+		if (Prop.Type.Equals(TEXT("ObjectProperty")))
+		{
+			if (Prop.PropertyClass.bPresent)
+			{
+				const FString PropName = Prop.Name.ToString();
+				FString ClassName = Prop.PropertyClass.ObjectName.ToString();
+
+				UE_LOG(LogTemp, Warning, TEXT("Found ObjectProperty: %s with class: %s"), *PropName, *ClassName);
+
+				// Check if it's a component class
+				if (ClassName.Contains(TEXT("Component")) && !PropName.IsEmpty())
+				{
+					// Clean up class name: "Class'SceneComponent'" -> "SceneComponent"
+					ClassName.RemoveFromStart(TEXT("Class'"));
+					ClassName.RemoveFromEnd(TEXT("'"));
+
+					UE_LOG(LogTemp, Warning, TEXT("*** ADDING COMPONENT REFERENCE VARIABLE: %s (%s)"), *PropName, *ClassName);
+
+					// Add as a variable reference instead of actual component
+					AddVariable(ChildPropertyVariables, PropName, FString::Printf(TEXT("ObjectProperty|%s|/Script/Engine"), *ClassName), false);
+				}
+			}
+		}
+		// Handle Blueprint variables (non-component properties)
+		else if (!Prop.Name.IsEmpty())
+		{
+			FString VarType = GetVariableTypeForProperty(Prop.Type);
+			if (VarType.IsEmpty())
+			{
+				continue;
+			}
+
+			// Only include properties that are Blueprint-visible/editable
+			// Skip function-internal variables (CallFunc_, K2Node_, etc.)
+			const FString PropName = Prop.Name.ToString();
+			if (!PropName.StartsWith(TEXT("CallFunc_")) &&
+			    !PropName.StartsWith(TEXT("K2Node_")) &&
+			    !PropName.StartsWith(TEXT("Temp_")))
+			{
+				UE_LOG(LogTemp, Log, TEXT("Found variable: %s (%s)"), *PropName, *VarType);
+				AddVariable(ChildPropertyVariables, PropName, MoveTemp(VarType), true);
+			}
+		}
+	}
+
+	// Also scan for properties stored directly on the BlueprintGeneratedClass (not in ChildProperties)
+	// These are often component references and class-level variables like MuzzleArray, LaserRoot, etc.
+	UE_LOG(LogTemp, Warning, TEXT("=== SCANNING CLASS-LEVEL PROPERTIES ==="));
+	for (const FFModelClassLevelRecord& ClassLevel : Entry.ClassLevel)
+	{
+		const FString PropName = ClassLevel.Key.ToString();
+		UE_LOG(LogTemp, Warning, TEXT("Checking class property: %s"), *PropName);
+
+		const FFModelPropertyRecord& Prop = ClassLevel.Property;
+		if (!ClassLevel.bIsObject || !Prop.Type.IsSet())
+		{
+			continue;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Found additional class property: %s (%s)"), *PropName, *Prop.Type.ToString());
+
+		if (Prop.Type.Equals(TEXT("ObjectProperty")))
+		{
+			// Check if it's a component
+			if (Prop.PropertyClass.bPresent)
+			{
+				FString ClassName = Prop.PropertyClass.ObjectName.ToString();
+
+				UE_LOG(LogTemp, Warning, TEXT("Class-level ObjectProperty: %s with class: %s"), *PropName, *ClassName);
+
+				if (ClassName.Contains(TEXT("Component")))
+				{
+					ClassName.RemoveFromStart(TEXT("Class'"));
+					ClassName.RemoveFromEnd(TEXT("'"));
+
+					// Add as a variable reference instead of actual component
+					AddVariable(ClassLevelVariables, PropName, FString::Printf(TEXT("ObjectProperty|%s|/Script/Engine"), *ClassName), false);
+					UE_LOG(LogTemp, Log, TEXT("*** ADDED CLASS-LEVEL COMPONENT REFERENCE VARIABLE: %s (%s)"), *PropName, *ClassName);
+				}
+			}
+		}
+		else
+		{
+			// Array properties (like MuzzleArray) and simple variable types
+			FString VarType = GetVariableTypeForProperty(Prop.Type);
+			if (!VarType.IsEmpty())
+			{
+				UE_LOG(LogTemp, Log, TEXT("Added class-level variable: %s (%s)"), *PropName, *VarType);
+				AddVariable(ClassLevelVariables, PropName, MoveTemp(VarType), true);
+			}
+		}
+	}
+}
+
+void FFModelExportAccumulator::AddFunctionEntry(const FFModelEntryRecord& Entry)
+{
+	if (Entry.Name.IsEmpty())
+	{
+		return;
+	}
+
+	// Replace spaces with underscores to match how we process Children array
+	const FString FuncName = Entry.Name.ToString().Replace(TEXT(" "), TEXT("_"));
+
+	if (!FuncName.IsEmpty() && FuncName != TEXT("None"))
+	{
+		FName FuncFName(*FuncName);
+		if (FuncFName.IsValid() && !FuncFName.IsNone())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Adding function from standalone Function entry: %s"), *FuncName);
+			StandaloneFunctionNames.Add(FuncFName);
+		}
+	}
+
+	// Look for return parameter in ChildProperties
+	for (const FFModelPropertyRecord& Prop : Entry.ChildProperties)
+	{
+		// Check if this is a return parameter
+		// ReturnParm - explicit return value
+		// OutParm without ReferenceParm - also a return value
+		// OutParm WITH ReferenceParm - this is a reference parameter (like C# ref), NOT a return
+		const bool bIsReturnParam = EnumHasAnyFlags(Prop.PropertyFlags, CPF_ReturnParm);
+		const bool bIsOutParam = EnumHasAnyFlags(Prop.PropertyFlags, CPF_OutParm) && !EnumHasAnyFlags(Prop.PropertyFlags, CPF_ReferenceParm);
+
+		if (bIsReturnParam || bIsOutParam)
+		{
+			// Store the return type for this function - only care about first return param
+			FunctionReturnTypeMap.Add(FuncName, BuildReturnType(FuncName, Prop));
+			return;
+		}
+	}
+
+	// If function was found but has no return parameter, mark it explicitly with "VOID"
+	// This prevents auto-detection from kicking in
+	FFModelTypeRef VoidType;
+	VoidType.Kind = EFModelPropertyKind::Void;
+	FunctionReturnTypeMap.Add(FuncName, VoidType);
+	UE_LOG(LogTemp, Log, TEXT("  Function '%s' has no return value"), *FuncName);
+}
+
+FFModelTypeRef FFModelExportAccumulator::BuildReturnType(const FString& FuncName, const FFModelPropertyRecord& Prop) const
+{
+	FFModelTypeRef ReturnType;
+	const EFModelPropertyKind Kind = FindPropertyKind(Prop.Type);
+
+	switch (Kind)
+	{
+	// For Class/Object types, try to get the specific class name from MetaClass or PropertyClass
+	case EFModelPropertyKind::Class:
+	case EFModelPropertyKind::Object:
+	{
+		// Try MetaClass first (used by ClassProperty), then PropertyClass (used by ObjectProperty)
+		const FFModelObjectRefRecord& ClassRef = Prop.MetaClass.bPresent ? Prop.MetaClass : Prop.PropertyClass;
+		const FName ClassName = GetReferencedName(ClassRef);
+		if (!ClassName.IsNone())
+		{
+			// Path may be empty for native classes
+			ReturnType.Kind = Kind;
+			ReturnType.ClassName = ClassName;
+			ReturnType.ClassPath = ClassRef.ObjectPath.ToString();
+			UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s (Class: %s, Path: %s)"),
+				*FuncName, FFModelTypeRef::GetKindName(Kind), *ClassName.ToString(), *ReturnType.ClassPath);
+		}
+		break;
+	}
+
+	// For Enum types, try to get the specific enum class name from Enum field
+	case EFModelPropertyKind::Enum:
+	{
+		const FName EnumName = Prop.Enum.bPresent ? GetReferencedName(Prop.Enum) : NAME_None;
+		if (!EnumName.IsNone())
+		{
+			ReturnType.Kind = Kind;
+			ReturnType.ClassName = EnumName;
+			ReturnType.ClassPath = Prop.Enum.ObjectPath.ToString();
+			UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s (Enum: %s, Path: %s)"),
+				*FuncName, FFModelTypeRef::GetKindName(Kind), *EnumName.ToString(), *ReturnType.ClassPath);
+		}
+		break;
+	}
+
+	// For Struct types, try to get the specific struct name
+	case EFModelPropertyKind::Struct:
+		if (Prop.Struct.bPresent)
+		{
+			// Path may be empty for native structs; it locates user-defined ones
+			ReturnType.Kind = Kind;
+			ReturnType.ClassName = GetReferencedName(Prop.Struct);
+			ReturnType.ClassPath = Prop.Struct.ObjectPath.ToString();
+			UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s (Struct: %s, Path: %s)"),
+				*FuncName, FFModelTypeRef::GetKindName(Kind), *ToLogString(ReturnType.ClassName), *ReturnType.ClassPath);
+		}
+		break;
+
+	// For Array types, extract the inner type
+	case EFModelPropertyKind::Array:
+		if (Prop.Inner.bPresent)
+		{
+			const EFModelPropertyKind InnerKind = FindPropertyKind(Prop.Inner.Type);
+			if (InnerKind == EFModelPropertyKind::Object || InnerKind == EFModelPropertyKind::Class)
+			{
+				// Arrays of objects/classes carry their class when the export names one
+				ReturnType.Container = EFModelContainerKind::Array;
+				ReturnType.Kind = InnerKind;
+				if (Prop.Inner.PropertyClass.bPresent)
+				{
+					ReturnType.ClassName = GetReferencedName(Prop.Inner.PropertyClass);
+					if (!ReturnType.ClassName.IsNone())
+					{
+						ReturnType.ClassPath = Prop.Inner.PropertyClass.ObjectPath.ToString();
+					}
+				}
+				UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Array<%s> (Class: %s)"),
+					*FuncName, FFModelTypeRef::GetKindName(InnerKind), *ToLogString(ReturnType.ClassName));
+			}
+			else if (InnerKind == EFModelPropertyKind::Struct)
+			{
+				// For arrays of structs, get the struct name
+				if (Prop.Inner.Struct.bPresent && Prop.Inner.Struct.ObjectName.IsSet())
+				{
+					ReturnType.Container = EFModelContainerKind::Array;
+					ReturnType.Kind = InnerKind;
+					ReturnType.ClassName = GetReferencedName(Prop.Inner.Struct);
+					UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Array<Struct:%s>"), *FuncName, *ToLogString(ReturnType.ClassName));
+				}
+			}
+			else
+			{
+				// Simple array (int, bool, etc.)
+				ReturnType.Container = EFModelContainerKind::Array;
+				SetKind(ReturnType.Kind, ReturnType.ClassName, InnerKind, Prop.Inner.Type);
+				UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Array<%s>"), *FuncName, *Prop.Inner.Type.ToString());
+			}
+		}
+		break;
+
+	// For Map types, extract both key and value types
+	case EFModelPropertyKind::Map:
+	{
+		ReturnType.Container = EFModelContainerKind::Map;
+
+		if (Prop.KeyProp.bPresent)
+		{
+			const EFModelPropertyKind KeyKind = FindPropertyKind(Prop.KeyProp.Type);
+			SetKind(ReturnType.KeyKind, ReturnType.KeyClassName, KeyKind, Prop.KeyProp.Type);
+
+			// Object/class keys carry their class, struct keys their struct, enum keys their enum
+			const FFModelObjectRefRecord* KeyRef = nullptr;
+			if (KeyKind == EFModelPropertyKind::Object || KeyKind == EFModelPropertyKind::Class)
+			{
+				KeyRef = &Prop.KeyProp.PropertyClass;
+			}
+			else if (KeyKind == EFModelPropertyKind::Struct)
+			{
+				KeyRef = &Prop.KeyProp.Struct;
+			}
+			else if (KeyKind == EFModelPropertyKind::Enum)
+			{
+				KeyRef = &Prop.KeyProp.Enum;
+			}
+
+			if (KeyRef && KeyRef->bPresent)
+			{
+				ReturnType.KeyClassName = GetReferencedName(*KeyRef);
+			}
+		}
+
+		if (Prop.ValueProp.bPresent)
+		{
+			const EFModelPropertyKind ValueKind = FindPropertyKind(Prop.ValueProp.Type);
+			SetKind(ReturnType.Kind, ReturnType.ClassName, ValueKind, Prop.ValueProp.Type);
+
+			// If value is an object/class, get the class name; if a struct, the struct name
+			const FFModelObjectRefRecord* ValueRef = nullptr;
+			if (ValueKind == EFModelPropertyKind::Object || ValueKind == EFModelPropertyKind::Class)
+			{
+				ValueRef = &Prop.ValueProp.PropertyClass;
+			}
+			else if (ValueKind == EFModelPropertyKind::Struct)
+			{
+				ValueRef = &Prop.ValueProp.Struct;
+			}
+
+			if (ValueRef && ValueRef->bPresent)
+			{
+				ReturnType.ClassName = GetReferencedName(*ValueRef);
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: Map<%s, %s>"), *FuncName, *Prop.KeyProp.Type.ToString(), *Prop.ValueProp.Type.ToString());
+		if (!ReturnType.KeyClassName.IsNone() || !ReturnType.ClassName.IsNone())
+		{
+			UE_LOG(LogTemp, Log, TEXT("    Key class: %s, Value class: %s"),
+				ReturnType.KeyClassName.IsNone() ? TEXT("(primitive)") : *ReturnType.KeyClassName.ToString(),
+				ReturnType.ClassName.IsNone() ? TEXT("(primitive)") : *ReturnType.ClassName.ToString());
+		}
+		break;
+	}
+
+	default:
+		// Simple type (BoolProperty, IntProperty, etc.)
+		SetKind(ReturnType.Kind, ReturnType.ClassName, Kind, Prop.Type);
+		UE_LOG(LogTemp, Log, TEXT("  Function '%s' has return type: %s"), *FuncName, *Prop.Type.ToString());
+		break;
+	}
+
+	return ReturnType;
+}
+
+void FFModelExportAccumulator::Finish(FFModelClassDescriptor& OutDescriptor)
+{
+	if (bHasParentClassPath)
+	{
+		OutDescriptor.ParentClassPath = MoveTemp(ParentClassPath);
+	}
+
+	// Children first, then standalone Function entries - skip duplicate function names from JSON
+	// The sets only answer "seen before?"; the descriptor arrays keep first-seen order
+	TSet<FName> SeenFunctionNames;
+	SeenFunctionNames.Reserve(ChildFunctionNames.Num() + StandaloneFunctionNames.Num());
+	OutDescriptor.Functions.Reserve(OutDescriptor.Functions.Num() + ChildFunctionNames.Num() + StandaloneFunctionNames.Num());
+	for (const FFModelFunctionDescriptor& Function : OutDescriptor.Functions)
+	{
+		SeenFunctionNames.Add(Function.Name);
+	}
+
+	for (const TArray<FName>* Names : { &ChildFunctionNames, &StandaloneFunctionNames })
+	{
+		for (const FName& FuncName : *Names)
+		{
+			bool bAlreadyAdded = false;
+			SeenFunctionNames.Add(FuncName, &bAlreadyAdded);
+			if (!bAlreadyAdded)
+			{
+				OutDescriptor.Functions.AddDefaulted_GetRef().Name = FuncName;
+			}
+		}
+	}
+
+	// ChildProperties variables first, then class-level ones
+	// A duplicate name drops the whole variable, so names and types can no longer drift apart
+	TSet<FName> SeenVariableNames;
+	SeenVariableNames.Reserve(ChildPropertyVariables.Num() + ClassLevelVariables.Num());
+	OutDescriptor.Variables.Reserve(OutDescriptor.Variables.Num() + ChildPropertyVariables.Num() + ClassLevelVariables.Num());
+	for (const FFModelVariableDescriptor& Variable : OutDescriptor.Variables)
+	{
+		SeenVariableNames.Add(Variable.Name);
+	}
+
+	for (TArray<FVariableOp>* Ops : { &ChildPropertyVariables, &ClassLevelVariables })
+	{
+		for (FVariableOp& Op : *Ops)
+		{
+			bool bAlreadyAdded = false;
+			SeenVariableNames.Add(Op.Name, &bAlreadyAdded);
+			if (Op.bUniqueName && bAlreadyAdded)
+			{
+				continue;
+			}
+
+			FFModelVariableDescriptor& Variable = OutDescriptor.Variables.AddDefaulted_GetRef();
+			Variable.Name = Op.Name;
+			Variable.Type = MoveTemp(Op.Type);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Found %d functions with return types"), FunctionReturnTypeMap.Num());
+
+	// Attach return type info to each function
+	UE_LOG(LogTemp, Log, TEXT("Building return types array for %d functions"), OutDescriptor.Functions.Num());
+	for (FFModelFunctionDescriptor& Function : OutDescriptor.Functions)
+	{
+		const FFModelTypeRef* ReturnType = FunctionReturnTypeMap.Find(Function.Name.ToString());
+		if (ReturnType)
+		{
+			// VOID (function exists but has no return) is kept as a marker distinct from "not found"
+			// so auto-detection doesn't kick in; the type itself was logged as it was read
+			Function.ReturnType = *ReturnType;
+		}
+		else
+		{
+			// Function not found in JSON, leave empty (will trigger auto-detection)
+			UE_LOG(LogTemp, Log, TEXT("  %s -> (not in JSON, will auto-detect)"), *Function.Name.ToString());
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------------------------
+// Streaming front-end
+// ---------------------------------------------------------------------------------------------
+
+namespace
+{
+	/** Read { "ObjectName": ..., "ObjectPath": ... }; a non-object value counts as the field being absent */
+	template <typename CursorType>
+	bool ReadObjectRef(CursorType& Cursor, FFModelObjectRefRecord& Out)
+	{
+		if (Cursor.Peek() != EFModelJsonValue::Object)
+		{
+			return Cursor.SkipValue();
+		}
+
+		Cursor.EnterObject();
+		Out.bPresent = true;
+
+		FFModelJsonString Key;
+		while (Cursor.NextKey(Key))
+		{
+			switch (FModelKeys::Lookup(Key))
+			{
+			case EFModelKey::ObjectName:
+				Cursor.ReadString(Out.ObjectName);
+				break;
+			case EFModelKey::ObjectPath:
+				Cursor.ReadString(Out.ObjectPath);
+				break;
+			default:
+				Cursor.SkipValue();
+				break;
+			}
+		}
+		return !Cursor.HasError();
+	}
+
+	template <typename CursorType>
+	bool ReadInnerProperty(CursorType& Cursor, FFModelInnerPropertyRecord& Out)
+	{
+		if (Cursor.Peek() != EFModelJsonValue::Object)
+		{
+			return Cursor.SkipValue();
+		}
+
+		Cursor.EnterObject();
+		Out.bPresent = true;
+
+		FFModelJsonString Key;
+		while (Cursor.NextKey(Key))
+		{
+			switch (FModelKeys::Lookup(Key))
+			{
+			case EFModelKey::Type:
+				Cursor.ReadString(Out.Type);
+				break;
+			case EFModelKey::PropertyClass:
+				ReadObjectRef(Cursor, Out.PropertyClass);
+				break;
+			case EFModelKey::Struct:
+				ReadObjectRef(Cursor, Out.Struct);
+				break;
+			case EFModelKey::Enum:
+				ReadObjectRef(Cursor, Out.Enum);
+				break;
+			default:
+				Cursor.SkipValue();
+				break;
+			}
+		}
+		return !Cursor.HasError();
+	}
+
+	/** Read a property object; the cursor must be on an object value */
+	template <typename CursorType>
+	bool ReadProperty(CursorType& Cursor, FFModelPropertyRecord& Out)
+	{
+		Cursor.EnterObject();
+
+		FFModelJsonString Key;
+		while (Cursor.NextKey(Key))
+		{
+			switch (FModelKeys::Lookup(Key))
+			{
+			case EFModelKey::Type:
+				Cursor.ReadString(Out.Type);
+				break;
+			case EFModelKey::Name:
+				Cursor.ReadString(Out.Name);
+				break;
+			case EFModelKey::PropertyFlags:
+			{
+				FFModelJsonString FlagsText;
+				Cursor.ReadString(FlagsText);
+				Out.PropertyFlags = FModelPropertyFlags::Parse(FlagsText);
+				break;
+			}
+			case EFModelKey::ObjectName:
+				Cursor.ReadString(Out.ObjectName);
+				break;
+			case EFModelKey::ObjectPath:
+				Cursor.ReadString(Out.ObjectPath);
+				break;
+			case EFModelKey::PropertyClass:
+				ReadObjectRef(Cursor, Out.PropertyClass);
+				break;
+			case EFModelKey::MetaClass:
+				ReadObjectRef(Cursor, Out.MetaClass);
+				break;
+			case EFModelKey::Enum:
+				ReadObjectRef(Cursor, Out.Enum);
+				break;
+			case EFModelKey::Struct:
+				ReadObjectRef(Cursor, Out.Struct);
+				break;
+			case EFModelKey::Inner:
+				ReadInnerProperty(Cursor, Out.Inner);
+				break;
+			case EFModelKey::KeyProp:
+				ReadInnerProperty(Cursor, Out.KeyProp);
+				break;
+			case EFModelKey::ValueProp:
+				ReadInnerProperty(Cursor, Out.ValueProp);
+				break;
+			default:
+				Cursor.SkipValue();
+				break;
+			}
+		}
+		return !Cursor.HasError();
+	}
+
+	/** What a top-level entry turned out to be, as far as the importer is concerned */
+	enum class EFModelEntryRole : uint8
+	{
+		Unknown,
+		BlueprintClass,
+		Function,
+		Ignored
+	};
+
+	/** Skip a value the importer does not read */
+	template <typename CursorType>
+	bool SkipUnused(CursorType& Cursor, const FFModelParseOptions& Options)
+	{
+		return Options.bSkipIrrelevantEntries ? Cursor.SkipValueUnchecked() : Cursor.SkipValue();
+	}
+
+	template <typename CursorType>
+	bool ParseEntry(CursorType& Cursor, const FFModelParseOptions& Options, FFModelExportAccumulator& Accumulator, bool& bInOutFoundClass)
+	{
+		FFModelEntryRecord Entry;
+		EFModelEntryRole Role = EFModelEntryRole::Unknown;
+
+		Cursor.EnterObject();
+
+		FFModelJsonString Key;
+		while (Cursor.NextKey(Key))
+		{
+			// Once the entry is known to be irrelevant, the rest of it is only validated
+			if (Role == EFModelEntryRole::Ignored)
+			{
+				Cursor.SkipValue();
+				continue;
+			}
+
+			const EFModelKey KeyId = FModelKeys::Lookup(Key);
+			if (KeyId == EFModelKey::Type)
+			{
+				Cursor.ReadString(Entry.Type);
+				if (Entry.Type.Equals(TEXT("BlueprintGeneratedClass")))
+				{
+					// Only the first BlueprintGeneratedClass entry is used
+					Role = bInOutFoundClass ? EFModelEntryRole::Ignored : EFModelEntryRole::BlueprintClass;
+				}
+				else
+				{
+					Role = Entry.Type.Equals(TEXT("Function")) ? EFModelEntryRole::Function : EFModelEntryRole::Ignored;
+				}
+
+				// Class default objects, UberGraph bytecode and the like: jump straight to the closing brace
+				if (Role == EFModelEntryRole::Ignored && Options.bSkipIrrelevantEntries)
+				{
+					Cursor.SkipRestOfContainer();
+					break;
+				}
+				continue;
+			}
+
+			if (KeyId == EFModelKey::Name)
+			{
+				Cursor.ReadString(Entry.Name);
+				continue;
+			}
+
+			if (KeyId == EFModelKey::ChildProperties)
+			{
+				if (Cursor.Peek() != EFModelJsonValue::Array)
+				{
+					Cursor.SkipValue();
+					continue;
+				}
+
+				Entry.bHasChildProperties = true;
+				Cursor.EnterArray();
+				while (Cursor.NextElement())
+				{
+					if (Cursor.Peek() == EFModelJsonValue::Object)
+					{
+						ReadProperty(Cursor, Entry.ChildProperties.AddDefaulted_GetRef());
+					}
+					else
+					{
+						Cursor.SkipValue();
+					}
+				}
+				continue;
+			}
+
+			// The remaining members only matter to a BlueprintGeneratedClass entry
+			if (Role == EFModelEntryRole::Function)
+			{
+				SkipUnused(Cursor, Options);
+				continue;
+			}
+
+			if (KeyId == EFModelKey::Children)
+			{
+				if (Cursor.Peek() != EFModelJsonValue::Array)
+				{
+					Cursor.SkipValue();
+					continue;
+				}
+
+				Entry.bHasChildren = true;
+				Cursor.EnterArray();
+				while (Cursor.NextElement())
+				{
+					if (Cursor.Peek() == EFModelJsonValue::Object)
+					{
+						FFModelObjectRefRecord Child;
+						ReadObjectRef(Cursor, Child);
+						Entry.Children.Add(MoveTemp(Child.ObjectName));
+					}
+					else
+					{
+						Cursor.SkipValue();
+					}
+				}
+			}
+			else if (KeyId == EFModelKey::Super)
+			{
+				ReadObjectRef(Cursor, Entry.Super);
+			}
+			else if (FModelKeys::IsStructuralClassField(KeyId))
+			{
+				SkipUnused(Cursor, Options);
+			}
+			else
+			{
+				FFModelClassLevelRecord& ClassLevel = Entry.ClassLevel.AddDefaulted_GetRef();
+				ClassLevel.Key = Key;
+				if (Cursor.Peek() == EFModelJsonValue::Object)
+				{
+					ClassLevel.bIsObject = true;
+					ReadProperty(Cursor, ClassLevel.Property);
+
+					// SuperStruct is both the C++ parent reference and a (Type-less) class-level object
+					if (KeyId == EFModelKey::SuperStruct)
+					{
+						Entry.SuperStruct.bPresent = true;
+						Entry.SuperStruct.ObjectName = ClassLevel.Property.ObjectName;
+						Entry.SuperStruct.ObjectPath = ClassLevel.Property.ObjectPath;
+					}
+				}
+				else
+				{
+					Cursor.SkipValue();
+				}
+			}
+		}
+
+		if (Cursor.HasError())
+		{
+			return false;
+		}
+
+		if (Role == EFModelEntryRole::BlueprintClass)
+		{
+			bInOutFoundClass = true;
+			Accumulator.AddBlueprintClassEntry(Entry);
+		}
+		else if (Role == EFModelEntryRole::Function)
+		{
+			Accumulator.AddFunctionEntry(Entry);
+		}
+		return true;
+	}
+
+	template <typename CharType>
+	bool ParseStreamingImpl(TStringView<CharType> JsonText, const FFModelParseOptions& Options, FFModelExportAccumulator& Accumulator)
+	{
+		TFModelJsonCursor<CharType> Cursor(JsonText);
+
+		// JSON should be an array
+		if (Cursor.Peek() != EFModelJsonValue::Array)
+		{
+			if (!Cursor.SkipValue())
+			{
+				UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON"));
+			}
+			return false;
+		}
+
+		bool bFoundClass = false;
+		Cursor.EnterArray();
+		while (Cursor.NextElement())
+		{
+			if (Cursor.Peek() == EFModelJsonValue::Object)
+			{
+				if (!ParseEntry(Cursor, Options, Accumulator, bFoundClass))
+				{
+					break;
+				}
+			}
+			else if (!Cursor.SkipValue())
+			{
+				break;
+			}
+		}
+
+		if (Cursor.HasError())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON"));
+			return false;
+		}
+		return true;
+	}
+}
+
+bool FModelExportParser::ParseStreaming(FStringView JsonText, FFModelExportAccumulator& Accumulator, const FFModelParseOptions& Options)
+{
+	return ParseStreamingImpl(JsonText, Options, Accumulator);
+}
+
+bool FModelExportParser::ParseStreaming(FUtf8StringView JsonText, FFModelExportAccumulator& Accumulator, const FFModelParseOptions& Options)
+{
+	return ParseStreamingImpl(JsonText, Options, Accumulator);
+}
+
+// ---------------------------------------------------------------------------------------------
+// DOM front-end
+// ---------------------------------------------------------------------------------------------
+
+namespace
+{
+	// FJsonObject::Values is keyed case-insensitively, so one pass over the members that switches on
+	// the key id reads exactly what the equivalent TryGet*Field calls would
+
+	void ReadStringFromDom(const TSharedPtr<FJsonValue>& Value, FFModelJsonString& Out)
+	{
+		FString String;
+		if (Value.IsValid() && Value->TryGetString(String))
+		{
+			Out.SetOwned(MoveTemp(String));
+		}
+	}
+
+	void ReadObjectRefFromDom(const TSharedPtr<FJsonValue>& Value, FFModelObjectRefRecord& Out)
+	{
+		const TSharedPtr<FJsonObject>* RefObj;
+		if (!Value.IsValid() || !Value->TryGetObject(RefObj))
+		{
+			return;
+		}
+
+		Out.bPresent = true;
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Member : (*RefObj)->Values)
+		{
+			switch (FModelKeys::Lookup(FStringView(Member.Key)))
+			{
+			case EFModelKey::ObjectName:
+				ReadStringFromDom(Member.Value, Out.ObjectName);
+				break;
+			case EFModelKey::ObjectPath:
+				ReadStringFromDom(Member.Value, Out.ObjectPath);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	void ReadInnerPropertyFromDom(const TSharedPtr<FJsonValue>& Value, FFModelInnerPropertyRecord& Out)
+	{
+		const TSharedPtr<FJsonObject>* InnerObj;
+		if (!Value.IsValid() || !Value->TryGetObject(InnerObj))
+		{
+			return;
+		}
+
+		Out.bPresent = true;
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Member : (*InnerObj)->Values)
+		{
+			switch (FModelKeys::Lookup(FStringView(Member.Key)))
+			{
+			case EFModelKey::Type:
+				ReadStringFromDom(Member.Value, Out.Type);
+				break;
+			case EFModelKey::PropertyClass:
+				ReadObjectRefFromDom(Member.Value, Out.PropertyClass);
+				break;
+			case EFModelKey::Struct:
+				ReadObjectRefFromDom(Member.Value, Out.Struct);
+				break;
+			case EFModelKey::Enum:
+				ReadObjectRefFromDom(Member.Value, Out.Enum);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	void ReadPropertyFromDom(const TSharedPtr<FJsonObject>& Object, FFModelPropertyRecord& Out)
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Member : Object->Values)
+		{
+			switch (FModelKeys::Lookup(FStringView(Member.Key)))
+			{
+			case EFModelKey::Type:
+				ReadStringFromDom(Member.Value, Out.Type);
+				break;
+			case EFModelKey::Name:
+				ReadStringFromDom(Member.Value, Out.Name);
+				break;
+			case EFModelKey::PropertyFlags:
+			{
+				FFModelJsonString FlagsText;
+				ReadStringFromDom(Member.Value, FlagsText);
+				Out.PropertyFlags = FModelPropertyFlags::Parse(FlagsText);
+				break;
+			}
+			case EFModelKey::ObjectName:
+				ReadStringFromDom(Member.Value, Out.ObjectName);
+				break;
+			case EFModelKey::ObjectPath:
+				ReadStringFromDom(Member.Value, Out.ObjectPath);
+				break;
+			case EFModelKey::PropertyClass:
+				ReadObjectRefFromDom(Member.Value, Out.PropertyClass);
+				break;
+			case EFModelKey::MetaClass:
+				ReadObjectRefFromDom(Member.Value, Out.MetaClass);
+				break;
+			case EFModelKey::Enum:
+				ReadObjectRefFromDom(Member.Value, Out.Enum);
+				break;
+			case EFModelKey::Struct:
+				ReadObjectRefFromDom(Member.Value, Out.Struct);
+				break;
+			case EFModelKey::Inner:
+				ReadInnerPropertyFromDom(Member.Value, Out.Inner);
+				break;
+			case EFModelKey::KeyProp:
+				ReadInnerPropertyFromDom(Member.Value, Out.KeyProp);
+				break;
+			case EFModelKey::ValueProp:
+				ReadInnerPropertyFromDom(Member.Value, Out.ValueProp);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	void ReadEntryFromDom(const TSharedPtr<FJsonObject>& Object, bool bBlueprintClass, FFModelEntryRecord& Out)
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Member : Object->Values)
+		{
+			const EFModelKey KeyId = FModelKeys::Lookup(FStringView(Member.Key));
+			if (KeyId == EFModelKey::Type)
+			{
+				ReadStringFromDom(Member.Value, Out.Type);
+			}
+			else if (KeyId == EFModelKey::Name)
+			{
+				ReadStringFromDom(Member.Value, Out.Name);
+			}
+			else if (KeyId == EFModelKey::ChildProperties)
+			{
+				const TArray<TSharedPtr<FJsonValue>>* ChildProperties;
+				if (Member.Value.IsValid() && Member.Value->TryGetArray(ChildProperties))
+				{
+					Out.bHasChildProperties = true;
+					for (const TSharedPtr<FJsonValue>& Prop : *ChildProperties)
+					{
+						const TSharedPtr<FJsonObject>* PropObj;
+						if (Prop->TryGetObject(PropObj))
+						{
+							ReadPropertyFromDom(*PropObj, Out.ChildProperties.AddDefaulted_GetRef());
+						}
+					}
+				}
+			}
+
+			// The remaining members only matter to a BlueprintGeneratedClass entry
+			if (!bBlueprintClass)
+			{
+				continue;
+			}
+
+			if (KeyId == EFModelKey::Super)
+			{
+				ReadObjectRefFromDom(Member.Value, Out.Super);
+			}
+			else if (KeyId == EFModelKey::Children)
+			{
+				const TArray<TSharedPtr<FJsonValue>>* Children;
+				if (Member.Value.IsValid() && Member.Value->TryGetArray(Children))
+				{
+					Out.bHasChildren = true;
+					for (const TSharedPtr<FJsonValue>& Child : *Children)
+					{
+						const TSharedPtr<FJsonObject>* ChildObj;
+						if (Child->TryGetObject(ChildObj))
+						{
+							FFModelObjectRefRecord ChildRef;
+							ReadObjectRefFromDom(Child, ChildRef);
+							Out.Children.Add(MoveTemp(ChildRef.ObjectName));
+						}
+					}
+				}
+			}
+
+			if (FModelKeys::IsStructuralClassField(KeyId))
+			{
+				continue;
+			}
+
+			// SuperStruct is both the C++ parent reference and a (Type-less) class-level object
+			if (KeyId == EFModelKey::SuperStruct)
+			{
+				ReadObjectRefFromDom(Member.Value, Out.SuperStruct);
+			}
+
+			FFModelClassLevelRecord& ClassLevel = Out.ClassLevel.AddDefaulted_GetRef();
+			ClassLevel.Key.SetOwned(CopyTemp(Member.Key));
+
+			const TSharedPtr<FJsonObject>* PropObj;
+			if (Member.Value.IsValid() && Member.Value->Type == EJson::Object && Member.Value->TryGetObject(PropObj) && PropObj->IsValid())
+			{
+				ClassLevel.bIsObject = true;
+				ReadPropertyFromDom(*PropObj, ClassLevel.Property);
+			}
+		}
+	}
+}
+
+bool FModelExportParser::ParseDom(const FString& JsonText, FFModelExportAccumulator& Accumulator)
+{
+	TSharedPtr<FJsonValue> JsonValue;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+
+	if (!FJsonSerializer::Deserialize(Reader, JsonValue) || !JsonValue.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to parse JSON"));
+		return false;
+	}
+
+	// JSON should be an array
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+	if (!JsonValue->TryGetArray(JsonArray))
+	{
+		return false;
+	}
+
+	bool bFoundClass = false;
+	for (const TSharedPtr<FJsonValue>& Entry : *JsonArray)
+	{
+		const TSharedPtr<FJsonObject>* EntryObj;
+		if (!Entry->TryGetObject(EntryObj))
+		{
+			continue;
+		}
+
+		FString Type;
+		(*EntryObj)->TryGetStringField(TEXT("Type"), Type);
+
+		if (Type == TEXT("BlueprintGeneratedClass") && !bFoundClass)
+		{
+			bFoundClass = true;
+			FFModelEntryRecord Record;
+			ReadEntryFromDom(*EntryObj, true, Record);
+			Accumulator.AddBlueprintClassEntry(Record);
+		}
+		else if (Type == TEXT("Function"))
+		{
+			FFModelEntryRecord Record;
+			ReadEntryFromDom(*EntryObj, false, Record);
+			Accumulator.AddFunctionEntry(Record);
+		}
+	}
+
+	return true;
+}
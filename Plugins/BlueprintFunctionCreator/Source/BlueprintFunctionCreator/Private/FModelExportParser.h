@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelJsonCursor.h"
+#include "FModelClassDescriptor.h"
+#include "UObject/ObjectMacros.h"
+
+/** Object reference as FModel writes it: { "ObjectName": "Class'Foo'", "ObjectPath": "/Script/Bar.0" } */
+struct FFModelObjectRefRecord
+{
+	/** True if the field existed and was a JSON object */
+	bool bPresent = false;
+	FFModelJsonString ObjectName;
+	FFModelJsonString ObjectPath;
+};
+
+/** Nested property description (ArrayProperty "Inner", MapProperty "KeyProp"/"ValueProp") */
+struct FFModelInnerPropertyRecord
+{
+	bool bPresent = false;
+	FFModelJsonString Type;
+	FFModelObjectRefRecord PropertyClass;
+	FFModelObjectRefRecord Struct;
+	FFModelObjectRefRecord Enum;
+};
+
+/** The fields of a property object (ChildProperties entry or class-level property) that the importer reads */
+struct FFModelPropertyRecord
+{
+	FFModelJsonString Type;
+	FFModelJsonString Name;
+	/** Tokenized once while parsing; see FModelPropertyFlags */
+	EPropertyFlags PropertyFlags = CPF_None;
+	FFModelJsonString ObjectName;
+	FFModelJsonString ObjectPath;
+	FFModelObjectRefRecord PropertyClass;
+	FFModelObjectRefRecord MetaClass;
+	FFModelObjectRefRecord Enum;
+	FFModelObjectRefRecord Struct;
+	FFModelInnerPropertyRecord Inner;
+	FFModelInnerPropertyRecord KeyProp;
+	FFModelInnerPropertyRecord ValueProp;
+};
+
+/** Member of a BlueprintGeneratedClass entry that is not one of the known structural fields */
+struct FFModelClassLevelRecord
+{
+	FFModelJsonString Key;
+	/** True if the member value is a JSON object; Property is only filled in that case */
+	bool bIsObject = false;
+	FFModelPropertyRecord Property;
+};
+
+/** The parts of one top-level export entry the importer reads */
+struct FFModelEntryRecord
+{
+	FFModelJsonString Type;
+	FFModelJsonString Name;
+	FFModelObjectRefRecord Super;
+	FFModelObjectRefRecord SuperStruct;
+
+	/** True if "Children" existed and was an array */
+	bool bHasChildren = false;
+	/** ObjectName of each object in "Children" */
+	TArray<FFModelJsonString> Children;
+
+	/** True if "ChildProperties" existed and was an array */
+	bool bHasChildProperties = false;
+	TArray<FFModelPropertyRecord> ChildProperties;
+
+	/** Remaining members, in document order */
+	TArray<FFModelClassLevelRecord> ClassLevel;
+};
+
+/**
+ * Turns export entry records into the ParseFModelJSON outputs.
+ * Both the DOM and the streaming front-ends feed this, so they cannot disagree on results.
+ */
+class FFModelExportAccumulator
+{
+public:
+	/** Consume the first BlueprintGeneratedClass entry of the export */
+	void AddBlueprintClassEntry(const FFModelEntryRecord& Entry);
+
+	/** Consume a standalone "Function" entry */
+	void AddFunctionEntry(const FFModelEntryRecord& Entry);
+
+	/** Move the collected data into the descriptor */
+	void Finish(FFModelClassDescriptor& OutDescriptor);
+
+private:
+	struct FVariableOp
+	{
+		FName Name;
+		FString Type;
+		/** Skip the variable if one with the same name was already collected */
+		bool bUniqueName = false;
+	};
+
+	void AddVariable(TArray<FVariableOp>& Ops, const FString& Name, FString&& Type, bool bUniqueName);
+	FFModelTypeRef BuildReturnType(const FString& FuncName, const FFModelPropertyRecord& Prop) const;
+
+	TArray<FName> ChildFunctionNames;
+	TArray<FName> StandaloneFunctionNames;
+	TArray<FVariableOp> ChildPropertyVariables;
+	TArray<FVariableOp> ClassLevelVariables;
+	TMap<FString, FFModelTypeRef> FunctionReturnTypeMap;
+	FString ParentClassPath;
+	bool bHasParentClassPath = false;
+};
+
+/** Options for the streaming front-end */
+struct FFModelParseOptions
+{
+	/**
+	 * Skip entries the importer never reads (and unread members of the ones it does) by bracket matching
+	 * instead of parsing them. Skipped bytes are not validated, so malformed JSON inside them goes unnoticed.
+	 */
+	bool bSkipIrrelevantEntries = true;
+};
+
+namespace FModelExportParser
+{
+	/** Single forward pass over the JSON text, no DOM */
+	bool ParseStreaming(FStringView JsonText, FFModelExportAccumulator& Accumulator, const FFModelParseOptions& Options = FFModelParseOptions());
+
+	/** Same pass over raw UTF-8 bytes (BOM already stripped), without widening them to TCHAR */
+	bool ParseStreaming(FUtf8StringView JsonText, FFModelExportAccumulator& Accumulator, const FFModelParseOptions& Options = FFModelParseOptions());
+
+	/** Reference implementation over an FJsonSerializer DOM */
+	bool ParseDom(const FString& JsonText, FFModelExportAccumulator& Accumulator);
+}
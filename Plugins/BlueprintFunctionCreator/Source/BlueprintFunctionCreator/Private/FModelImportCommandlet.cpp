@@ -0,0 +1,1083 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportCommandlet.h"
+#include "DummyBlueprintFunctionLibrary.h"
+#include "FModelExportIndex.h"
+#include "FModelImportScheduler.h"
+#include "FModelImportSharding.h"
+#include "FModelImportPaths.h"
+#include "FModelImportJournal.h"
+#include "FModelNativeTypeIndex.h"
+#include "FModelAssetIndex.h"
+#include "FModelPinFixups.h"
+#include "FModelProbeOrder.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "FModelTypeResolver.h"
+#include "FModelExportFile.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** Errors beyond this many are only counted in the report */
+	constexpr int32 MaxReportedErrors = 100;
+
+	struct FImportArgs
+	{
+		FString SourceFolder;
+		FString ContentRoot = TEXT("/Game");
+		FString ReportPath;
+		/** Restrict the Blueprint phase to the JSON files listed in this file, one per line */
+		FString FileListPath;
+		FString JournalPath;
+		bool bNoJournal = false;
+		bool bResetJournal = false;
+		int32 MaxBuffered = 64;
+		int32 NumShards = 1;
+		bool bSkipStructs = false;
+		/** Plan and resolve types only; nothing is created, saved or journaled */
+		bool bDryRun = false;
+	};
+
+	struct FPhaseCounts
+	{
+		int32 Found = 0;
+		int32 Created = 0;
+		int32 Existing = 0;
+		int32 Failed = 0;
+		double Seconds = 0.0;
+
+		TSharedRef<FJsonObject> ToJson() const
+		{
+			TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+			Object->SetNumberField(TEXT("found"), Found);
+			Object->SetNumberField(TEXT("created"), Created);
+			Object->SetNumberField(TEXT("existing"), Existing);
+			Object->SetNumberField(TEXT("failed"), Failed);
+			Object->SetNumberField(TEXT("seconds"), Seconds);
+			return Object;
+		}
+	};
+
+	/** Per-shard line of a coordinator's report */
+	struct FShardRun
+	{
+		int32 Stage = 0;
+		int32 Shard = 0;
+		int32 NumFiles = 0;
+		int32 ExitCode = 0;
+		double Seconds = 0.0;
+		/** Empty with -NoJournal */
+		FString JournalPath;
+	};
+
+	struct FImportReport
+	{
+		int32 NumFiles = 0;
+		double IndexSeconds = 0.0;
+		FModelNativeTypeIndex::FBuildStats NativeTypeIndex;
+		FModelAssetIndex::FBuildStats AssetIndex;
+		FPhaseCounts Structs;
+		FPhaseCounts Blueprints;
+
+		int32 NumDepths = 0;
+		int32 NumCyclic = 0;
+		int32 NumDuplicates = 0;
+		int32 NumMissingParents = 0;
+		double ReadSeconds = 0.0;
+		double ParseSeconds = 0.0;
+		/** Type resolution in a dry run; starting and waiting for package loads in an import */
+		double ResolveSeconds = 0.0;
+		double CreateSeconds = 0.0;
+		double CreateStallSeconds = 0.0;
+		double SaveSeconds = 0.0;
+		double SaveWaitSeconds = 0.0;
+		int32 PeakBufferedDescriptors = 0;
+		int32 NumProbedTypes = 0;
+		int32 NumTypeProbes = 0;
+
+		int32 NumPinsPatched = 0;
+		int32 NumPinsUnresolved = 0;
+		double PinFixupSeconds = 0.0;
+		/** Pins a shard could not patch; its coordinator retries them once every shard is done */
+		TArray<FModelPinFixups::FPinFixup> PendingPinFixups;
+
+		int32 NumStages = 0;
+		TArray<FShardRun> Shards;
+
+		bool bDryRun = false;
+		int32 NumFunctions = 0;
+		int32 NumVariables = 0;
+		int32 NumTypesResolved = 0;
+		int32 NumTypesFromPlan = 0;
+		TArray<FFModelUnresolvedType> UnresolvedTypes;
+
+		TArray<FString> Errors;
+		int32 NumErrors = 0;
+
+		void AddError(FString&& Error)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("❌ %s"), *Error);
+			if (Errors.Num() < MaxReportedErrors)
+			{
+				Errors.Add(MoveTemp(Error));
+			}
+			++NumErrors;
+		}
+
+		int32 GetExitCode() const
+		{
+			return (Structs.Failed > 0 || Blueprints.Failed > 0) ? 1 : 0;
+		}
+	};
+
+	bool DoesAssetExist(const FString& PackagePath, const FString& AssetName)
+	{
+		return FPackageName::DoesPackageExist(PackagePath / AssetName);
+	}
+
+	uint64 HashExportFile(const FString& JsonFilePath)
+	{
+		FFModelExportFile ExportFile;
+		if (!ExportFile.Open(JsonFilePath))
+		{
+			return 0;
+		}
+		const TArrayView64<const uint8> Bytes = ExportFile.GetBytes();
+		return FXxHash64::HashBuffer(Bytes.GetData(), Bytes.Num()).Hash;
+	}
+
+	/** What the journal records of an export: the stat data the export index found, and its hash if it was read */
+	FFModelImportJournal::FExportVersion GetExportVersion(const FFModelExportSummary& Summary, uint64 ContentHash)
+	{
+		FFModelImportJournal::FExportVersion Export;
+		Export.ContentHash = ContentHash;
+		Export.FileSize = Summary.FileSize;
+		Export.ModificationTicks = Summary.ModificationTime.GetTicks();
+		return Export;
+	}
+
+	/**
+	 * Remove a package the import is about to rebuild from memory, the asset registry and disk. A copy loaded
+	 * earlier (e.g. as a parent or pin type) has its loader reset so the file is released, and its objects are
+	 * forgotten so the rebuild does not find them.
+	 * @return False if the file is still there
+	 */
+	bool DeletePackageForRebuild(const FString& PackageName)
+	{
+		IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+		const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+
+		if (UPackage* Package = FindPackage(nullptr, *PackageName))
+		{
+			ResetLoaders(Package);
+
+			TArray<UObject*> Objects;
+			GetObjectsWithPackage(Package, Objects, false);
+			for (UObject* Object : Objects)
+			{
+				if (Object->IsAsset())
+				{
+					AssetRegistry.AssetDeleted(Object);
+				}
+				Object->ClearFlags(RF_Public | RF_Standalone);
+				Object->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty | REN_ForceNoResetLoaders);
+				Object->MarkAsGarbage();
+			}
+
+			// Left empty; CreateAsset reuses it
+			Package->SetDirtyFlag(false);
+		}
+
+		if (!IFileManager::Get().Delete(*PackageFileName, false, true, true))
+		{
+			return false;
+		}
+
+		// Drops the on-disk entry, which an unloaded package still has
+		AssetRegistry.ScanModifiedAssetFiles({ PackageFileName });
+		return true;
+	}
+
+	enum class EExistingAsset : uint8
+	{
+		/** Imported already; nothing to do */
+		Done,
+		/** Not there, or deleted so it is rebuilt */
+		Create,
+		/** An unfinished package could not be deleted; it is recorded as failed and must not be created over */
+		Failed
+	};
+
+	/**
+	 * Whether the asset needs work. With a journal, finished assets are found without checking the package,
+	 * as long as their export still has the journaled size and modification time, or else still hashes to what was
+	 * journaled. A package an interrupted run started but never finished, or created from an export that has changed
+	 * since, is deleted so it is rebuilt. Packages the journal never started are not touched.
+	 * @param OutContentHash - The export's hash if it had to be read, otherwise 0
+	 */
+	EExistingAsset CheckExistingAsset(const FString& PackagePath, const FString& AssetName, const FFModelExportSummary& Summary, FFModelImportJournal* Journal, FImportReport& Report, uint64& OutContentHash)
+	{
+		const FString& JsonFilePath = Summary.JsonFilePath;
+		const FString PackageName = PackagePath / AssetName;
+		OutContentHash = 0;
+		bool bChangedSinceCreated = false;
+		FFModelImportJournal::EStatus Status;
+		FFModelImportJournal::FExportVersion Journaled;
+		if (Journal && Journal->FindRecord(PackageName, Status, Journaled))
+		{
+			if (Status == FFModelImportJournal::EStatus::Existing)
+			{
+				return EExistingAsset::Done;
+			}
+			if (Status == FFModelImportJournal::EStatus::Created)
+			{
+				if (Journaled.FileSize == Summary.FileSize && Journaled.ModificationTicks == Summary.ModificationTime.GetTicks())
+				{
+					return EExistingAsset::Done;
+				}
+
+				// Touched since it was created; only different content makes it stale
+				OutContentHash = HashExportFile(JsonFilePath);
+				if (Journaled.ContentHash != 0 && Journaled.ContentHash == OutContentHash)
+				{
+					// With the new stat data, so the next run does not read it again
+					Journal->Record(Status, PackageName, GetExportVersion(Summary, OutContentHash), JsonFilePath);
+					return EExistingAsset::Done;
+				}
+				bChangedSinceCreated = true;
+			}
+		}
+
+		if (!DoesAssetExist(PackagePath, AssetName))
+		{
+			return EExistingAsset::Create;
+		}
+
+		if (bChangedSinceCreated || (Journal && Journal->WasInterrupted(PackageName)))
+		{
+			UE_LOG(LogTemp, Display, TEXT("FModelImport: %s %s, recreating it"), *PackageName,
+				bChangedSinceCreated ? TEXT("was created from an export that has changed since") : TEXT("was not completed by the interrupted run"));
+			if (!DeletePackageForRebuild(PackageName))
+			{
+				Report.AddError(FString::Printf(TEXT("Could not delete %s to rebuild it from %s"), *PackageName, *JsonFilePath));
+				Journal->Record(FFModelImportJournal::EStatus::Failed, PackageName, {}, JsonFilePath);
+				return EExistingAsset::Failed;
+			}
+			return EExistingAsset::Create;
+		}
+
+		if (Journal)
+		{
+			Journal->Record(FFModelImportJournal::EStatus::Existing, PackageName, {}, JsonFilePath);
+		}
+		return EExistingAsset::Done;
+	}
+
+	/** Phase 1: UserDefinedStructs, which Blueprint variables may reference */
+	void ImportStructs(const FImportArgs& Args, const TArray<FFModelExportSummary>& Summaries, FFModelImportJournal* Journal, FImportReport& Report)
+	{
+		FPhaseCounts& Structs = Report.Structs;
+		const double StartTime = FPlatformTime::Seconds();
+
+		struct FPendingStruct
+		{
+			const FFModelExportSummary* Summary;
+			FString PackagePath;
+			/** Set if checking the journal read the export; creating a struct never reads it */
+			uint64 ContentHash;
+		};
+		TArray<FPendingStruct> Pending;
+
+		for (const FFModelExportSummary& Summary : Summaries)
+		{
+			if (!Summary.bIsExportArray || Summary.FirstEntryType != TEXT("UserDefinedStruct") || Summary.FirstEntryName.IsEmpty())
+			{
+				continue;
+			}
+			++Structs.Found;
+
+			FString PackagePath;
+			FString FileName;
+			if (!FModelImportPaths::GetDestination(Args.SourceFolder, Summary.JsonFilePath, Args.ContentRoot, PackagePath, FileName))
+			{
+				Report.AddError(FString::Printf(TEXT("No destination for %s"), *Summary.JsonFilePath));
+				++Structs.Failed;
+				continue;
+			}
+
+			uint64 ContentHash;
+			const EExistingAsset Existing = CheckExistingAsset(PackagePath, Summary.FirstEntryName, Summary, Journal, Report, ContentHash);
+			if (Existing != EExistingAsset::Create)
+			{
+				++(Existing == EExistingAsset::Done ? Structs.Existing : Structs.Failed);
+				continue;
+			}
+			Pending.Add({ &Summary, MoveTemp(PackagePath), ContentHash });
+		}
+
+		if (Journal)
+		{
+			// Pre-existing packages and the ones about to be created must be on record before anything is created
+			for (const FPendingStruct& Struct : Pending)
+			{
+				Journal->Record(FFModelImportJournal::EStatus::Started, Struct.PackagePath / Struct.Summary->FirstEntryName, {}, Struct.Summary->JsonFilePath);
+			}
+			Journal->Flush();
+		}
+
+		for (const FPendingStruct& Struct : Pending)
+		{
+			const FFModelExportSummary& Summary = *Struct.Summary;
+			const FString& PackagePath = Struct.PackagePath;
+
+			EFModelCreateStatus CreateStatus;
+			const bool bCreated = UDummyBlueprintFunctionLibrary::CreateUserDefinedStructFromJSONWithStatus(Summary.JsonFilePath, PackagePath, Summary.FirstEntryName, CreateStatus) != nullptr;
+			if (bCreated)
+			{
+				++Structs.Created;
+			}
+			else
+			{
+				Report.AddError(FString::Printf(TEXT("Failed to %s struct %s from %s"), CreateStatus == EFModelCreateStatus::SaveFailed ? TEXT("save") : TEXT("create"), *Summary.FirstEntryName, *Summary.JsonFilePath));
+				++Structs.Failed;
+			}
+
+			if (Journal)
+			{
+				const FFModelImportJournal::EStatus Status = bCreated ? FFModelImportJournal::EStatus::Created : FFModelImportJournal::EStatus::Failed;
+				Journal->Record(Status, PackagePath / Summary.FirstEntryName, GetExportVersion(Summary, Struct.ContentHash), Summary.JsonFilePath);
+			}
+		}
+
+		Structs.Seconds = FPlatformTime::Seconds() - StartTime;
+		UE_LOG(LogTemp, Display, TEXT("FModelImport: structs %d found, %d created, %d existing, %d failed (%.2fs)"), Structs.Found, Structs.Created, Structs.Existing, Structs.Failed, Structs.Seconds);
+	}
+
+	void RecordPlan(const FFModelImportPlan& Plan, FImportReport& Report)
+	{
+		Report.Blueprints.Found = Plan.Entries.Num() + Plan.CyclicJsonFilePaths.Num();
+		Report.NumDepths = Plan.NumDepths;
+		Report.NumCyclic = Plan.CyclicJsonFilePaths.Num();
+		Report.NumDuplicates = Plan.DuplicateJsonFilePaths.Num();
+		Report.NumMissingParents = Plan.MissingParentClassNames.Num();
+
+		for (const FString& CyclicFile : Plan.CyclicJsonFilePaths)
+		{
+			Report.AddError(FString::Printf(TEXT("Inheritance cycle: %s"), *CyclicFile));
+			++Report.Blueprints.Failed;
+		}
+	}
+
+	/**
+	 * A shard's parents from earlier stages were saved by other processes. A parent the asset registry cannot see
+	 * would silently give its children AActor parents, so the shard fails instead of creating them.
+	 * @param EarlierStageClassNames - Blueprint classes of the export tree that are not in this shard's list
+	 */
+	bool CheckEarlierStageParents(const FFModelImportPlan& Plan, const TSet<FString>& EarlierStageClassNames, FImportReport& Report)
+	{
+		bool bAllFound = true;
+		for (const FString& ParentClassName : Plan.MissingParentClassNames)
+		{
+			FString ParentAssetName = ParentClassName;
+			ParentAssetName.RemoveFromEnd(TEXT("_C"));
+			if (EarlierStageClassNames.Contains(ParentClassName) && FModelAssetIndex::FindBlueprintPackage(FName(*ParentAssetName)).IsNone())
+			{
+				Report.AddError(FString::Printf(TEXT("Parent %s was created by an earlier stage but is not in the asset registry"), *ParentClassName));
+				bAllFound = false;
+			}
+		}
+		return bAllFound;
+	}
+
+	/** Phase 2 in this process: Blueprints, parents first */
+	void ImportBlueprints(const FImportArgs& Args, const FFModelImportPlan& Plan, const TArray<FFModelExportSummary>& Summaries, FFModelImportJournal* Journal, FImportReport& Report)
+	{
+		FPhaseCounts& Blueprints = Report.Blueprints;
+		const double StartTime = FPlatformTime::Seconds();
+
+		TMap<FString, const FFModelExportSummary*> SummaryByPath;
+		SummaryByPath.Reserve(Summaries.Num());
+		for (const FFModelExportSummary& Summary : Summaries)
+		{
+			SummaryByPath.Add(Summary.JsonFilePath, &Summary);
+		}
+
+		TArray<FString> JsonFilePaths;
+		TArray<const FFModelExportSummary*> Exports;
+		TArray<FString> DestinationPaths;
+		TArray<FString> AssetNames;
+		for (const FFModelImportPlanEntry& Entry : Plan.Entries)
+		{
+			const FFModelExportSummary& Summary = *SummaryByPath.FindChecked(Entry.JsonFilePath);
+
+			FString PackagePath;
+			FString AssetName;
+			if (!FModelImportPaths::GetDestination(Args.SourceFolder, Entry.JsonFilePath, Args.ContentRoot, PackagePath, AssetName))
+			{
+				Report.AddError(FString::Printf(TEXT("No destination for %s"), *Entry.JsonFilePath));
+				++Blueprints.Failed;
+				continue;
+			}
+
+			// Unused: the pipeline hashes every export it reads
+			uint64 ContentHash;
+			const EExistingAsset Existing = CheckExistingAsset(PackagePath, AssetName, Summary, Journal, Report, ContentHash);
+			if (Existing != EExistingAsset::Create)
+			{
+				++(Existing == EExistingAsset::Done ? Blueprints.Existing : Blueprints.Failed);
+				continue;
+			}
+
+			JsonFilePaths.Add(Entry.JsonFilePath);
+			Exports.Add(&Summary);
+			DestinationPaths.Add(MoveTemp(PackagePath));
+			AssetNames.Add(MoveTemp(AssetName));
+		}
+
+		if (Journal)
+		{
+			// Pre-existing packages and the ones about to be created must be on record before anything is created
+			for (int32 Index = 0; Index < JsonFilePaths.Num(); ++Index)
+			{
+				Journal->Record(FFModelImportJournal::EStatus::Started, DestinationPaths[Index] / AssetNames[Index], {}, JsonFilePaths[Index]);
+			}
+			Journal->Flush();
+		}
+
+		// Fixups up to here are already journaled (reloaded on resume). Later ones are recorded in build order and a
+		// discarded Blueprint's are dropped, so a finished Blueprint's fixups are the ones right after the journaled ones.
+		int32 NumFixupsJournaled = FModelPinFixups::GetNumPending();
+
+		const FFModelPipelineResult Pipeline = UDummyBlueprintFunctionLibrary::ImportBlueprintsPipelined(JsonFilePaths, DestinationPaths, AssetNames, Args.MaxBuffered,
+			[&](int32 Index, UBlueprint* Blueprint, const FString& Error, uint64 ContentHash)
+			{
+				if (Journal)
+				{
+					// The Blueprint's deferred pins go ahead of its Created record, so a resume that skips it still patches them
+					const FString PackageName = DestinationPaths[Index] / AssetNames[Index];
+					const TConstArrayView<FModelPinFixups::FPinFixup> Fixups = FModelPinFixups::GetPending();
+					for (; NumFixupsJournaled < Fixups.Num() && FPackageName::ObjectPathToPackageName(Fixups[NumFixupsJournaled].BlueprintPath) == PackageName; ++NumFixupsJournaled)
+					{
+						Journal->RecordPinFixup(Fixups[NumFixupsJournaled]);
+					}
+
+					const FFModelImportJournal::EStatus Status = Blueprint ? FFModelImportJournal::EStatus::Created : FFModelImportJournal::EStatus::Failed;
+					Journal->Record(Status, PackageName, GetExportVersion(*Exports[Index], ContentHash), JsonFilePaths[Index]);
+				}
+			});
+		Blueprints.Created = Pipeline.NumCreated;
+		for (int32 Index = 0; Index < Pipeline.Errors.Num(); ++Index)
+		{
+			if (!Pipeline.Blueprints[Index])
+			{
+				Report.AddError(FString::Printf(TEXT("%s: %s"), *Pipeline.Errors[Index], *JsonFilePaths[Index]));
+				++Blueprints.Failed;
+			}
+		}
+
+		Report.ReadSeconds = Pipeline.ReadSeconds;
+		Report.ParseSeconds = Pipeline.ParseSeconds;
+		Report.ResolveSeconds = Pipeline.ResolveSeconds;
+		Report.CreateSeconds = Pipeline.CreateSeconds;
+		Report.CreateStallSeconds = Pipeline.CreateStallSeconds;
+		Report.SaveSeconds = Pipeline.SaveSeconds;
+		Report.SaveWaitSeconds = Pipeline.SaveWaitSeconds;
+		Report.PeakBufferedDescriptors = Pipeline.PeakBufferedDescriptors;
+		Report.NumProbedTypes = Pipeline.NumProbedTypes;
+		Report.NumTypeProbes = Pipeline.NumTypeProbes;
+
+		Blueprints.Seconds = FPlatformTime::Seconds() - StartTime;
+		UE_LOG(LogTemp, Display, TEXT("FModelImport: Blueprints %d found, %d created, %d existing, %d failed (%.2fs)"), Blueprints.Found, Blueprints.Created, Blueprints.Existing, Blueprints.Failed, Blueprints.Seconds);
+	}
+
+	/** Phase 2 without side effects: parse every planned export and resolve its types, but create nothing */
+	void DryRunBlueprints(const FImportArgs& Args, const TArray<FFModelExportSummary>& Summaries, FImportReport& Report)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		FFModelDryRunResult DryRun = UDummyBlueprintFunctionLibrary::DryRunFModelBlueprintImport(Summaries, Args.MaxBuffered);
+		RecordPlan(DryRun.Plan, Report);
+
+		for (FString& ParseError : DryRun.ParseErrors)
+		{
+			Report.AddError(MoveTemp(ParseError));
+			++Report.Blueprints.Failed;
+		}
+
+		Report.bDryRun = true;
+		Report.NumFunctions = DryRun.NumFunctions;
+		Report.NumVariables = DryRun.NumVariables;
+		Report.NumTypesResolved = DryRun.NumTypesResolved;
+		Report.NumTypesFromPlan = DryRun.NumTypesFromPlan;
+		Report.ReadSeconds = DryRun.ReadSeconds;
+		Report.ParseSeconds = DryRun.ParseSeconds;
+		Report.ResolveSeconds = DryRun.ResolveSeconds;
+		Report.NumProbedTypes = DryRun.NumProbedTypes;
+		Report.NumTypeProbes = DryRun.NumTypeProbes;
+		Report.UnresolvedTypes = MoveTemp(DryRun.UnresolvedTypes);
+
+		Report.Blueprints.Seconds = FPlatformTime::Seconds() - StartTime;
+		UE_LOG(LogTemp, Display, TEXT("FModelImport: dry run of %d Blueprints, %d unresolved types, %d failed to parse (%.2fs)"),
+			DryRun.Plan.Entries.Num(), Report.UnresolvedTypes.Num(), DryRun.ParseErrors.Num(), Report.Blueprints.Seconds);
+	}
+
+	int32 GetIntField(const FJsonObject& Object, const TCHAR* FieldName)
+	{
+		return static_cast<int32>(Object.GetNumberField(FieldName));
+	}
+
+	/** Report field of each EFModelTypeKind's probe hits */
+	const TCHAR* const ProbeHitFields[] = { TEXT("class"), TEXT("struct"), TEXT("enum") };
+	static_assert(UE_ARRAY_COUNT(ProbeHitFields) == static_cast<int32>(EFModelTypeKind::Num), "One report field per EFModelTypeKind");
+
+	/** Fold a shard's report into the coordinator's */
+	bool MergeShardReport(const FString& ShardReportPath, FImportReport& Report)
+	{
+		FString ReportText;
+		TSharedPtr<FJsonObject> ShardReport;
+		if (!FFileHelper::LoadFileToString(ReportText, *ShardReportPath)
+			|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ReportText), ShardReport)
+			|| !ShardReport.IsValid())
+		{
+			return false;
+		}
+
+		const TSharedPtr<FJsonObject>* BlueprintReport = nullptr;
+		if (ShardReport->TryGetObjectField(TEXT("blueprints"), BlueprintReport))
+		{
+			Report.Blueprints.Created += GetIntField(**BlueprintReport, TEXT("created"));
+			Report.Blueprints.Existing += GetIntField(**BlueprintReport, TEXT("existing"));
+			Report.Blueprints.Failed += GetIntField(**BlueprintReport, TEXT("failed"));
+			Report.ReadSeconds += (*BlueprintReport)->GetNumberField(TEXT("readSeconds"));
+			Report.ParseSeconds += (*BlueprintReport)->GetNumberField(TEXT("parseSeconds"));
+			Report.ResolveSeconds += (*BlueprintReport)->GetNumberField(TEXT("resolveSeconds"));
+			Report.CreateSeconds += (*BlueprintReport)->GetNumberField(TEXT("createSeconds"));
+			Report.CreateStallSeconds += (*BlueprintReport)->GetNumberField(TEXT("createStallSeconds"));
+			Report.SaveSeconds += (*BlueprintReport)->GetNumberField(TEXT("saveSeconds"));
+			Report.SaveWaitSeconds += (*BlueprintReport)->GetNumberField(TEXT("saveWaitSeconds"));
+			Report.PeakBufferedDescriptors = FMath::Max(Report.PeakBufferedDescriptors, GetIntField(**BlueprintReport, TEXT("peakBufferedDescriptors")));
+			Report.NumProbedTypes += GetIntField(**BlueprintReport, TEXT("probedTypes"));
+			Report.NumTypeProbes += GetIntField(**BlueprintReport, TEXT("typeProbes"));
+		}
+
+		const TSharedPtr<FJsonObject>* ProbeHitReport = nullptr;
+		if (ShardReport->TryGetObjectField(TEXT("probeHits"), ProbeHitReport))
+		{
+			// Shards do not save what they learned; the coordinator adds it up and saves once
+			for (int32 KindIndex = 0; KindIndex < UE_ARRAY_COUNT(ProbeHitFields); ++KindIndex)
+			{
+				const TSharedPtr<FJsonObject>* KindHits = nullptr;
+				if ((*ProbeHitReport)->TryGetObjectField(ProbeHitFields[KindIndex], KindHits))
+				{
+					FModelProbeOrder::FHits Hits;
+					Hits.NumContent = static_cast<int64>((*KindHits)->GetNumberField(TEXT("content")));
+					Hits.NumNative = static_cast<int64>((*KindHits)->GetNumberField(TEXT("native")));
+					FModelProbeOrder::AddHits(static_cast<EFModelTypeKind>(KindIndex), Hits);
+				}
+			}
+		}
+
+		const TSharedPtr<FJsonObject>* PinFixupReport = nullptr;
+		if (ShardReport->TryGetObjectField(TEXT("pinFixups"), PinFixupReport))
+		{
+			Report.NumPinsPatched += GetIntField(**PinFixupReport, TEXT("patched"));
+			Report.PinFixupSeconds += (*PinFixupReport)->GetNumberField(TEXT("seconds"));
+
+			const TArray<TSharedPtr<FJsonValue>>* PendingValues = nullptr;
+			if ((*PinFixupReport)->TryGetArrayField(TEXT("pending"), PendingValues))
+			{
+				for (const TSharedPtr<FJsonValue>& PendingValue : *PendingValues)
+				{
+					const TSharedPtr<FJsonObject>& PendingObject = PendingValue->AsObject();
+					if (!PendingObject.IsValid())
+					{
+						continue;
+					}
+
+					FModelPinFixups::FPinFixup Fixup;
+					Fixup.BlueprintPath = PendingObject->GetStringField(TEXT("blueprint"));
+					Fixup.GraphName = FName(*PendingObject->GetStringField(TEXT("graph")));
+					Fixup.PinName = FName(*PendingObject->GetStringField(TEXT("pin")));
+					Fixup.SetTypeString(PendingObject->GetStringField(TEXT("type")));
+					Fixup.NumUnresolved = GetIntField(*PendingObject, TEXT("unresolved"));
+					FModelPinFixups::Add(MoveTemp(Fixup));
+				}
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* ErrorValues = nullptr;
+		if (ShardReport->TryGetArrayField(TEXT("errors"), ErrorValues))
+		{
+			for (const TSharedPtr<FJsonValue>& ErrorValue : *ErrorValues)
+			{
+				if (Report.Errors.Num() < MaxReportedErrors)
+				{
+					Report.Errors.Add(ErrorValue->AsString());
+				}
+			}
+		}
+		Report.NumErrors += GetIntField(*ShardReport, TEXT("errorCount"));
+		return true;
+	}
+
+	/** Phase 2 across processes: one headless editor per shard, stage after stage */
+	void ImportBlueprintsSharded(const FImportArgs& Args, const FFModelImportPlan& Plan, FImportReport& Report)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		const TArray<FModelImportSharding::FStage> Stages = FModelImportSharding::Partition(Plan, Args.NumShards);
+		Report.NumStages = Stages.Num();
+
+		const FString ShardDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("FModelImport"), TEXT("Shards"));
+		IFileManager::Get().MakeDirectory(*ShardDir, true);
+
+		// Shard journals belong to this import's journal (one per export tree and destination) and shard layout
+		const FString ShardJournalPrefix = FString::Printf(TEXT("%s_Shards%d"), *FPaths::GetBaseFilename(Args.JournalPath), Args.NumShards);
+
+		FString JournalParams;
+		if (Args.bNoJournal)
+		{
+			JournalParams = TEXT(" -NoJournal");
+		}
+		else if (Args.bResetJournal)
+		{
+			JournalParams = TEXT(" -ResetJournal");
+		}
+
+		const FString Executable = FPlatformProcess::ExecutablePath();
+		const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+		for (int32 StageIndex = 0; StageIndex < Stages.Num(); ++StageIndex)
+		{
+			const FModelImportSharding::FStage& Stage = Stages[StageIndex];
+			UE_LOG(LogTemp, Display, TEXT("FModelImport: stage %d/%d, %d shards"), StageIndex + 1, Stages.Num(), Stage.Num());
+
+			struct FRunningShard
+			{
+				FShardRun Run;
+				FProcHandle Handle;
+				FString ReportPath;
+				double StartTime = 0.0;
+			};
+			TArray<FRunningShard> Running;
+
+			for (int32 ShardIndex = 0; ShardIndex < Stage.Num(); ++ShardIndex)
+			{
+				const FModelImportSharding::FShard& Shard = Stage[ShardIndex];
+				const FString BaseName = FString::Printf(TEXT("Stage%d_Shard%d"), StageIndex, ShardIndex);
+
+				TArray<FString> FileList;
+				for (int32 EntryIndex : Shard)
+				{
+					FileList.Add(Plan.Entries[EntryIndex].JsonFilePath);
+				}
+				const FString FileListPath = ShardDir / BaseName + TEXT(".txt");
+				FFileHelper::SaveStringArrayToFile(FileList, *FileListPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+				FRunningShard& RunningShard = Running.AddDefaulted_GetRef();
+				RunningShard.Run.Stage = StageIndex;
+				RunningShard.Run.Shard = ShardIndex;
+				RunningShard.Run.NumFiles = Shard.Num();
+				RunningShard.ReportPath = ShardDir / BaseName + TEXT(".json");
+				IFileManager::Get().Delete(*RunningShard.ReportPath, false, false, true);
+
+				// Partitioning is deterministic, so a rerun gives each shard the same files and the same journal
+				const FString ShardJournalPath = ShardDir / ShardJournalPrefix + TEXT("_") + BaseName + TEXT(".journal");
+				if (!Args.bNoJournal)
+				{
+					RunningShard.Run.JournalPath = ShardJournalPath;
+				}
+				const FString ShardParams = FString::Printf(
+					TEXT("\"%s\" -run=FModelImport -Source=\"%s\" -Dest=%s -FileList=\"%s\" -Report=\"%s\" -Journal=\"%s\" -MaxBuffered=%d -SkipStructs%s -unattended -nosplash -nullrhi -stdout"),
+					*ProjectPath, *Args.SourceFolder, *Args.ContentRoot, *FileListPath, *RunningShard.ReportPath, *ShardJournalPath,
+					Args.MaxBuffered, *JournalParams);
+
+				RunningShard.StartTime = FPlatformTime::Seconds();
+				RunningShard.Handle = FPlatformProcess::CreateProc(*Executable, *ShardParams, false, true, true, nullptr, 0, nullptr, nullptr);
+				if (!RunningShard.Handle.IsValid())
+				{
+					Report.AddError(FString::Printf(TEXT("Could not launch %s"), *BaseName));
+				}
+			}
+
+			// Later stages hold children of this stage's Blueprints, so the whole stage must finish first
+			for (FRunningShard& RunningShard : Running)
+			{
+				int32 ReturnCode = -1;
+				if (RunningShard.Handle.IsValid())
+				{
+					FPlatformProcess::WaitForProc(RunningShard.Handle);
+					FPlatformProcess::GetProcReturnCode(RunningShard.Handle, &ReturnCode);
+					FPlatformProcess::CloseProc(RunningShard.Handle);
+				}
+				RunningShard.Run.ExitCode = ReturnCode;
+				RunningShard.Run.Seconds = FPlatformTime::Seconds() - RunningShard.StartTime;
+
+				if (!MergeShardReport(RunningShard.ReportPath, Report))
+				{
+					// Crashed or never started: nothing in the shard is known to exist
+					Report.AddError(FString::Printf(TEXT("Shard %d of stage %d exited with %d and left no report"), RunningShard.Run.Shard, StageIndex, ReturnCode));
+					Report.Blueprints.Failed += RunningShard.Run.NumFiles;
+				}
+				Report.Shards.Add(RunningShard.Run);
+			}
+		}
+
+		Report.Blueprints.Seconds = FPlatformTime::Seconds() - StartTime;
+		UE_LOG(LogTemp, Display, TEXT("FModelImport: Blueprints %d found, %d created, %d existing, %d failed over %d stages (%.2fs)"),
+			Report.Blueprints.Found, Report.Blueprints.Created, Report.Blueprints.Existing, Report.Blueprints.Failed, Report.NumStages, Report.Blueprints.Seconds);
+	}
+
+	/** The sweep is done; only pins it could not patch are loaded again on a later run */
+	void RecordPinFixupsApplied(FFModelImportJournal& Journal, const TArray<FModelPinFixups::FPinFixup>& PendingPinFixups)
+	{
+		Journal.RecordPinFixupsApplied();
+		for (const FModelPinFixups::FPinFixup& Fixup : PendingPinFixups)
+		{
+			Journal.RecordPinFixup(Fixup);
+		}
+	}
+
+	/**
+	 * Patch the pins that named a type created later in the run, now that every asset of the run exists
+	 * @param Journal - Journal of the process that created the Blueprints, if any; keeps the still unresolved pins.
+	 *                  Null in a sharded run, where each shard journal keeps them instead.
+	 */
+	void ApplyPinFixups(const FImportArgs& Args, FFModelImportJournal* Journal, FImportReport& Report)
+	{
+		if (Report.Shards.Num() > 0)
+		{
+			// The shards' Blueprints were saved by other processes: make them visible before resolving again
+			IAssetRegistry::GetChecked().ScanPathsSynchronous({ Args.ContentRoot }, true);
+			FModelAssetIndex::Build();
+			FModelTypeResolver::ResetCache();
+		}
+
+		const FModelPinFixups::FApplyStats Stats = FModelPinFixups::Apply(&Report.PendingPinFixups);
+		Report.NumPinsPatched += Stats.NumPatched;
+		Report.NumPinsUnresolved = Stats.NumUnresolved;
+		Report.PinFixupSeconds += Stats.Seconds;
+		if (Stats.NumBlueprintsNotSaved > 0)
+		{
+			Report.AddError(FString::Printf(TEXT("%d Blueprints with patched pins could not be saved; their pins stay pending"), Stats.NumBlueprintsNotSaved));
+		}
+
+		if (Journal)
+		{
+			RecordPinFixupsApplied(*Journal, Report.PendingPinFixups);
+		}
+
+		// The shards journaled the pins they left for this sweep; a resumed shard only takes back those of its Blueprints
+		for (const FShardRun& Shard : Report.Shards)
+		{
+			FFModelImportJournal ShardJournal;
+			if (!Shard.JournalPath.IsEmpty() && IFileManager::Get().FileExists(*Shard.JournalPath) && ShardJournal.Open(Shard.JournalPath, /*bReset*/ false))
+			{
+				RecordPinFixupsApplied(ShardJournal, Report.PendingPinFixups);
+			}
+		}
+		UE_LOG(LogTemp, Display, TEXT("FModelImport: patched %d pins in %d Blueprints (%d still unresolved) in %.2fs"),
+			Stats.NumPatched, Stats.NumBlueprintsSaved, Stats.NumUnresolved, Stats.Seconds);
+	}
+
+	void WriteReport(const FImportArgs& Args, const FImportReport& Report, double TotalSeconds)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("source"), Args.SourceFolder);
+		Root->SetStringField(TEXT("dest"), Args.ContentRoot);
+		Root->SetNumberField(TEXT("exitCode"), Report.GetExitCode());
+		Root->SetNumberField(TEXT("files"), Report.NumFiles);
+		Root->SetNumberField(TEXT("indexSeconds"), Report.IndexSeconds);
+		Root->SetObjectField(TEXT("structs"), Report.Structs.ToJson());
+
+		TSharedRef<FJsonObject> NativeTypeIndex = MakeShared<FJsonObject>();
+		NativeTypeIndex->SetNumberField(TEXT("classes"), Report.NativeTypeIndex.NumClasses);
+		NativeTypeIndex->SetNumberField(TEXT("structs"), Report.NativeTypeIndex.NumStructs);
+		NativeTypeIndex->SetNumberField(TEXT("enums"), Report.NativeTypeIndex.NumEnums);
+		NativeTypeIndex->SetNumberField(TEXT("ambiguous"), Report.NativeTypeIndex.NumAmbiguous);
+		NativeTypeIndex->SetNumberField(TEXT("seconds"), Report.NativeTypeIndex.Seconds);
+		Root->SetObjectField(TEXT("nativeTypeIndex"), NativeTypeIndex);
+
+		TSharedRef<FJsonObject> AssetIndex = MakeShared<FJsonObject>();
+		AssetIndex->SetNumberField(TEXT("blueprints"), Report.AssetIndex.NumBlueprints);
+		AssetIndex->SetNumberField(TEXT("structs"), Report.AssetIndex.NumStructs);
+		AssetIndex->SetNumberField(TEXT("ambiguous"), Report.AssetIndex.NumAmbiguous);
+		AssetIndex->SetNumberField(TEXT("seconds"), Report.AssetIndex.Seconds);
+		Root->SetObjectField(TEXT("assetIndex"), AssetIndex);
+
+		TSharedRef<FJsonObject> Blueprints = Report.Blueprints.ToJson();
+		Blueprints->SetNumberField(TEXT("depths"), Report.NumDepths);
+		Blueprints->SetNumberField(TEXT("cyclic"), Report.NumCyclic);
+		Blueprints->SetNumberField(TEXT("duplicates"), Report.NumDuplicates);
+		Blueprints->SetNumberField(TEXT("missingParents"), Report.NumMissingParents);
+		Blueprints->SetNumberField(TEXT("readSeconds"), Report.ReadSeconds);
+		Blueprints->SetNumberField(TEXT("parseSeconds"), Report.ParseSeconds);
+		Blueprints->SetNumberField(TEXT("resolveSeconds"), Report.ResolveSeconds);
+		Blueprints->SetNumberField(TEXT("createSeconds"), Report.CreateSeconds);
+		Blueprints->SetNumberField(TEXT("createStallSeconds"), Report.CreateStallSeconds);
+		Blueprints->SetNumberField(TEXT("saveSeconds"), Report.SaveSeconds);
+		Blueprints->SetNumberField(TEXT("saveWaitSeconds"), Report.SaveWaitSeconds);
+		Blueprints->SetNumberField(TEXT("peakBufferedDescriptors"), Report.PeakBufferedDescriptors);
+		Blueprints->SetNumberField(TEXT("probedTypes"), Report.NumProbedTypes);
+		Blueprints->SetNumberField(TEXT("typeProbes"), Report.NumTypeProbes);
+		Blueprints->SetNumberField(TEXT("averageProbesPerResolvedType"), Report.NumProbedTypes > 0 ? double(Report.NumTypeProbes) / Report.NumProbedTypes : 0.0);
+		Root->SetObjectField(TEXT("blueprints"), Blueprints);
+
+		if (!Report.bDryRun)
+		{
+			TSharedRef<FJsonObject> PinFixups = MakeShared<FJsonObject>();
+			PinFixups->SetNumberField(TEXT("patched"), Report.NumPinsPatched);
+			PinFixups->SetNumberField(TEXT("unresolved"), Report.NumPinsUnresolved);
+			PinFixups->SetNumberField(TEXT("seconds"), Report.PinFixupSeconds);
+
+			TArray<TSharedPtr<FJsonValue>> PendingValues;
+			for (const FModelPinFixups::FPinFixup& Fixup : Report.PendingPinFixups)
+			{
+				TSharedRef<FJsonObject> FixupObject = MakeShared<FJsonObject>();
+				FixupObject->SetStringField(TEXT("blueprint"), Fixup.BlueprintPath);
+				FixupObject->SetStringField(TEXT("graph"), Fixup.GraphName.IsNone() ? FString() : Fixup.GraphName.ToString());
+				FixupObject->SetStringField(TEXT("pin"), Fixup.PinName.ToString());
+				FixupObject->SetStringField(TEXT("type"), Fixup.GetTypeString());
+				FixupObject->SetNumberField(TEXT("unresolved"), Fixup.NumUnresolved);
+				PendingValues.Add(MakeShared<FJsonValueObject>(FixupObject));
+			}
+			PinFixups->SetArrayField(TEXT("pending"), PendingValues);
+			Root->SetObjectField(TEXT("pinFixups"), PinFixups);
+		}
+
+		if (Report.bDryRun)
+		{
+			TSharedRef<FJsonObject> DryRun = MakeShared<FJsonObject>();
+			DryRun->SetNumberField(TEXT("functions"), Report.NumFunctions);
+			DryRun->SetNumberField(TEXT("variables"), Report.NumVariables);
+			DryRun->SetNumberField(TEXT("typesResolved"), Report.NumTypesResolved);
+			DryRun->SetNumberField(TEXT("typesFromPlan"), Report.NumTypesFromPlan);
+
+			TArray<TSharedPtr<FJsonValue>> UnresolvedValues;
+			for (const FFModelUnresolvedType& Type : Report.UnresolvedTypes)
+			{
+				TSharedRef<FJsonObject> TypeObject = MakeShared<FJsonObject>();
+				TypeObject->SetStringField(TEXT("kind"), Type.Kind);
+				TypeObject->SetStringField(TEXT("name"), Type.Name);
+				TypeObject->SetStringField(TEXT("path"), Type.Path);
+				TypeObject->SetNumberField(TEXT("references"), Type.NumReferences);
+				TypeObject->SetStringField(TEXT("firstFile"), Type.FirstJsonFilePath);
+				UnresolvedValues.Add(MakeShared<FJsonValueObject>(TypeObject));
+			}
+			DryRun->SetArrayField(TEXT("unresolvedTypes"), UnresolvedValues);
+			Root->SetObjectField(TEXT("dryRun"), DryRun);
+		}
+
+		TSharedRef<FJsonObject> ProbeHits = MakeShared<FJsonObject>();
+		for (int32 KindIndex = 0; KindIndex < UE_ARRAY_COUNT(ProbeHitFields); ++KindIndex)
+		{
+			const FModelProbeOrder::FHits Hits = FModelProbeOrder::GetSessionHits(static_cast<EFModelTypeKind>(KindIndex));
+			TSharedRef<FJsonObject> KindHits = MakeShared<FJsonObject>();
+			KindHits->SetNumberField(TEXT("content"), static_cast<double>(Hits.NumContent));
+			KindHits->SetNumberField(TEXT("native"), static_cast<double>(Hits.NumNative));
+			ProbeHits->SetObjectField(ProbeHitFields[KindIndex], KindHits);
+		}
+		Root->SetObjectField(TEXT("probeHits"), ProbeHits);
+
+		if (Report.Shards.Num() > 0)
+		{
+			Root->SetNumberField(TEXT("stages"), Report.NumStages);
+
+			TArray<TSharedPtr<FJsonValue>> ShardValues;
+			for (const FShardRun& Shard : Report.Shards)
+			{
+				TSharedRef<FJsonObject> ShardObject = MakeShared<FJsonObject>();
+				ShardObject->SetNumberField(TEXT("stage"), Shard.Stage);
+				ShardObject->SetNumberField(TEXT("shard"), Shard.Shard);
+				ShardObject->SetNumberField(TEXT("files"), Shard.NumFiles);
+				ShardObject->SetNumberField(TEXT("exitCode"), Shard.ExitCode);
+				ShardObject->SetNumberField(TEXT("seconds"), Shard.Seconds);
+				ShardValues.Add(MakeShared<FJsonValueObject>(ShardObject));
+			}
+			Root->SetArrayField(TEXT("shards"), ShardValues);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ErrorValues;
+		for (const FString& Error : Report.Errors)
+		{
+			ErrorValues.Add(MakeShared<FJsonValueString>(Error));
+		}
+		Root->SetNumberField(TEXT("errorCount"), Report.NumErrors);
+		Root->SetArrayField(TEXT("errors"), ErrorValues);
+		Root->SetNumberField(TEXT("totalSeconds"), TotalSeconds);
+
+		FString ReportText;
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportText);
+		FJsonSerializer::Serialize(Root, Writer);
+		if (!FFileHelper::SaveStringToFile(ReportText, *Args.ReportPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FModelImport: could not write report to %s"), *Args.ReportPath);
+		}
+	}
+}
+
+UFModelImportCommandlet::UFModelImportCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	HelpDescription = TEXT("Import an FModel JSON export tree as UserDefinedStructs and Blueprint dummies");
+	HelpUsage = TEXT("-run=FModelImport -Source=<export folder> [-Dest=/Game] [-Report=<file.json>] [-MaxBuffered=64] [-Shards=1] [-SkipStructs] [-Journal=<file>] [-ResetJournal] [-NoJournal] [-DryRun]");
+}
+
+int32 UFModelImportCommandlet::Main(const FString& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FImportArgs Args;
+	if (!FParse::Value(*Params, TEXT("Source="), Args.SourceFolder) || !FPaths::DirectoryExists(Args.SourceFolder))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FModelImport: -Source=<export folder> is missing or does not exist. Usage: %s"), *HelpUsage);
+		return 2;
+	}
+	Args.SourceFolder = FPaths::ConvertRelativePathToFull(Args.SourceFolder);
+
+	FParse::Value(*Params, TEXT("Dest="), Args.ContentRoot);
+	FPaths::NormalizeDirectoryName(Args.ContentRoot);
+	if (!FPackageName::IsValidLongPackageName(Args.ContentRoot))
+	{
+		UE_LOG(LogTemp, Error, TEXT("FModelImport: -Dest=%s is not a valid long package path (e.g., /Game)"), *Args.ContentRoot);
+		return 2;
+	}
+
+	Args.ReportPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("FModelImport"), TEXT("ImportReport.json"));
+	FParse::Value(*Params, TEXT("Report="), Args.ReportPath);
+	FParse::Value(*Params, TEXT("FileList="), Args.FileListPath);
+	FParse::Value(*Params, TEXT("MaxBuffered="), Args.MaxBuffered);
+	FParse::Value(*Params, TEXT("Shards="), Args.NumShards);
+	Args.bSkipStructs = FParse::Param(*Params, TEXT("SkipStructs"));
+	Args.bNoJournal = FParse::Param(*Params, TEXT("NoJournal"));
+	Args.bResetJournal = FParse::Param(*Params, TEXT("ResetJournal"));
+	Args.bDryRun = FParse::Param(*Params, TEXT("DryRun"));
+
+	// One journal per export tree and destination
+	Args.JournalPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("FModelImport"),
+		FString::Printf(TEXT("Journal_%08x.log"), GetTypeHash(Args.SourceFolder.ToLower() + TEXT("|") + Args.ContentRoot)));
+	FParse::Value(*Params, TEXT("Journal="), Args.JournalPath);
+
+	FFModelImportJournal JournalStorage;
+	FFModelImportJournal* Journal = nullptr;
+	if (!Args.bNoJournal && !Args.bDryRun)
+	{
+		if (!JournalStorage.Open(Args.JournalPath, Args.bResetJournal))
+		{
+			return 2;
+		}
+		Journal = &JournalStorage;
+		if (Journal->IsResuming())
+		{
+			// Pins deferred by the interrupted run, whose Blueprints are skipped below
+			TArray<FModelPinFixups::FPinFixup> Fixups = Journal->TakePinFixups();
+			UE_LOG(LogTemp, Display, TEXT("FModelImport: resuming from %s (%d assets already done, %d deferred pins)"), *Args.JournalPath, Journal->GetNumDone(), Fixups.Num());
+			for (FModelPinFixups::FPinFixup& Fixup : Fixups)
+			{
+				FModelPinFixups::Add(MoveTemp(Fixup));
+			}
+		}
+	}
+
+	if (!Args.FileListPath.IsEmpty())
+	{
+		// A shard: its coordinator merges the probe hits from the report and saves them once
+		FModelProbeOrder::SetSaveEnabled(false);
+	}
+
+	FImportReport Report;
+
+	// Index the tree (only new or changed files are read)
+	double PhaseStart = FPlatformTime::Seconds();
+	FModelExportIndex::FRefreshStats IndexStats;
+	TArray<FFModelExportSummary> Summaries = FModelExportIndex::Refresh(Args.SourceFolder, &IndexStats);
+	Report.NumFiles = IndexStats.NumFiles;
+	Report.IndexSeconds = FPlatformTime::Seconds() - PhaseStart;
+	UE_LOG(LogTemp, Display, TEXT("FModelImport: indexed %d files in %.2fs (%d reclassified)"), IndexStats.NumFiles, Report.IndexSeconds, IndexStats.NumReclassified);
+
+	if (!Args.bSkipStructs && !Args.bDryRun)
+	{
+		ImportStructs(Args, Summaries, Journal, Report);
+	}
+
+	TSet<FString> EarlierStageClassNames;
+	if (!Args.FileListPath.IsEmpty())
+	{
+		// A shard of a coordinated import: parents outside the list were created by earlier stages
+		TArray<FString> FileList;
+		if (!FFileHelper::LoadFileToStringArray(FileList, *Args.FileListPath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("FModelImport: could not read -FileList=%s"), *Args.FileListPath);
+			return 2;
+		}
+
+		const TSet<FString> Listed(FileList);
+		for (const FFModelExportSummary& Summary : Summaries)
+		{
+			if (Summary.bHasBlueprintClass && !Listed.Contains(Summary.JsonFilePath))
+			{
+				EarlierStageClassNames.Add(Summary.BlueprintClassName);
+			}
+		}
+		Summaries.RemoveAll([&Listed](const FFModelExportSummary& Summary) { return !Listed.Contains(Summary.JsonFilePath); });
+
+		// Those parents and the structs were saved by other processes after this one started
+		IAssetRegistry::GetChecked().ScanPathsSynchronous({ Args.ContentRoot }, true);
+	}
+
+	// Every type reference of the Blueprint phase is looked up by name in these indexes; the structs
+	// created above are already in the asset registry
+	Report.NativeTypeIndex = FModelNativeTypeIndex::Build();
+	Report.AssetIndex = FModelAssetIndex::Build();
+
+	if (Args.bDryRun)
+	{
+		// Planning and resolution only, in this process; there is nothing to shard
+		DryRunBlueprints(Args, Summaries, Report);
+	}
+	else
+	{
+		const FFModelImportPlan Plan = UDummyBlueprintFunctionLibrary::PlanFModelBlueprintImport(Summaries);
+		RecordPlan(Plan, Report);
+
+		if (Args.NumShards > 1 && Args.FileListPath.IsEmpty())
+		{
+			// Each shard journals the pins of the Blueprints it created
+			ImportBlueprintsSharded(Args, Plan, Report);
+			FModelProbeOrder::Save();
+			ApplyPinFixups(Args, nullptr, Report);
+		}
+		else if (!CheckEarlierStageParents(Plan, EarlierStageClassNames, Report))
+		{
+			Report.Blueprints.Failed += Plan.Entries.Num();
+		}
+		else
+		{
+			ImportBlueprints(Args, Plan, Summaries, Journal, Report);
+			ApplyPinFixups(Args, Journal, Report);
+		}
+	}
+
+	if (Journal)
+	{
+		Journal->Flush();
+	}
+
+	const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	WriteReport(Args, Report, TotalSeconds);
+
+	UE_LOG(LogTemp, Display, TEXT("FModelImport: done in %.2fs, exit code %d, report: %s"), TotalSeconds, Report.GetExitCode(), *Args.ReportPath);
+	return Report.GetExitCode();
+}
@@ -0,0 +1,221 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportJournal.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** Sync after this many records or this many seconds, whichever comes first */
+	constexpr int32 FlushRecords = 64;
+	constexpr double FlushSeconds = 2.0;
+
+	TCHAR StatusChar(FFModelImportJournal::EStatus Status)
+	{
+		switch (Status)
+		{
+		case FFModelImportJournal::EStatus::Created: return TEXT('C');
+		case FFModelImportJournal::EStatus::Existing: return TEXT('E');
+		case FFModelImportJournal::EStatus::Started: return TEXT('S');
+		default: return TEXT('F');
+		}
+	}
+
+	/** Status characters of the lines that are not package records */
+	constexpr TCHAR PinFixupChar = TEXT('P');
+	constexpr TCHAR PinFixupsAppliedChar = TEXT('A');
+
+	FString GetBlueprintPackage(const FModelPinFixups::FPinFixup& Fixup)
+	{
+		return FPackageName::ObjectPathToPackageName(Fixup.BlueprintPath);
+	}
+
+	bool ParseStatus(TCHAR Char, FFModelImportJournal::EStatus& OutStatus)
+	{
+		switch (Char)
+		{
+		case TEXT('C'): OutStatus = FFModelImportJournal::EStatus::Created; return true;
+		case TEXT('E'): OutStatus = FFModelImportJournal::EStatus::Existing; return true;
+		case TEXT('F'): OutStatus = FFModelImportJournal::EStatus::Failed; return true;
+		case TEXT('S'): OutStatus = FFModelImportJournal::EStatus::Started; return true;
+		default: return false;
+		}
+	}
+}
+
+FFModelImportJournal::~FFModelImportJournal()
+{
+	Flush();
+}
+
+bool FFModelImportJournal::Open(const FString& Path, bool bReset)
+{
+	RecordByPackage.Reset();
+	PinFixupsByPackage.Reset();
+	bResuming = false;
+
+	FString Text;
+	if (!bReset && FFileHelper::LoadFileToString(Text, *Path, FFileHelper::EHashOptions::None, FILEREAD_Silent))
+	{
+		TArray<FString> Lines;
+		Text.ParseIntoArray(Lines, TEXT("\n"), false);
+
+		// The last piece is empty if the file ends with a newline, otherwise a torn record: drop it either way
+		if (Lines.Num() > 0)
+		{
+			Lines.Pop();
+		}
+
+		for (const FString& Line : Lines)
+		{
+			// <status>\t<hash>\t<size>\t<modification ticks>\t<package>\t<json path>; later records of a package override earlier ones
+			TArray<FString> Fields;
+			const int32 NumFields = Line.ParseIntoArray(Fields, TEXT("\t"), false);
+			if (NumFields == 0 || Fields[0].Len() != 1)
+			{
+				continue;
+			}
+
+			EStatus Status;
+			if (NumFields == 6 && ParseStatus(Fields[0][0], Status))
+			{
+				FExportVersion Export;
+				Export.ContentHash = FParse::HexNumber64(*Fields[1]);
+				LexFromString(Export.FileSize, *Fields[2]);
+				LexFromString(Export.ModificationTicks, *Fields[3]);
+				RecordByPackage.Add(Fields[4], FRecord{ Status, Export });
+				if (Status == EStatus::Started)
+				{
+					// Rebuilt from here on, which records its pins again
+					PinFixupsByPackage.Remove(Fields[4]);
+				}
+			}
+			else if (NumFields == 6 && Fields[0][0] == PinFixupChar)
+			{
+				// P\t<blueprint>\t<graph>\t<pin>\t<unresolved>\t<type>
+				FModelPinFixups::FPinFixup Fixup;
+				Fixup.BlueprintPath = Fields[1];
+				Fixup.GraphName = FName(*Fields[2]);
+				Fixup.PinName = FName(*Fields[3]);
+				Fixup.NumUnresolved = FCString::Atoi(*Fields[4]);
+				Fixup.SetTypeString(Fields[5]);
+				PinFixupsByPackage.FindOrAdd(GetBlueprintPackage(Fixup)).Add(MoveTemp(Fixup));
+			}
+			else if (NumFields == 1 && Fields[0][0] == PinFixupsAppliedChar)
+			{
+				PinFixupsByPackage.Reset();
+			}
+		}
+		bResuming = RecordByPackage.Num() > 0;
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+	Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path, /*bAppend*/ !bReset, /*bAllowRead*/ false));
+	if (!Handle)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not open import journal: %s"), *Path);
+		return false;
+	}
+
+	// A crash may have left a torn line; start on a fresh one so the next record is not glued to it
+	if (Handle->Size() > 0 && !Text.IsEmpty() && !Text.EndsWith(TEXT("\n")))
+	{
+		PendingText.Add('\n');
+	}
+
+	LastFlushTime = FPlatformTime::Seconds();
+	return true;
+}
+
+bool FFModelImportJournal::FindRecord(const FString& PackageName, EStatus& OutStatus, FExportVersion& OutExport) const
+{
+	const FRecord* Record = RecordByPackage.Find(PackageName);
+	if (!Record)
+	{
+		return false;
+	}
+	OutStatus = Record->Status;
+	OutExport = Record->Export;
+	return true;
+}
+
+int32 FFModelImportJournal::GetNumDone() const
+{
+	int32 NumDone = 0;
+	for (const TPair<FString, FRecord>& Pair : RecordByPackage)
+	{
+		NumDone += (Pair.Value.Status == EStatus::Created || Pair.Value.Status == EStatus::Existing) ? 1 : 0;
+	}
+	return NumDone;
+}
+
+bool FFModelImportJournal::WasInterrupted(const FString& PackageName) const
+{
+	const FRecord* Record = RecordByPackage.Find(PackageName);
+	// A failed creation may have written part of the package too
+	return Record && (Record->Status == EStatus::Started || Record->Status == EStatus::Failed);
+}
+
+void FFModelImportJournal::Record(EStatus Status, const FString& PackageName, const FExportVersion& Export, const FString& JsonFilePath)
+{
+	RecordByPackage.Add(PackageName, FRecord{ Status, Export });
+
+	AppendLine(FString::Printf(TEXT("%c\t%016llx\t%lld\t%lld\t%s\t%s\n"), StatusChar(Status), Export.ContentHash,
+		Export.FileSize, Export.ModificationTicks, *PackageName, *JsonFilePath));
+}
+
+void FFModelImportJournal::AppendLine(const FString& Line)
+{
+	const FTCHARToUTF8 Utf8(*Line);
+	PendingText.Append(Utf8.Get(), Utf8.Length());
+	++NumPending;
+
+	if (NumPending >= FlushRecords || FPlatformTime::Seconds() - LastFlushTime >= FlushSeconds)
+	{
+		Flush();
+	}
+}
+
+void FFModelImportJournal::RecordPinFixup(const FModelPinFixups::FPinFixup& Fixup)
+{
+	// A member variable has no graph: the field stays empty
+	const FString GraphName = Fixup.GraphName.IsNone() ? FString() : Fixup.GraphName.ToString();
+	AppendLine(FString::Printf(TEXT("%c\t%s\t%s\t%s\t%d\t%s\n"), PinFixupChar, *Fixup.BlueprintPath,
+		*GraphName, *Fixup.PinName.ToString(), Fixup.NumUnresolved, *Fixup.GetTypeString()));
+}
+
+void FFModelImportJournal::RecordPinFixupsApplied()
+{
+	AppendLine(FString::Printf(TEXT("%c\n"), PinFixupsAppliedChar));
+}
+
+TArray<FModelPinFixups::FPinFixup> FFModelImportJournal::TakePinFixups()
+{
+	TArray<FModelPinFixups::FPinFixup> Fixups;
+	for (TPair<FString, TArray<FModelPinFixups::FPinFixup>>& Pair : PinFixupsByPackage)
+	{
+		const FRecord* Record = RecordByPackage.Find(Pair.Key);
+		if (Record && Record->Status == EStatus::Created)
+		{
+			Fixups.Append(MoveTemp(Pair.Value));
+		}
+	}
+	PinFixupsByPackage.Reset();
+	return Fixups;
+}
+
+void FFModelImportJournal::Flush()
+{
+	if (Handle && PendingText.Num() > 0)
+	{
+		Handle->Write(reinterpret_cast<const uint8*>(PendingText.GetData()), PendingText.Num());
+		Handle->Flush(/*bFullFlush*/ true);
+	}
+	PendingText.Reset();
+	NumPending = 0;
+	LastFlushTime = FPlatformTime::Seconds();
+}
@@ -0,0 +1,109 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelPinFixups.h"
+
+class IFileHandle;
+
+/**
+ * Append-only record of the assets an import has started and finished, so a crashed or killed run can resume.
+ * One UTF-8 line per asset: status, xxHash64, size and modification time of the export, output package, export
+ * path. Lines are buffered and synced to disk in batches; a torn last line from a crash is ignored on load.
+ *
+ * Packages are recorded as Started, and synced, before they are created. On resume only a package that was
+ * started and never finished can be half-written; one the journal never started is left alone, whatever run
+ * the journal came from. A Created package only counts as done while its export still has the recorded hash;
+ * an export with the recorded size and modification time is taken to be unchanged without reading it.
+ *
+ * Pins deferred to FModelPinFixups are journaled too, ahead of their Blueprint's Created record, so a run
+ * killed before its fixup sweep still patches them on resume.
+ */
+class FFModelImportJournal
+{
+public:
+	enum class EStatus : uint8
+	{
+		/** Created by this import */
+		Created,
+		/** Already existed when the journal was started */
+		Existing,
+		Failed,
+		/** About to be created by this import; it did not exist before. Sync with Flush before creating it */
+		Started,
+	};
+
+	/** The export a record was made from; all zero for Started and Existing records */
+	struct FExportVersion
+	{
+		/** xxHash64 of the export; 0 if it was not read */
+		uint64 ContentHash = 0;
+		/** Size and modification time the export index found for it */
+		int64 FileSize = 0;
+		int64 ModificationTicks = 0;
+	};
+
+	~FFModelImportJournal();
+
+	/**
+	 * Load the journal at Path (if any) and open it for appending.
+	 * @param bReset - Discard earlier records and start over
+	 * @return False if the journal cannot be written
+	 */
+	bool Open(const FString& Path, bool bReset);
+
+	/** True if Open found records of an earlier run */
+	bool IsResuming() const { return bResuming; }
+
+	/**
+	 * O(1): the last status a journaled run recorded for the package, and the export it recorded
+	 * @return False if the journal has no record of the package
+	 */
+	bool FindRecord(const FString& PackageName, EStatus& OutStatus, FExportVersion& OutExport) const;
+
+	/** Number of packages recorded as Created or Existing, whether or not their exports changed since */
+	int32 GetNumDone() const;
+
+	/** True if a journaled run started the package and never finished it, or failed it: it may be half-written */
+	bool WasInterrupted(const FString& PackageName) const;
+
+	void Record(EStatus Status, const FString& PackageName, const FExportVersion& Export, const FString& JsonFilePath);
+
+	/** Record a deferred pin; record it before its Blueprint's Created record */
+	void RecordPinFixup(const FModelPinFixups::FPinFixup& Fixup);
+
+	/** Record that the fixup sweep ran: fixups recorded before it are not loaded again */
+	void RecordPinFixupsApplied();
+
+	/**
+	 * Deferred pins Open loaded whose Blueprint was recorded as Created and whose sweep never ran.
+	 * Those of Blueprints that are rebuilt on resume are dropped; rebuilding records them again.
+	 */
+	TArray<FModelPinFixups::FPinFixup> TakePinFixups();
+
+	/** Write buffered records and sync them to disk */
+	void Flush();
+
+private:
+	/** Buffer one newline-terminated record, syncing when the batch is full */
+	void AppendLine(const FString& Line);
+
+	struct FRecord
+	{
+		EStatus Status;
+		FExportVersion Export;
+	};
+
+	TUniquePtr<IFileHandle> Handle;
+	TMap<FString, FRecord> RecordByPackage;
+	bool bResuming = false;
+
+	/** Loaded deferred pins, by the package of their Blueprint */
+	TMap<FString, TArray<FModelPinFixups::FPinFixup>> PinFixupsByPackage;
+
+	/** Records not yet synced */
+	TArray<ANSICHAR> PendingText;
+	int32 NumPending = 0;
+	double LastFlushTime = 0.0;
+};
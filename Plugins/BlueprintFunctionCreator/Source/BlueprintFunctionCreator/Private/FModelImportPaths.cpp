@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportPaths.h"
+#include "Misc/Paths.h"
+
+bool FModelImportPaths::GetDestination(const FString& RootFolder, const FString& JsonFilePath, const FString& ContentRoot, FString& OutPackagePath, FString& OutAssetName)
+{
+	FString RelativePath = FPaths::ConvertRelativePathToFull(JsonFilePath);
+	if (!FPaths::MakePathRelativeTo(RelativePath, *(FPaths::ConvertRelativePathToFull(RootFolder) / TEXT(""))) || RelativePath.StartsWith(TEXT("..")))
+	{
+		return false;
+	}
+
+	TArray<FString> Parts;
+	RelativePath.ParseIntoArray(Parts, TEXT("/"));
+	if (Parts.Num() == 0)
+	{
+		return false;
+	}
+
+	OutAssetName = FPaths::GetBaseFilename(Parts.Pop());
+
+	if (Parts.Num() >= 1 && Parts[0] == TEXT("Game"))
+	{
+		// Game/Pal/Blueprint -> /Game/Pal/Blueprint
+		Parts.RemoveAt(0);
+	}
+	else if (Parts.Num() >= 3 && Parts[0] == TEXT("Pal") && Parts[1] == TEXT("Content") && Parts[2] == TEXT("Pal"))
+	{
+		// Pal/Content/Pal/Blueprint -> /Game/Pal/Blueprint
+		Parts.RemoveAt(1, 2);
+	}
+	else if (Parts.Num() >= 2 && Parts[0] == TEXT("Content") && Parts[1] == TEXT("Pal"))
+	{
+		// Content/Pal/Blueprint -> /Game/Pal/Blueprint
+		Parts.RemoveAt(0);
+	}
+	else
+	{
+		// Blueprint/Weapon -> /Game/Pal/Blueprint/Weapon
+		Parts.Insert(TEXT("Pal"), 0);
+	}
+
+	OutPackagePath = ContentRoot;
+	for (const FString& Part : Parts)
+	{
+		OutPackagePath /= Part;
+	}
+	return true;
+}
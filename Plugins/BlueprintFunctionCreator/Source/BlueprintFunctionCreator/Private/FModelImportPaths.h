@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Maps an export's location in the FModel tree to where its asset is created, with the same rules
+ * as the Python driver's get_destination_path (Game/..., Pal/Content/Pal/..., Content/Pal/..., else Pal/...)
+ */
+namespace FModelImportPaths
+{
+	/**
+	 * @param RootFolder - Root of the FModel export tree
+	 * @param JsonFilePath - Export under RootFolder
+	 * @param ContentRoot - Long package root replacing "/Game" (e.g., "/Game" or "/Game/Imported")
+	 * @param OutPackagePath - Folder to create the asset in (e.g., "/Game/Pal/Blueprint/Weapon")
+	 * @param OutAssetName - File name without extension
+	 * @return False if JsonFilePath is not under RootFolder
+	 */
+	bool GetDestination(const FString& RootFolder, const FString& JsonFilePath, const FString& ContentRoot, FString& OutPackagePath, FString& OutAssetName);
+}
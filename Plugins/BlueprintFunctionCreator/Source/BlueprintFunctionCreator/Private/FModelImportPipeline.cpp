@@ -0,0 +1,391 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportPipeline.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include <atomic>
+
+namespace
+{
+	/** Parsing recurses once per JSON nesting level, so workers get more than the engine pool's default stack */
+	constexpr uint32 WorkerStackSize = 256 * 1024;
+
+	/** Opened files queued per parse worker */
+	constexpr int32 ReadAheadPerWorker = 2;
+
+	using FItemPtr = TUniquePtr<FModelImportPipeline::FItem>;
+
+	/**
+	 * Hand-offs between the read thread, the parse workers and the calling thread, under one lock. Opened items wait
+	 * in one bounded queue that every worker takes from, so a large file only holds up the worker parsing it. Each
+	 * parsed item goes to its slot in a reorder buffer, from which the calling thread takes items in input order.
+	 * Events stay signaled until a waiter wakes, so a trigger that races a check is not lost; the workers share one,
+	 * so a worker that leaves takeable work behind passes the wake-up on.
+	 */
+	class FHandOffs
+	{
+	public:
+		FHandOffs(int32 InNumItems, int32 MaxOpened, int32 MaxBuffered)
+			: NumItems(InNumItems)
+		{
+			Opened.SetNum(MaxOpened);
+			Parsed.SetNum(MaxBuffered);
+		}
+
+		/** Read thread: queue the next item, waiting while the queue is full */
+		void PushOpened(FItemPtr&& Item)
+		{
+			for (;;)
+			{
+				{
+					FScopeLock ScopeLock(&Lock);
+					if (NumOpened < Opened.Num())
+					{
+						Opened[(OpenedHead + NumOpened) % Opened.Num()] = MoveTemp(Item);
+						++NumOpened;
+						break;
+					}
+				}
+				ReaderWake->Wait();
+			}
+			WorkerWake->Trigger();
+		}
+
+		/**
+		 * Parse worker: take the oldest opened item, waiting until there is one and the reorder buffer has a slot for it
+		 * @return False once every item was taken
+		 */
+		bool PopOpened(int32& OutIndex, FItemPtr& OutItem)
+		{
+			for (;;)
+			{
+				bool bTaken = false;
+				bool bDone = false;
+				bool bWakeWorker = false;
+				{
+					FScopeLock ScopeLock(&Lock);
+					if (CanTakeOpened())
+					{
+						OutIndex = NextToParse++;
+						OutItem = MoveTemp(Opened[OpenedHead]);
+						OpenedHead = (OpenedHead + 1) % Opened.Num();
+						--NumOpened;
+						bTaken = true;
+					}
+					bDone = NextToParse == NumItems;
+					bWakeWorker = bDone || CanTakeOpened();
+				}
+
+				if (bTaken)
+				{
+					ReaderWake->Trigger();
+				}
+				if (bWakeWorker)
+				{
+					WorkerWake->Trigger();
+				}
+				if (bTaken || bDone)
+				{
+					return bTaken;
+				}
+				WorkerWake->Wait();
+			}
+		}
+
+		/** Parse worker: hand a parsed item to the calling thread */
+		void PushParsed(int32 Index, FItemPtr&& Item)
+		{
+			{
+				FScopeLock ScopeLock(&Lock);
+				Parsed[Index % Parsed.Num()] = MoveTemp(Item);
+			}
+			CallerWake->Trigger();
+		}
+
+		/** Calling thread: take item Index once it is parsed, or null if bWait is false and it is not parsed yet */
+		FItemPtr PopParsed(int32 Index, bool bWait)
+		{
+			for (;;)
+			{
+				{
+					FScopeLock ScopeLock(&Lock);
+					FItemPtr& Slot = Parsed[Index % Parsed.Num()];
+					if (Slot || !bWait)
+					{
+						return MoveTemp(Slot);
+					}
+				}
+				CallerWake->Wait();
+			}
+		}
+
+		/** Calling thread: the oldest item is built, so its slot in the reorder buffer can go to a later one */
+		void ReleaseBuilt()
+		{
+			{
+				FScopeLock ScopeLock(&Lock);
+				++NumBuilt;
+			}
+			WorkerWake->Trigger();
+		}
+
+	private:
+		/** Items NumBuilt .. NumBuilt + Parsed.Num() - 1 are the only ones taken and not built, so their slots differ */
+		bool CanTakeOpened() const
+		{
+			return NumOpened > 0 && NextToParse < NumBuilt + Parsed.Num();
+		}
+
+		const int32 NumItems;
+
+		FCriticalSection Lock;
+
+		/** Ring of opened items NextToParse .. NextToParse + NumOpened - 1, oldest at OpenedHead */
+		TArray<FItemPtr> Opened;
+		int32 OpenedHead = 0;
+		int32 NumOpened = 0;
+		int32 NextToParse = 0;
+
+		/** Reorder buffer: item I, once parsed, waits in slot I % Parsed.Num() */
+		TArray<FItemPtr> Parsed;
+		int32 NumBuilt = 0;
+
+		FEventRef ReaderWake{ EEventMode::AutoReset };
+		FEventRef WorkerWake{ EEventMode::AutoReset };
+		FEventRef CallerWake{ EEventMode::AutoReset };
+	};
+}
+
+FModelImportPipeline::FStats FModelImportPipeline::Run(int32 NumItems, const FOptions& Options, const FStages& Stages)
+{
+	FStats Stats;
+	if (NumItems <= 0)
+	{
+		return Stats;
+	}
+
+	const int32 MaxBuffered = FMath::Clamp(Options.MaxBuffered, 1, NumItems);
+	const int32 NumWorkers = FMath::Clamp(Options.NumParseWorkers, 1, MaxBuffered);
+	const int32 ResolveAhead = FMath::Max(Options.ResolveAhead, 0);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FHandOffs HandOffs(NumItems, NumWorkers * ReadAheadPerWorker, MaxBuffered);
+
+	std::atomic<int32> NumParsed{ 0 };
+	std::atomic<int64> ReadCycles{ 0 };
+	std::atomic<int64> ParseCycles{ 0 };
+
+	// Reader and workers block on full queues for the whole run when building is the bottleneck, so they get threads
+	// of their own; on the shared pool they would starve any pool work the game thread waits on inside Build
+	TUniquePtr<FQueuedThreadPool> WorkerPool(FQueuedThreadPool::Allocate());
+	verify(WorkerPool->Create(NumWorkers + 1, WorkerStackSize, TPri_Normal, TEXT("FModelImportPipeline")));
+
+	TArray<TFuture<void>> Tasks;
+	Tasks.Add(AsyncPool(*WorkerPool, [&]()
+	{
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			FItemPtr Item = MakeUnique<FItem>();
+			const uint64 ReadStart = FPlatformTime::Cycles64();
+			Stages.Read(Index, *Item);
+			ReadCycles += FPlatformTime::Cycles64() - ReadStart;
+			HandOffs.PushOpened(MoveTemp(Item));
+		}
+	}));
+
+	for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+	{
+		Tasks.Add(AsyncPool(*WorkerPool, [&]()
+		{
+			int32 Index;
+			FItemPtr Item;
+			while (HandOffs.PopOpened(Index, Item))
+			{
+				if (!Item->bParsed)
+				{
+					const uint64 ParseStart = FPlatformTime::Cycles64();
+					Stages.Parse(Index, *Item);
+					ParseCycles += FPlatformTime::Cycles64() - ParseStart;
+				}
+				Item->File.Close();
+
+				++NumParsed;
+				HandOffs.PushParsed(Index, MoveTemp(Item));
+			}
+		}));
+	}
+
+	// Resolved items by index; Index .. NextToResolve - 1 are waiting to be built
+	TArray<FItemPtr> Resolved;
+	Resolved.SetNum(NumItems);
+	int32 NextToResolve = 0;
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		// Resolve as far ahead as parsing has got; only the item about to be built is waited for
+		while (NextToResolve < NumItems && NextToResolve <= Index + ResolveAhead)
+		{
+			FItemPtr Item;
+			if (NextToResolve == Index)
+			{
+				const double StallStart = FPlatformTime::Seconds();
+				Item = HandOffs.PopParsed(Index, true);
+				Stats.BuildStallSeconds += FPlatformTime::Seconds() - StallStart;
+			}
+			else
+			{
+				Item = HandOffs.PopParsed(NextToResolve, false);
+				if (!Item)
+				{
+					break;
+				}
+			}
+
+			const double ResolveStart = FPlatformTime::Seconds();
+			Stages.Resolve(NextToResolve, *Item);
+			Stats.ResolveSeconds += FPlatformTime::Seconds() - ResolveStart;
+
+			Resolved[NextToResolve] = MoveTemp(Item);
+			++NextToResolve;
+		}
+
+		Stats.PeakBuffered = FMath::Max(Stats.PeakBuffered, NumParsed.load() - Index);
+
+		FItemPtr Item = MoveTemp(Resolved[Index]);
+
+		const double LoadWaitStart = FPlatformTime::Seconds();
+		for (const int32 RequestId : Item->LoadRequests)
+		{
+			FlushAsyncLoading(RequestId);
+		}
+		Stats.LoadWaitSeconds += FPlatformTime::Seconds() - LoadWaitStart;
+
+		const double BuildStart = FPlatformTime::Seconds();
+		Stages.Build(Index, *Item);
+		Stats.BuildSeconds += FPlatformTime::Seconds() - BuildStart;
+
+		HandOffs.ReleaseBuilt();
+	}
+
+	for (TFuture<void>& Task : Tasks)
+	{
+		Task.Wait();
+	}
+	WorkerPool->Destroy();
+
+	Stats.ReadSeconds = FPlatformTime::ToSeconds64(ReadCycles.load());
+	Stats.ParseSeconds = FPlatformTime::ToSeconds64(ParseCycles.load());
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	return Stats;
+}
+
+FModelImportPipeline::FAsyncSaveQueue::FAsyncSaveQueue(int32 InMaxPending, FFinishFunction InFinish)
+	: MaxPending(FMath::Max(InMaxPending, 1))
+	, Finish(MoveTemp(InFinish))
+{
+}
+
+FModelImportPipeline::FAsyncSaveQueue::~FAsyncSaveQueue()
+{
+	Flush();
+}
+
+void FModelImportPipeline::FAsyncSaveQueue::Save(int32 Index, UObject* Asset, const FString& FileName)
+{
+	check(IsInGameThread());
+
+	if (NumWrites >= MaxPending)
+	{
+		Flush();
+	}
+
+	FPending& Entry = Pending.AddDefaulted_GetRef();
+	Entry.Index = Index;
+	Entry.FileName = FileName;
+
+	// Whatever is at FileName once the write is done must then come from this save
+	IFileManager& FileManager = IFileManager::Get();
+	if (FileManager.FileExists(*FileName) && !FileManager.Delete(*FileName, false, true, true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to delete old package file: %s"), *FileName);
+		return;
+	}
+
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_Async;
+
+	UPackage* Package = Asset->GetOutermost();
+	const double SaveStart = FPlatformTime::Seconds();
+	const FSavePackageResultStruct Result = UPackage::Save(Package, Asset, *FileName, SaveArgs);
+	SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+
+	if (Result.Result == ESavePackageResult::Success)
+	{
+		Entry.Package = Package;
+		++NumWrites;
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to save package: %s"), *FileName);
+	}
+}
+
+void FModelImportPipeline::FAsyncSaveQueue::Skip(int32 Index)
+{
+	if (Pending.Num() == 0)
+	{
+		Finish(Index, false);
+		return;
+	}
+
+	Pending.AddDefaulted_GetRef().Index = Index;
+}
+
+bool FModelImportPipeline::FAsyncSaveQueue::IsPending(const UObject* Asset) const
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
+	const UPackage* Package = Asset->GetOutermost();
+	return Pending.ContainsByPredicate([Package](const FPending& Entry) { return Entry.Package == Package; });
+}
+
+void FModelImportPipeline::FAsyncSaveQueue::Flush()
+{
+	check(IsInGameThread());
+
+	if (NumWrites > 0)
+	{
+		const double WaitStart = FPlatformTime::Seconds();
+		UPackage::WaitForAsyncFileWrites();
+		WaitSeconds += FPlatformTime::Seconds() - WaitStart;
+	}
+
+	// Finish may queue more items
+	TArray<FPending> Finished = MoveTemp(Pending);
+	Pending.Reset();
+	NumWrites = 0;
+
+	for (const FPending& Entry : Finished)
+	{
+		bool bSaved = false;
+		if (Entry.Package)
+		{
+			// A failed write is only logged by the writer; Save deleted any older file, so a missing or empty one tells
+			bSaved = IFileManager::Get().FileSize(*Entry.FileName) > 0;
+			if (!bSaved)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Failed to write package: %s"), *Entry.FileName);
+			}
+		}
+		Finish(Entry.Index, bSaved);
+	}
+}
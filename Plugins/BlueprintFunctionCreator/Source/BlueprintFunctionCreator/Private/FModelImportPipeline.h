@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelClassDescriptor.h"
+#include "FModelExportFile.h"
+
+/**
+ * Bounded pipeline for importing many exports, in five stages:
+ * - read: one thread opens and hashes each file (or takes its descriptor from the cache)
+ * - parse: worker threads parse the opened files
+ * - resolve: the calling (game) thread starts async loads of the packages a descriptor references, a few items ahead
+ * - build: the calling thread waits for those loads and creates the asset, in input order
+ * - save: FAsyncSaveQueue writes packages to disk while the next items build
+ * Any parse worker takes the next opened file from one shared fixed-size queue, and the calling thread takes parsed
+ * items back in input order from a reorder buffer of MaxBuffered slots. A full queue blocks the reader, and a worker
+ * only starts an item that has a free slot, so a slow game thread throttles reading and parsing.
+ */
+namespace FModelImportPipeline
+{
+	/** One export on its way through the stages */
+	struct FItem
+	{
+		/** Opened by the read stage and closed once parsed, so only items waiting to be parsed hold a file */
+		FFModelExportFile File;
+		bool bOpened = false;
+
+		/** Set by the read stage on a descriptor cache hit: there is nothing left to parse */
+		bool bParsed = false;
+
+		FFModelParseResult Result;
+
+		/** Async package loads the resolve stage started; the build stage waits for them */
+		TArray<int32> LoadRequests;
+	};
+
+	using FStageFunction = TFunction<void(int32 Index, FItem& Item)>;
+
+	struct FStages
+	{
+		/** Read thread */
+		FStageFunction Read;
+		/** Parse workers; skipped for items the read stage already parsed */
+		FStageFunction Parse;
+		/** Calling thread, up to FOptions::ResolveAhead items ahead of Build */
+		FStageFunction Resolve;
+		/** Calling thread, in input order, once the item's LoadRequests are done */
+		FStageFunction Build;
+	};
+
+	struct FOptions
+	{
+		/** Most items being parsed or waiting for the calling thread */
+		int32 MaxBuffered = 64;
+		/** Parse worker count; a dedicated thread pool of this size plus the read thread lives for the run */
+		int32 NumParseWorkers = 1;
+		/** Items resolved ahead of the one being built, so their loads run while it builds */
+		int32 ResolveAhead = 4;
+	};
+
+	struct FStats
+	{
+		double TotalSeconds = 0.0;
+		/** Time the read thread spent reading */
+		double ReadSeconds = 0.0;
+		/** Parse time summed over all workers */
+		double ParseSeconds = 0.0;
+		/** Time the calling thread spent in Resolve */
+		double ResolveSeconds = 0.0;
+		/** Time the calling thread waited for the loads Resolve started */
+		double LoadWaitSeconds = 0.0;
+		/** Time the calling thread spent in Build */
+		double BuildSeconds = 0.0;
+		/** Time the calling thread waited for the next parsed item; near zero when building is the bottleneck */
+		double BuildStallSeconds = 0.0;
+		/** Most parsed items not yet built */
+		int32 PeakBuffered = 0;
+	};
+
+	/** Run the read, parse, resolve and build stages to completion */
+	FStats Run(int32 NumItems, const FOptions& Options, const FStages& Stages);
+
+	/**
+	 * The save stage. Packages are serialized on the game thread and written by async tasks while later items build;
+	 * items finish in the order they were added, once their writes are done. Game thread only.
+	 */
+	class FAsyncSaveQueue
+	{
+	public:
+		/** Called once per item, in order; bSaved is false for skipped items and packages that could not be written */
+		using FFinishFunction = TFunction<void(int32 Index, bool bSaved)>;
+
+		/** @param MaxPending - Most writes in flight; Save flushes beyond it */
+		FAsyncSaveQueue(int32 MaxPending, FFinishFunction Finish);
+
+		/** Finishes everything still queued */
+		~FAsyncSaveQueue();
+
+		/** Delete any file at FileName, then serialize Asset's package and queue its write there */
+		void Save(int32 Index, UObject* Asset, const FString& FileName);
+
+		/** Queue an item with nothing to save, so it still finishes in order */
+		void Skip(int32 Index);
+
+		/** True if Asset's package is queued and not finished yet */
+		bool IsPending(const UObject* Asset) const;
+
+		/** Wait for every queued write and finish the queued items */
+		void Flush();
+
+		/** Game-thread time spent serializing packages */
+		double GetSaveSeconds() const { return SaveSeconds; }
+
+		/** Game-thread time spent waiting for writes */
+		double GetWaitSeconds() const { return WaitSeconds; }
+
+	private:
+		struct FPending
+		{
+			int32 Index = INDEX_NONE;
+			/** Null for skipped items and packages that could not be saved */
+			const UPackage* Package = nullptr;
+			FString FileName;
+		};
+
+		TArray<FPending> Pending;
+		int32 NumWrites = 0;
+		int32 MaxPending;
+		FFinishFunction Finish;
+		double SaveSeconds = 0.0;
+		double WaitSeconds = 0.0;
+	};
+}
@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportScheduler.h"
+
+FString FModelImportScheduler::GetParentBlueprintClassName(const FFModelExportSummary& Summary)
+{
+	if (!Summary.bHasSuper || !Summary.SuperObjectName.StartsWith(TEXT("BlueprintGeneratedClass")))
+	{
+		return FString();
+	}
+
+	// "BlueprintGeneratedClass'BP_WeaponBase_C'" -> "BP_WeaponBase_C"
+	int32 OpenQuote = INDEX_NONE;
+	int32 CloseQuote = INDEX_NONE;
+	if (!Summary.SuperObjectName.FindChar(TEXT('\''), OpenQuote) || !Summary.SuperObjectName.FindLastChar(TEXT('\''), CloseQuote) || CloseQuote <= OpenQuote)
+	{
+		return FString();
+	}
+	return Summary.SuperObjectName.Mid(OpenQuote + 1, CloseQuote - OpenQuote - 1);
+}
+
+FFModelImportPlan FModelImportScheduler::BuildPlan(const TArray<FFModelExportSummary>& Summaries)
+{
+	FFModelImportPlan Plan;
+
+	// Nodes are the Blueprint exports, in input order
+	TArray<int32> NodeSummaries;
+	TMap<FString, int32> NodeByClassName;
+	for (int32 SummaryIndex = 0; SummaryIndex < Summaries.Num(); ++SummaryIndex)
+	{
+		const FFModelExportSummary& Summary = Summaries[SummaryIndex];
+		if (!Summary.bHasBlueprintClass || Summary.BlueprintClassName.IsEmpty())
+		{
+			continue;
+		}
+
+		if (NodeByClassName.Contains(Summary.BlueprintClassName))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("⚠️ %s is defined again by %s, keeping the first definition"), *Summary.BlueprintClassName, *Summary.JsonFilePath);
+			Plan.DuplicateJsonFilePaths.Add(Summary.JsonFilePath);
+			continue;
+		}
+
+		NodeByClassName.Add(Summary.BlueprintClassName, NodeSummaries.Num());
+		NodeSummaries.Add(SummaryIndex);
+	}
+
+	// Parent -> child edges (CSR layout: children of node N are Children[FirstChild[N] .. FirstChild[N + 1]))
+	const int32 NumNodes = NodeSummaries.Num();
+	TArray<FString> ParentClassNames;
+	TArray<int32> ParentNodes;
+	ParentClassNames.SetNum(NumNodes);
+	ParentNodes.Init(INDEX_NONE, NumNodes);
+
+	TArray<int32> FirstChild;
+	FirstChild.SetNumZeroed(NumNodes + 1);
+
+	TSet<FString> MissingParents;
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		ParentClassNames[Node] = GetParentBlueprintClassName(Summaries[NodeSummaries[Node]]);
+		if (ParentClassNames[Node].IsEmpty())
+		{
+			continue;
+		}
+
+		if (const int32* ParentNode = NodeByClassName.Find(ParentClassNames[Node]))
+		{
+			ParentNodes[Node] = *ParentNode;
+			++FirstChild[*ParentNode + 1];
+		}
+		else
+		{
+			MissingParents.Add(ParentClassNames[Node]);
+		}
+	}
+
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		FirstChild[Node + 1] += FirstChild[Node];
+	}
+
+	TArray<int32> Children;
+	Children.SetNumUninitialized(FirstChild[NumNodes]);
+	{
+		TArray<int32> NextChild(FirstChild.GetData(), NumNodes);
+		for (int32 Node = 0; Node < NumNodes; ++Node)
+		{
+			if (ParentNodes[Node] != INDEX_NONE)
+			{
+				Children[NextChild[ParentNodes[Node]]++] = Node;
+			}
+		}
+	}
+
+	// Breadth-first from the roots: each export is emitted once, after its parent, grouped by depth.
+	// Nodes on a cycle have an in-tree parent that is never emitted, so they are never reached
+	TArray<int32> EntryByNode;
+	EntryByNode.Init(INDEX_NONE, NumNodes);
+	TArray<int32> NodeByEntry;
+	NodeByEntry.Reserve(NumNodes);
+	Plan.Entries.Reserve(NumNodes);
+
+	auto Emit = [&](int32 Node, int32 Depth)
+	{
+		FFModelImportPlanEntry& Entry = Plan.Entries.AddDefaulted_GetRef();
+		const FFModelExportSummary& Summary = Summaries[NodeSummaries[Node]];
+		Entry.JsonFilePath = Summary.JsonFilePath;
+		Entry.BlueprintClassName = Summary.BlueprintClassName;
+		Entry.ParentClassName = ParentClassNames[Node];
+		Entry.ParentIndex = ParentNodes[Node] != INDEX_NONE ? EntryByNode[ParentNodes[Node]] : INDEX_NONE;
+		Entry.Depth = Depth;
+		EntryByNode[Node] = NodeByEntry.Add(Node);
+	};
+
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		if (ParentNodes[Node] == INDEX_NONE)
+		{
+			Emit(Node, 0);
+		}
+	}
+
+	int32 DepthBegin = 0;
+	while (DepthBegin < Plan.Entries.Num())
+	{
+		const int32 DepthEnd = Plan.Entries.Num();
+		++Plan.NumDepths;
+		for (int32 EntryIndex = DepthBegin; EntryIndex < DepthEnd; ++EntryIndex)
+		{
+			const int32 Node = NodeByEntry[EntryIndex];
+			for (int32 ChildIndex = FirstChild[Node]; ChildIndex < FirstChild[Node + 1]; ++ChildIndex)
+			{
+				Emit(Children[ChildIndex], Plan.NumDepths);
+			}
+		}
+		DepthBegin = DepthEnd;
+	}
+
+	for (int32 Node = 0; Node < NumNodes; ++Node)
+	{
+		if (EntryByNode[Node] == INDEX_NONE)
+		{
+			const FFModelExportSummary& Summary = Summaries[NodeSummaries[Node]];
+			UE_LOG(LogTemp, Warning, TEXT("⚠️ %s is on an inheritance cycle (parent %s), skipping"), *Summary.BlueprintClassName, *ParentClassNames[Node]);
+			Plan.CyclicJsonFilePaths.Add(Summary.JsonFilePath);
+		}
+	}
+
+	Plan.MissingParentClassNames = MissingParents.Array();
+	Plan.MissingParentClassNames.Sort();
+
+	return Plan;
+}
@@ -0,0 +1,28 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelExportSummary.h"
+#include "FModelImportPlan.h"
+
+/**
+ * Orders Blueprint exports so every parent is created before its children.
+ * Builds the parent -> child graph once from the structural summaries (the same Super reference
+ * the parser turns into ParentClassPath) and walks it breadth-first, so each export is visited once.
+ */
+namespace FModelImportScheduler
+{
+	/**
+	 * Plan the creation order of the Blueprint exports among Summaries.
+	 * Exports without a BlueprintGeneratedClass are ignored.
+	 * @param Summaries - Structural summaries, e.g. from FModelExportIndex::Refresh
+	 */
+	FFModelImportPlan BuildPlan(const TArray<FFModelExportSummary>& Summaries);
+
+	/**
+	 * Class name of a Blueprint Super reference ("BlueprintGeneratedClass'BP_Foo_C'" -> "BP_Foo_C")
+	 * @return Empty if the Super is not a Blueprint class
+	 */
+	FString GetParentBlueprintClassName(const FFModelExportSummary& Summary);
+}
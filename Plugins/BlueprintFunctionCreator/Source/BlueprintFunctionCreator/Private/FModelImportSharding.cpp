@@ -0,0 +1,148 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportSharding.h"
+#include "Algo/Reverse.h"
+
+namespace
+{
+	struct FUnit
+	{
+		int32 Root = INDEX_NONE;
+		int32 Stage = 0;
+		/** False for a root split off from its subtree */
+		bool bWholeSubtree = true;
+		int32 Size = 0;
+	};
+}
+
+TArray<FModelImportSharding::FStage> FModelImportSharding::Partition(const FFModelImportPlan& Plan, int32 NumShards)
+{
+	const int32 NumEntries = Plan.Entries.Num();
+	NumShards = FMath::Max(NumShards, 1);
+
+	// Children always come after their parent in the plan, so one backward sweep sums subtree sizes
+	TArray<int32> SubtreeSizes;
+	SubtreeSizes.Init(1, NumEntries);
+	TArray<TArray<int32>> Children;
+	Children.SetNum(NumEntries);
+	for (int32 Index = NumEntries - 1; Index >= 0; --Index)
+	{
+		const int32 Parent = Plan.Entries[Index].ParentIndex;
+		if (Parent != INDEX_NONE)
+		{
+			SubtreeSizes[Parent] += SubtreeSizes[Index];
+			Children[Parent].Add(Index);
+		}
+	}
+
+	// The sweep collected each parent's children last to first; put them back in plan order
+	for (TArray<int32>& ChildList : Children)
+	{
+		Algo::Reverse(ChildList);
+	}
+
+	// Split trees that would not fit a fair share until every unit does (or is a single entry)
+	const int32 FairShare = FMath::DivideAndRoundUp(FMath::Max(NumEntries, 1), NumShards);
+	TArray<FUnit> Pending;
+	for (int32 Index = NumEntries - 1; Index >= 0; --Index)
+	{
+		if (Plan.Entries[Index].ParentIndex == INDEX_NONE)
+		{
+			Pending.Add({ Index, 0, true, SubtreeSizes[Index] });
+		}
+	}
+
+	TArray<FUnit> Units;
+	while (Pending.Num() > 0)
+	{
+		const FUnit Unit = Pending.Pop();
+		if (Unit.Size <= FairShare || Children[Unit.Root].Num() == 0)
+		{
+			Units.Add(Unit);
+			continue;
+		}
+
+		Units.Add({ Unit.Root, Unit.Stage, false, 1 });
+		for (int32 ChildIndex = Children[Unit.Root].Num() - 1; ChildIndex >= 0; --ChildIndex)
+		{
+			const int32 Child = Children[Unit.Root][ChildIndex];
+			Pending.Add({ Child, Unit.Stage + 1, true, SubtreeSizes[Child] });
+		}
+	}
+
+	int32 NumStages = 0;
+	for (const FUnit& Unit : Units)
+	{
+		NumStages = FMath::Max(NumStages, Unit.Stage + 1);
+	}
+
+	// Largest first onto the least loaded shard of the unit's stage; ties broken by plan position
+	Units.Sort([](const FUnit& A, const FUnit& B)
+	{
+		if (A.Stage != B.Stage)
+		{
+			return A.Stage < B.Stage;
+		}
+		if (A.Size != B.Size)
+		{
+			return A.Size > B.Size;
+		}
+		return A.Root < B.Root;
+	});
+
+	TArray<FStage> Stages;
+	Stages.SetNum(NumStages);
+	TArray<int32> Loads;
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		Stages[Stage].SetNum(NumShards);
+	}
+
+	int32 CurrentStage = INDEX_NONE;
+	TArray<int32> Stack;
+	for (const FUnit& Unit : Units)
+	{
+		if (Unit.Stage != CurrentStage)
+		{
+			CurrentStage = Unit.Stage;
+			Loads.Init(0, NumShards);
+		}
+
+		int32 Target = 0;
+		for (int32 Shard = 1; Shard < NumShards; ++Shard)
+		{
+			if (Loads[Shard] < Loads[Target])
+			{
+				Target = Shard;
+			}
+		}
+		Loads[Target] += Unit.Size;
+
+		FShard& Shard = Stages[Unit.Stage][Target];
+		if (!Unit.bWholeSubtree)
+		{
+			Shard.Add(Unit.Root);
+			continue;
+		}
+
+		Stack.Reset();
+		Stack.Add(Unit.Root);
+		while (Stack.Num() > 0)
+		{
+			const int32 Index = Stack.Pop();
+			Shard.Add(Index);
+			Stack.Append(Children[Index]);
+		}
+	}
+
+	for (FStage& Stage : Stages)
+	{
+		Stage.RemoveAll([](const FShard& Shard) { return Shard.Num() == 0; });
+		for (FShard& Shard : Stage)
+		{
+			Shard.Sort();
+		}
+	}
+
+	return Stages;
+}
@@ -0,0 +1,30 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelImportPlan.h"
+
+/**
+ * Splits an import plan into shards for separate editor processes.
+ * Inheritance trees are kept whole where possible, so shards share no parent edges. A tree larger
+ * than a fair share is split below its root: the root goes to one stage and each child subtree to
+ * the next, so a parent in another shard is always created by an earlier stage.
+ */
+namespace FModelImportSharding
+{
+	/** Entry indices of one shard, ascending (so parents inside the shard still come first) */
+	using FShard = TArray<int32>;
+
+	/** Shards that can run at the same time */
+	using FStage = TArray<FShard>;
+
+	/**
+	 * Partition the plan entries.
+	 * The result only depends on the plan and NumShards, so reruns produce identical shards.
+	 * @param Plan - Creation order from FModelImportScheduler
+	 * @param NumShards - Most shards per stage
+	 * @return Stages to run one after the other
+	 */
+	TArray<FStage> Partition(const FFModelImportPlan& Plan, int32 NumShards);
+}
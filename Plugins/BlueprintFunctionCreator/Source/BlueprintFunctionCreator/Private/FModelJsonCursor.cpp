@@ -0,0 +1,137 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelJsonCursor.h"
+#include "Misc/Parse.h"
+
+namespace
+{
+	/**
+	 * Decode a raw JSON string body the same way TJsonReader does.
+	 * Runs between escapes go through AppendRun so UTF-8 input is converted a run at a time.
+	 */
+	template <typename CharType, typename AppendRunFunc>
+	void DecodeEscapes(const CharType* Data, int32 Len, FString& Result, AppendRunFunc&& AppendRun)
+	{
+		int32 RunStart = 0;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			if (static_cast<uint32>(Data[Index]) != '\\' || Index + 1 >= Len)
+			{
+				continue;
+			}
+
+			AppendRun(Data + RunStart, Index - RunStart);
+
+			const uint32 Escaped = static_cast<uint32>(Data[++Index]);
+			switch (Escaped)
+			{
+			case 'b': Result.AppendChar(TEXT('\b')); break;
+			case 'f': Result.AppendChar(TEXT('\f')); break;
+			case 'n': Result.AppendChar(TEXT('\n')); break;
+			case 'r': Result.AppendChar(TEXT('\r')); break;
+			case 't': Result.AppendChar(TEXT('\t')); break;
+			case 'u':
+			{
+				uint32 CodeUnit = 0;
+				for (int32 Digit = 0; Digit < 4 && Index + 1 < Len; ++Digit)
+				{
+					CodeUnit = (CodeUnit << 4) | FParse::HexDigit(static_cast<TCHAR>(Data[++Index]));
+				}
+				Result.AppendChar(static_cast<TCHAR>(CodeUnit));
+				break;
+			}
+			default:
+				// \" \\ \/ and anything unknown map to the character itself
+				Result.AppendChar(static_cast<TCHAR>(Escaped));
+				break;
+			}
+
+			RunStart = Index + 1;
+		}
+
+		AppendRun(Data + RunStart, Len - RunStart);
+	}
+
+	void AppendUtf8(FString& Result, const UTF8CHAR* Run, int32 RunLen)
+	{
+		if (RunLen > 0)
+		{
+			FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Run), RunLen);
+			Result.AppendChars(Converted.Get(), Converted.Length());
+		}
+	}
+}
+
+FString FFModelJsonString::ToString() const
+{
+	if (bOwned)
+	{
+		return Owned;
+	}
+
+	if (Data == nullptr)
+	{
+		return FString();
+	}
+
+	FString Result;
+	if (bUtf8)
+	{
+		const UTF8CHAR* Utf8 = static_cast<const UTF8CHAR*>(Data);
+		if (!bEscaped)
+		{
+			AppendUtf8(Result, Utf8, Len);
+			return Result;
+		}
+
+		Result.Reserve(Len);
+		DecodeEscapes(Utf8, Len, Result, [&Result](const UTF8CHAR* Run, int32 RunLen)
+		{
+			AppendUtf8(Result, Run, RunLen);
+		});
+		return Result;
+	}
+
+	const TCHAR* Chars = static_cast<const TCHAR*>(Data);
+	if (!bEscaped)
+	{
+		return FString(Len, Chars);
+	}
+
+	Result.Reserve(Len);
+	DecodeEscapes(Chars, Len, Result, [&Result](const TCHAR* Run, int32 RunLen)
+	{
+		Result.AppendChars(Run, RunLen);
+	});
+	return Result;
+}
+
+bool FFModelJsonString::Equals(const TCHAR* Literal) const
+{
+	if (bOwned || bEscaped)
+	{
+		return ToString().Equals(Literal, ESearchCase::IgnoreCase);
+	}
+
+	if (Data == nullptr || FCString::Strlen(Literal) != Len)
+	{
+		return false;
+	}
+
+	if (!bUtf8)
+	{
+		return FCString::Strnicmp(static_cast<const TCHAR*>(Data), Literal, Len) == 0;
+	}
+
+	// Literals are ASCII, so any multi-byte sequence is a mismatch
+	const UTF8CHAR* Utf8 = static_cast<const UTF8CHAR*>(Data);
+	for (int32 Index = 0; Index < Len; ++Index)
+	{
+		const uint32 Byte = static_cast<uint32>(Utf8[Index]);
+		if (Byte >= 0x80 || FChar::ToLower(static_cast<TCHAR>(Byte)) != FChar::ToLower(Literal[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,575 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelStructuralScan.h"
+
+/** Kind of the next JSON value under the cursor */
+enum class EFModelJsonValue : uint8
+{
+	Error,
+	Object,
+	Array,
+	String,
+	Number,
+	Boolean,
+	Null
+};
+
+/**
+ * A string value as it appears in the source text (TCHAR or UTF-8).
+ * Holds a view of the raw characters between the quotes (escapes still encoded),
+ * so only the values the importer actually keeps are ever decoded into an FString.
+ */
+struct FFModelJsonString
+{
+	/** Raw characters between the quotes; TCHAR, or UTF-8 bytes if bUtf8 */
+	const void* Data = nullptr;
+	int32 Len = 0;
+
+	/** True if Data points at UTF-8 bytes rather than TCHARs */
+	bool bUtf8 = false;
+
+	/** True if the raw characters contain escape sequences */
+	bool bEscaped = false;
+
+	/** Decoded value for tokens that are not plain JSON strings (numbers, booleans, DOM input) */
+	FString Owned;
+	bool bOwned = false;
+
+	/** True if a value was read into this string (mirrors FJsonObject::TryGetStringField succeeding) */
+	bool IsSet() const { return Data != nullptr || bOwned; }
+
+	bool IsEmpty() const { return bOwned ? Owned.IsEmpty() : Len == 0; }
+
+	/** Decode into an FString */
+	FString ToString() const;
+
+	/** Case-insensitive comparison, same semantics as FString::operator== */
+	bool Equals(const TCHAR* Literal) const;
+
+	void SetOwned(FString&& InValue)
+	{
+		Data = nullptr;
+		Len = 0;
+		bUtf8 = false;
+		bEscaped = false;
+		Owned = MoveTemp(InValue);
+		bOwned = true;
+	}
+};
+
+/**
+ * Forward-only pull reader over JSON text.
+ * Unlike FJsonSerializer it never builds a DOM: callers walk objects and arrays
+ * and either read the values they care about or skip them.
+ *
+ * CharType is TCHAR for text already loaded into an FString, or UTF8CHAR to parse
+ * file bytes in place without widening them first.
+ *
+ * Every value reached through NextKey/NextElement must be consumed with one of
+ * Read*, Enter* or SkipValue before advancing again.
+ */
+template <typename CharType>
+class TFModelJsonCursor
+{
+public:
+	explicit TFModelJsonCursor(TStringView<CharType> InText)
+		: Cur(InText.GetData())
+		, End(InText.GetData() + InText.Len())
+	{
+	}
+
+	/** Kind of the next value, without consuming it */
+	EFModelJsonValue Peek()
+	{
+		SkipWhitespace();
+		if (Cur >= End)
+		{
+			return EFModelJsonValue::Error;
+		}
+
+		switch (Char())
+		{
+		case '{': return EFModelJsonValue::Object;
+		case '[': return EFModelJsonValue::Array;
+		case '"': return EFModelJsonValue::String;
+		case 't':
+		case 'f': return EFModelJsonValue::Boolean;
+		case 'n': return EFModelJsonValue::Null;
+		default:
+			return (Char() == '-' || IsDigit(Char())) ? EFModelJsonValue::Number : EFModelJsonValue::Error;
+		}
+	}
+
+	/** Consume the opening brace of an object */
+	bool EnterObject()
+	{
+		if (Peek() != EFModelJsonValue::Object)
+		{
+			return Fail();
+		}
+		++Cur;
+		bFirstInContainer = true;
+		return true;
+	}
+
+	/** Consume the opening bracket of an array */
+	bool EnterArray()
+	{
+		if (Peek() != EFModelJsonValue::Array)
+		{
+			return Fail();
+		}
+		++Cur;
+		bFirstInContainer = true;
+		return true;
+	}
+
+	/**
+	 * Advance to the next member of the current object.
+	 * @return True with OutKey set and the cursor on the member value; false at the closing brace or on error
+	 */
+	bool NextKey(FFModelJsonString& OutKey)
+	{
+		if (!AdvanceInContainer('}'))
+		{
+			return false;
+		}
+		if (!ScanString(OutKey))
+		{
+			return false;
+		}
+		SkipWhitespace();
+		if (Cur >= End || Char() != ':')
+		{
+			return Fail();
+		}
+		++Cur;
+		return true;
+	}
+
+	/**
+	 * Advance to the next element of the current array.
+	 * @return True with the cursor on the element value; false at the closing bracket or on error
+	 */
+	bool NextElement()
+	{
+		return AdvanceInContainer(']');
+	}
+
+	/**
+	 * Read the current value as a string, with FJsonValue::TryGetString semantics:
+	 * strings, numbers and booleans succeed; null, objects and arrays are skipped and fail.
+	 */
+	bool ReadString(FFModelJsonString& Out)
+	{
+		switch (Peek())
+		{
+		case EFModelJsonValue::String:
+			return ScanString(Out);
+
+		case EFModelJsonValue::Number:
+		{
+			const CharType* Start = Cur;
+			if (!ScanNumber())
+			{
+				return false;
+			}
+
+			// Numbers are pure ASCII in either encoding
+			FString Lexeme;
+			Lexeme.Reserve(UE_PTRDIFF_TO_INT32(Cur - Start));
+			for (const CharType* It = Start; It < Cur; ++It)
+			{
+				Lexeme.AppendChar(static_cast<TCHAR>(*It));
+			}
+			Out.SetOwned(FString::SanitizeFloat(FCString::Atod(*Lexeme), 0));
+			return true;
+		}
+
+		case EFModelJsonValue::Boolean:
+		{
+			const bool bValue = (Char() == 't');
+			if (!ScanLiteral(bValue ? "true" : "false"))
+			{
+				return false;
+			}
+			Out.SetOwned(bValue ? TEXT("true") : TEXT("false"));
+			return true;
+		}
+
+		default:
+			SkipValue();
+			return false;
+		}
+	}
+
+	/** Consume the current value, whatever its kind, validating it on the way */
+	bool SkipValue()
+	{
+		switch (Peek())
+		{
+		case EFModelJsonValue::Object:
+		{
+			EnterObject();
+			FFModelJsonString Key;
+			while (NextKey(Key))
+			{
+				if (!SkipValue())
+				{
+					return false;
+				}
+			}
+			return !bError;
+		}
+
+		case EFModelJsonValue::Array:
+		{
+			EnterArray();
+			while (NextElement())
+			{
+				if (!SkipValue())
+				{
+					return false;
+				}
+			}
+			return !bError;
+		}
+
+		case EFModelJsonValue::String:
+		{
+			FFModelJsonString Ignored;
+			return ScanString(Ignored);
+		}
+
+		case EFModelJsonValue::Number:
+			return ScanNumber();
+
+		case EFModelJsonValue::Boolean:
+			return ScanLiteral(Char() == 't' ? "true" : "false");
+
+		case EFModelJsonValue::Null:
+			return ScanLiteral("null");
+
+		default:
+			return Fail();
+		}
+	}
+
+	/**
+	 * Consume the rest of the current container, up to and including its closing brace or bracket.
+	 * Brackets are matched at byte level (vectorized for UTF-8) and strings are skipped whole,
+	 * without validating anything in between, so skipping large subtrees costs a scan rather than a parse.
+	 */
+	bool SkipRestOfContainer()
+	{
+		if (bError)
+		{
+			return false;
+		}
+
+		int32 Depth = 1;
+		while (true)
+		{
+			Cur = FindStructural(Cur);
+			if (Cur >= End)
+			{
+				return Fail();
+			}
+
+			switch (Char())
+			{
+			case '"':
+				Cur = FindClosingQuote(Cur + 1);
+				if (Cur >= End)
+				{
+					return Fail();
+				}
+				++Cur;
+				break;
+
+			case '{':
+			case '[':
+				++Depth;
+				++Cur;
+				break;
+
+			case '}':
+			case ']':
+				++Cur;
+				if (--Depth == 0)
+				{
+					bFirstInContainer = false;
+					return true;
+				}
+				break;
+
+			default:
+				// A backslash outside a string; not valid JSON, but irrelevant to bracket matching
+				++Cur;
+				break;
+			}
+		}
+	}
+
+	/** Consume the current value like SkipValue, but skip objects and arrays with SkipRestOfContainer */
+	bool SkipValueUnchecked()
+	{
+		switch (Peek())
+		{
+		case EFModelJsonValue::Object:
+			EnterObject();
+			return SkipRestOfContainer();
+
+		case EFModelJsonValue::Array:
+			EnterArray();
+			return SkipRestOfContainer();
+
+		default:
+			return SkipValue();
+		}
+	}
+
+	/** True if only whitespace remains */
+	bool IsAtEnd()
+	{
+		SkipWhitespace();
+		return Cur >= End;
+	}
+
+	bool HasError() const { return bError; }
+
+private:
+	static constexpr bool bIsUtf8 = sizeof(CharType) == 1;
+
+	const CharType* Cur;
+	const CharType* End;
+
+	/** True right after entering a container, before its first key/element */
+	bool bFirstInContainer = false;
+
+	bool bError = false;
+
+	/** Current code unit; every structural character is ASCII in both encodings */
+	uint32 Char() const { return static_cast<uint32>(*Cur); }
+
+	static bool IsDigit(uint32 C) { return C >= '0' && C <= '9'; }
+
+	static bool IsHexDigit(uint32 C) { return IsDigit(C) || (C >= 'a' && C <= 'f') || (C >= 'A' && C <= 'F'); }
+
+	/** First '"', '\\', '{', '}', '[' or ']' at or after From, or End */
+	const CharType* FindStructural(const CharType* From) const
+	{
+		if constexpr (bIsUtf8)
+		{
+			return FModelStructuralScan::FindStructural(From, End);
+		}
+		else
+		{
+			for (; From < End; ++From)
+			{
+				switch (static_cast<uint32>(*From))
+				{
+				case '"':
+				case '\\':
+				case '{':
+				case '}':
+				case '[':
+				case ']':
+					return From;
+				default:
+					break;
+				}
+			}
+			return End;
+		}
+	}
+
+	/** Closing quote of a string whose body starts at From, or End if it is unterminated */
+	const CharType* FindClosingQuote(const CharType* From) const
+	{
+		if constexpr (bIsUtf8)
+		{
+			bool bEscaped = false;
+			return FModelStructuralScan::FindStringEnd(From, End, bEscaped);
+		}
+		else
+		{
+			while (From < End)
+			{
+				const uint32 C = static_cast<uint32>(*From);
+				if (C == '"')
+				{
+					return From;
+				}
+				// Step over the escaped character too, so \" never ends the string
+				From += (C == '\\' && End - From > 1) ? 2 : 1;
+			}
+			return End;
+		}
+	}
+
+	bool Fail()
+	{
+		bError = true;
+		Cur = End;
+		return false;
+	}
+
+	void SkipWhitespace()
+	{
+		while (Cur < End && (Char() == ' ' || Char() == '\n' || Char() == '\r' || Char() == '\t'))
+		{
+			++Cur;
+		}
+	}
+
+	bool AdvanceInContainer(uint32 Closer)
+	{
+		if (bError)
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+		if (Cur >= End)
+		{
+			return Fail();
+		}
+
+		if (Char() == Closer)
+		{
+			++Cur;
+			// The container we just closed was itself a value of its parent
+			bFirstInContainer = false;
+			return false;
+		}
+
+		if (!bFirstInContainer)
+		{
+			if (Char() != ',')
+			{
+				return Fail();
+			}
+			++Cur;
+			SkipWhitespace();
+		}
+
+		bFirstInContainer = false;
+		return Cur < End || Fail();
+	}
+
+	bool ScanString(FFModelJsonString& Out)
+	{
+		SkipWhitespace();
+		if (Cur >= End || Char() != '"')
+		{
+			return Fail();
+		}
+		++Cur;
+
+		const CharType* Start = Cur;
+		bool bEscaped = false;
+		while (Cur < End && Char() != '"')
+		{
+			if (Char() == '\\')
+			{
+				bEscaped = true;
+				if (++Cur >= End)
+				{
+					return Fail();
+				}
+				if (Char() == 'u')
+				{
+					for (int32 Digit = 0; Digit < 4; ++Digit)
+					{
+						if (++Cur >= End || !IsHexDigit(Char()))
+						{
+							return Fail();
+						}
+					}
+				}
+			}
+			++Cur;
+		}
+
+		if (Cur >= End)
+		{
+			return Fail();
+		}
+
+		Out.Data = Start;
+		Out.Len = UE_PTRDIFF_TO_INT32(Cur - Start);
+		Out.bUtf8 = bIsUtf8;
+		Out.bEscaped = bEscaped;
+		Out.Owned.Reset();
+		Out.bOwned = false;
+		++Cur;
+		return true;
+	}
+
+	bool ScanNumber()
+	{
+		SkipWhitespace();
+		if (Cur < End && Char() == '-')
+		{
+			++Cur;
+		}
+		if (!ScanDigits())
+		{
+			return Fail();
+		}
+		if (Cur < End && Char() == '.')
+		{
+			++Cur;
+			if (!ScanDigits())
+			{
+				return Fail();
+			}
+		}
+		if (Cur < End && (Char() == 'e' || Char() == 'E'))
+		{
+			++Cur;
+			if (Cur < End && (Char() == '+' || Char() == '-'))
+			{
+				++Cur;
+			}
+			if (!ScanDigits())
+			{
+				return Fail();
+			}
+		}
+		return true;
+	}
+
+	bool ScanDigits()
+	{
+		const CharType* Start = Cur;
+		while (Cur < End && IsDigit(Char()))
+		{
+			++Cur;
+		}
+		return Cur > Start;
+	}
+
+	bool ScanLiteral(const ANSICHAR* Literal)
+	{
+		SkipWhitespace();
+		for (; *Literal; ++Literal, ++Cur)
+		{
+			if (Cur >= End || Char() != static_cast<uint32>(*Literal))
+			{
+				return Fail();
+			}
+		}
+		return true;
+	}
+};
+
+/** Cursor over text already loaded into an FString */
+using FFModelJsonCursor = TFModelJsonCursor<TCHAR>;
+
+/** Cursor over raw UTF-8 file bytes */
+using FFModelUtf8JsonCursor = TFModelJsonCursor<UTF8CHAR>;
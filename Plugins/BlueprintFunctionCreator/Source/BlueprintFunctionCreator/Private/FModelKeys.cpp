@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelKeys.h"
+#include "FModelJsonCursor.h"
+#include "FModelPerfectHash.h"
+
+namespace
+{
+	using FKeyTable = TFModelPerfectHashTable<EFModelKey, static_cast<int32>(EFModelKey::Count) - 1, 6>;
+
+	constexpr FKeyTable::FEntry KnownKeys[] = {
+		{ "Type", EFModelKey::Type },
+		{ "Name", EFModelKey::Name },
+		{ "Class", EFModelKey::Class },
+		{ "Super", EFModelKey::Super },
+		{ "SuperStruct", EFModelKey::SuperStruct },
+		{ "Flags", EFModelKey::Flags },
+		{ "Properties", EFModelKey::Properties },
+		{ "Children", EFModelKey::Children },
+		{ "ChildProperties", EFModelKey::ChildProperties },
+		{ "FuncMap", EFModelKey::FuncMap },
+		{ "ClassFlags", EFModelKey::ClassFlags },
+		{ "ClassWithin", EFModelKey::ClassWithin },
+		{ "ClassConfigName", EFModelKey::ClassConfigName },
+		{ "bCooked", EFModelKey::bCooked },
+		{ "ClassDefaultObject", EFModelKey::ClassDefaultObject },
+		{ "EditorTags", EFModelKey::EditorTags },
+		{ "PropertyFlags", EFModelKey::PropertyFlags },
+		{ "ObjectName", EFModelKey::ObjectName },
+		{ "ObjectPath", EFModelKey::ObjectPath },
+		{ "PropertyClass", EFModelKey::PropertyClass },
+		{ "MetaClass", EFModelKey::MetaClass },
+		{ "Enum", EFModelKey::Enum },
+		{ "Struct", EFModelKey::Struct },
+		{ "Inner", EFModelKey::Inner },
+		{ "KeyProp", EFModelKey::KeyProp },
+		{ "ValueProp", EFModelKey::ValueProp },
+	};
+
+	/** FNV-1a offset basis + 645: the first seed that maps KnownKeys into the table without collisions */
+	constexpr FKeyTable KeyTable(KnownKeys, 2166136906u);
+	static_assert(KeyTable.IsCollisionFree(), "FModel key hash collides; search for a new seed after changing KnownKeys");
+
+	template <typename CharType>
+	EFModelKey LookupChars(const CharType* Chars, int32 Len)
+	{
+		const EFModelKey* Key = KeyTable.Find(Chars, Len);
+		return Key ? *Key : EFModelKey::Unknown;
+	}
+}
+
+EFModelKey FModelKeys::Lookup(const FFModelJsonString& Key)
+{
+	if (Key.bOwned)
+	{
+		return Lookup(FStringView(Key.Owned));
+	}
+
+	if (Key.bEscaped)
+	{
+		return Lookup(FStringView(Key.ToString()));
+	}
+
+	if (Key.Data == nullptr)
+	{
+		return EFModelKey::Unknown;
+	}
+
+	return Key.bUtf8
+		? LookupChars(static_cast<const UTF8CHAR*>(Key.Data), Key.Len)
+		: LookupChars(static_cast<const TCHAR*>(Key.Data), Key.Len);
+}
+
+EFModelKey FModelKeys::Lookup(FStringView Key)
+{
+	return LookupChars(Key.GetData(), Key.Len());
+}
+
+EFModelKey FModelKeys::Lookup(FUtf8StringView Key)
+{
+	return LookupChars(Key.GetData(), Key.Len());
+}
+
+bool FModelKeys::IsStructuralClassField(EFModelKey Key)
+{
+	switch (Key)
+	{
+	case EFModelKey::Type:
+	case EFModelKey::Name:
+	case EFModelKey::Class:
+	case EFModelKey::Super:
+	case EFModelKey::Flags:
+	case EFModelKey::Properties:
+	case EFModelKey::Children:
+	case EFModelKey::ChildProperties:
+	case EFModelKey::FuncMap:
+	case EFModelKey::ClassFlags:
+	case EFModelKey::ClassWithin:
+	case EFModelKey::ClassConfigName:
+	case EFModelKey::bCooked:
+	case EFModelKey::ClassDefaultObject:
+	case EFModelKey::EditorTags:
+		return true;
+	default:
+		return false;
+	}
+}
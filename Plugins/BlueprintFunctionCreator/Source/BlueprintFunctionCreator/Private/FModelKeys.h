@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FFModelJsonString;
+
+/** Every FModel export member name the importer reads */
+enum class EFModelKey : uint8
+{
+	Unknown,
+
+	// Entry members
+	Type,
+	Name,
+	Class,
+	Super,
+	SuperStruct,
+	Flags,
+	Properties,
+	Children,
+	ChildProperties,
+	FuncMap,
+	ClassFlags,
+	ClassWithin,
+	ClassConfigName,
+	bCooked,
+	ClassDefaultObject,
+	EditorTags,
+
+	// Property and object reference members
+	PropertyFlags,
+	ObjectName,
+	ObjectPath,
+	PropertyClass,
+	MetaClass,
+	Enum,
+	Struct,
+	Inner,
+	KeyProp,
+	ValueProp,
+
+	Count
+};
+
+/**
+ * Compile-time perfect hash over the known member names.
+ * Matching is ASCII case-insensitive, like FJsonObject field lookup, and costs one hash and one compare.
+ * Shared by the streaming parser, the DOM parser and the export classifier.
+ */
+namespace FModelKeys
+{
+	EFModelKey Lookup(const FFModelJsonString& Key);
+	EFModelKey Lookup(FStringView Key);
+	EFModelKey Lookup(FUtf8StringView Key);
+
+	/** True for the BlueprintGeneratedClass members that are never class-level variables */
+	bool IsStructuralClassField(EFModelKey Key);
+}
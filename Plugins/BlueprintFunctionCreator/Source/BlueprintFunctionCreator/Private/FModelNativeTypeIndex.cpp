@@ -0,0 +1,187 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelNativeTypeIndex.h"
+#include "FModelProbeOrder.h"
+#include "FModelTypeResolver.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/Package.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+	/** Ambiguities beyond this many are only counted */
+	constexpr int32 MaxLoggedAmbiguities = 20;
+
+	/** Every native type of one kind with a given short name; almost always exactly one */
+	using FCandidates = TArray<UField*, TInlineAllocator<1>>;
+
+	/** Native types are rooted for the lifetime of the process, so raw pointers stay valid */
+	TMap<FName, FCandidates> Classes;
+	TMap<FName, FCandidates> Structs;
+	TMap<FName, FCandidates> Enums;
+	FModelNativeTypeIndex::FBuildStats BuildStats;
+	bool bIsUpToDate = false;
+	FDelegateHandle ModulesChangedHandle;
+
+	const TCHAR* GetKindName(EFModelTypeKind Kind)
+	{
+		return Kind == EFModelTypeKind::Class ? TEXT("class") : Kind == EFModelTypeKind::Struct ? TEXT("struct") : TEXT("enum");
+	}
+
+	void AddType(TMap<FName, FCandidates>& Types, EFModelTypeKind Kind, UField* Type)
+	{
+		FCandidates& Candidates = Types.FindOrAdd(Type->GetFName());
+		if (Candidates.Num() == 1 && ++BuildStats.NumAmbiguous <= MaxLoggedAmbiguities)
+		{
+			UE_LOG(LogTemp, Log, TEXT("  Ambiguous native %s '%s': %s and %s"),
+				GetKindName(Kind), *Type->GetName(), *Candidates[0]->GetPathName(), *Type->GetPathName());
+		}
+		Candidates.Add(Type);
+	}
+
+	/**
+	 * The only type of that name, or the one whose module comes first in the configured probe order (then the
+	 * lowest path name). Learned hit counts are left out, so the choice never depends on earlier runs.
+	 */
+	template <typename T>
+	T* FindIndexed(const TMap<FName, FCandidates>& Types, EFModelTypeKind Kind, FName Name)
+	{
+		FModelNativeTypeIndex::EnsureBuilt();
+
+		const FCandidates* Candidates = Types.Find(Name);
+		if (!Candidates)
+		{
+			return nullptr;
+		}
+
+		UField* Best = (*Candidates)[0];
+		if (Candidates->Num() > 1)
+		{
+			int32 BestRank = FModelProbeOrder::GetConfiguredRank(Kind, FModelProbeOrder::GetModuleName(Best));
+			for (int32 Index = 1; Index < Candidates->Num(); ++Index)
+			{
+				// Object iteration order varies between processes: equal ranks go to the lower path name
+				UField* Candidate = (*Candidates)[Index];
+				const int32 Rank = FModelProbeOrder::GetConfiguredRank(Kind, FModelProbeOrder::GetModuleName(Candidate));
+				if (Rank < BestRank || (Rank == BestRank && Candidate->GetPathName() < Best->GetPathName()))
+				{
+					Best = Candidate;
+					BestRank = Rank;
+				}
+			}
+		}
+		return static_cast<T*>(Best);
+	}
+}
+
+namespace FModelNativeTypeIndex
+{
+	FBuildStats Build()
+	{
+		check(IsInGameThread());
+		const double StartTime = FPlatformTime::Seconds();
+
+		if (!ModulesChangedHandle.IsValid())
+		{
+			// Types of a module loaded later (a plugin enabled mid-session) are not in the sweep, and lookups
+			// the resolver remembers as misses may name them
+			ModulesChangedHandle = FModuleManager::Get().OnModulesChanged().AddLambda([](FName, EModuleChangeReason Reason)
+			{
+				if (Reason == EModuleChangeReason::ModuleLoaded)
+				{
+					bIsUpToDate = false;
+					FModelTypeResolver::ForgetMisses();
+				}
+			});
+		}
+
+		Classes.Reset();
+		Structs.Reset();
+		Enums.Reset();
+		BuildStats = FBuildStats();
+
+		// One pass over every UField; functions and properties are outered to their class, not a package
+		for (TObjectIterator<UField> It; It; ++It)
+		{
+			UField* Type = *It;
+			const UPackage* Package = Cast<UPackage>(Type->GetOuter());
+			if (!Package || !Package->HasAnyPackageFlags(PKG_CompiledIn))
+			{
+				continue;
+			}
+
+			if (UClass* Class = Cast<UClass>(Type))
+			{
+				// Left behind by a hot reload
+				if (!Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+				{
+					AddType(Classes, EFModelTypeKind::Class, Class);
+				}
+			}
+			else if (UScriptStruct* Struct = Cast<UScriptStruct>(Type))
+			{
+				AddType(Structs, EFModelTypeKind::Struct, Struct);
+			}
+			else if (UEnum* Enum = Cast<UEnum>(Type))
+			{
+				AddType(Enums, EFModelTypeKind::Enum, Enum);
+			}
+		}
+
+		bIsUpToDate = true;
+		BuildStats.NumClasses = Classes.Num();
+		BuildStats.NumStructs = Structs.Num();
+		BuildStats.NumEnums = Enums.Num();
+		BuildStats.Seconds = FPlatformTime::Seconds() - StartTime;
+
+		if (BuildStats.NumAmbiguous > MaxLoggedAmbiguities)
+		{
+			UE_LOG(LogTemp, Log, TEXT("  ... and %d more ambiguous native names"), BuildStats.NumAmbiguous - MaxLoggedAmbiguities);
+		}
+		UE_LOG(LogTemp, Log, TEXT("Native type index: %d classes, %d structs, %d enums in %.1fms (%d ambiguous short names)"),
+			BuildStats.NumClasses, BuildStats.NumStructs, BuildStats.NumEnums, BuildStats.Seconds * 1000.0, BuildStats.NumAmbiguous);
+
+		return BuildStats;
+	}
+
+	void EnsureBuilt()
+	{
+		if (!bIsUpToDate)
+		{
+			Build();
+		}
+	}
+
+	FBuildStats GetBuildStats()
+	{
+		return BuildStats;
+	}
+
+	UClass* FindClass(FName ClassName)
+	{
+		return FindIndexed<UClass>(Classes, EFModelTypeKind::Class, ClassName);
+	}
+
+	UScriptStruct* FindStruct(FName StructName)
+	{
+		return FindIndexed<UScriptStruct>(Structs, EFModelTypeKind::Struct, StructName);
+	}
+
+	UEnum* FindEnum(FName EnumName)
+	{
+		return FindIndexed<UEnum>(Enums, EFModelTypeKind::Enum, EnumName);
+	}
+
+	void Shutdown()
+	{
+		if (ModulesChangedHandle.IsValid())
+		{
+			FModuleManager::Get().OnModulesChanged().Remove(ModulesChangedHandle);
+			ModulesChangedHandle.Reset();
+		}
+		Classes.Empty();
+		Structs.Empty();
+		Enums.Empty();
+		bIsUpToDate = false;
+	}
+}
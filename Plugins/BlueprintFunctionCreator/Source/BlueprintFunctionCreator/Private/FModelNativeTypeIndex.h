@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Short name -> native UClass / UScriptStruct / UEnum, built from one sweep over the types of every
+ * compiled-in (/Script) package. Exports reference native types by short name only ("PalCharacter",
+ * "Vector", "EPalWazaID"), so this replaces guessing "/Script/<Module>.<Name>" per module.
+ * Native types are never loaded from disk, so a lookup never reaches the package loader.
+ * Game thread only.
+ */
+namespace FModelNativeTypeIndex
+{
+	struct FBuildStats
+	{
+		int32 NumClasses = 0;
+		int32 NumStructs = 0;
+		int32 NumEnums = 0;
+		/** Short names of one kind defined by more than one module */
+		int32 NumAmbiguous = 0;
+		double Seconds = 0.0;
+	};
+
+	/**
+	 * Sweep the loaded native types and replace the index. Two modules defining the same short name are
+	 * logged; lookups of such a name return the type whose module comes first in FModelProbeOrder's configured order.
+	 */
+	FBuildStats Build();
+
+	/** Build the index unless it is up to date; a module loaded since the last build makes it stale */
+	void EnsureBuilt();
+
+	/** Stats of the current index (all zero before the first build) */
+	FBuildStats GetBuildStats();
+
+	UClass* FindClass(FName ClassName);
+	UScriptStruct* FindStruct(FName StructName);
+	UEnum* FindEnum(FName EnumName);
+
+	/** Release the index and the module hook; called on module shutdown */
+	void Shutdown();
+}
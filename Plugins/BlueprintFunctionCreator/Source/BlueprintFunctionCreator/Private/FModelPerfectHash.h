@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Compile-time perfect hash from a fixed set of ASCII names (letters and digits) to values.
+ * Matching is case-insensitive. A lookup is one FNV-1a hash and one compare against the single candidate.
+ *
+ * Declare tables constexpr and static_assert IsCollisionFree(); when the name list changes,
+ * search for a new seed (any value that makes the assert pass).
+ */
+template <typename ValueType, int32 NumEntries, int32 TableBits>
+class TFModelPerfectHashTable
+{
+public:
+	struct FEntry
+	{
+		const ANSICHAR* Name;
+		ValueType Value;
+	};
+
+	constexpr TFModelPerfectHashTable(const FEntry (&InEntries)[NumEntries], uint32 InSeed)
+		: Seed(InSeed)
+	{
+		static_assert(NumEntries < 255, "Slots store entry index + 1 in a uint8");
+
+		for (int32 Index = 0; Index < NumEntries; ++Index)
+		{
+			Entries[Index] = InEntries[Index];
+
+			int32 Len = 0;
+			while (InEntries[Index].Name[Len] != '\0')
+			{
+				++Len;
+			}
+			Lengths[Index] = static_cast<uint8>(Len);
+			MaxLength = Len > MaxLength ? Len : MaxLength;
+
+			const uint32 Slot = HashSlot(InEntries[Index].Name, Len);
+			bCollisionFree = bCollisionFree && Slots[Slot] == 0;
+			Slots[Slot] = static_cast<uint8>(Index + 1);
+		}
+	}
+
+	constexpr bool IsCollisionFree() const { return bCollisionFree; }
+
+	/** The value for a name, or nullptr if it is not in the table */
+	template <typename CharType>
+	const ValueType* Find(const CharType* Chars, int32 Len) const
+	{
+		if (Len <= 0 || Len > MaxLength)
+		{
+			return nullptr;
+		}
+
+		const uint8 Slot = Slots[HashSlot(Chars, Len)];
+		if (Slot == 0 || Lengths[Slot - 1] != Len)
+		{
+			return nullptr;
+		}
+
+		const FEntry& Entry = Entries[Slot - 1];
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			if (FoldCase(static_cast<uint32>(Chars[Index])) != FoldCase(static_cast<uint32>(Entry.Name[Index])))
+			{
+				return nullptr;
+			}
+		}
+		return &Entry.Value;
+	}
+
+private:
+	static constexpr int32 TableSize = 1 << TableBits;
+	static constexpr uint32 HashPrime = 16777619u;
+
+	/**
+	 * ASCII case fold. Digits fold onto themselves and other non-letters onto non-letters, so only
+	 * control characters could alias a digit; type names never contain them.
+	 */
+	static constexpr uint32 FoldCase(uint32 C)
+	{
+		return C | 0x20;
+	}
+
+	template <typename CharType>
+	constexpr uint32 HashSlot(const CharType* Chars, int32 Len) const
+	{
+		uint32 Hash = Seed;
+		for (int32 Index = 0; Index < Len; ++Index)
+		{
+			Hash = (Hash ^ FoldCase(static_cast<uint32>(Chars[Index]))) * HashPrime;
+		}
+		return Hash >> (32 - TableBits);
+	}
+
+	FEntry Entries[NumEntries] = {};
+	uint8 Lengths[NumEntries] = {};
+	/** Entry index + 1, 0 for an empty slot */
+	uint8 Slots[TableSize] = {};
+	uint32 Seed = 0;
+	int32 MaxLength = 0;
+	bool bCollisionFree = true;
+};
@@ -0,0 +1,261 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelPinFixups.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "K2Node_FunctionResult.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+
+namespace
+{
+	TArray<FModelPinFixups::FPinFixup> Pending;
+
+	/** Missing classes, structs and enums; the ones a later asset can provide */
+	int32 CountDeferrable(const FModelTypeResolver::FUnresolvedTypes& Unresolved)
+	{
+		int32 Count = 0;
+		for (const FModelTypeResolver::FUnresolvedType& Type : Unresolved)
+		{
+			if (FCString::Strcmp(Type.Kind, TEXT("Property")) != 0 && FCString::Strcmp(Type.Kind, TEXT("Parent")) != 0)
+			{
+				++Count;
+			}
+		}
+		return Count;
+	}
+
+	FModelPinFixups::FPinFixup* AddIfDeferred(const UBlueprint* Blueprint, FName PinName, const FModelTypeResolver::FUnresolvedTypes& Unresolved)
+	{
+		const int32 NumDeferrable = CountDeferrable(Unresolved);
+		if (!Blueprint || NumDeferrable == 0)
+		{
+			return nullptr;
+		}
+
+		FModelPinFixups::FPinFixup& Fixup = Pending.AddDefaulted_GetRef();
+		Fixup.BlueprintPath = Blueprint->GetPathName();
+		Fixup.PinName = PinName;
+		Fixup.NumUnresolved = NumDeferrable;
+		return &Fixup;
+	}
+
+	bool PatchPin(UBlueprint* Blueprint, const FModelPinFixups::FPinFixup& Fixup, const FEdGraphPinType& PinType)
+	{
+		if (!Fixup.IsReturnPin())
+		{
+			if (FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, Fixup.PinName) == INDEX_NONE)
+			{
+				return false;
+			}
+			FBlueprintEditorUtils::ChangeMemberVariableType(Blueprint, Fixup.PinName, PinType);
+			return true;
+		}
+
+		UEdGraph* const* Graph = Blueprint->FunctionGraphs.FindByPredicate([&Fixup](const UEdGraph* Candidate)
+		{
+			return Candidate && Candidate->GetFName() == Fixup.GraphName;
+		});
+		if (!Graph)
+		{
+			return false;
+		}
+
+		bool bPatched = false;
+		TArray<UK2Node_FunctionResult*> ResultNodes;
+		(*Graph)->GetNodesOfClass(ResultNodes);
+		for (UK2Node_FunctionResult* ResultNode : ResultNodes)
+		{
+			for (const TSharedPtr<FUserPinInfo>& PinInfo : ResultNode->UserDefinedPins)
+			{
+				if (PinInfo.IsValid() && PinInfo->PinName == Fixup.PinName)
+				{
+					PinInfo->PinType = PinType;
+					ResultNode->ReconstructNode();
+					bPatched = true;
+					break;
+				}
+			}
+		}
+		return bPatched;
+	}
+
+	bool SaveBlueprint(UBlueprint* Blueprint)
+	{
+		UPackage* Package = Blueprint->GetOutermost();
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		const FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+		if (!UPackage::SavePackage(Package, Blueprint, *PackageFileName, SaveArgs))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to save Blueprint with patched pins: %s"), *PackageFileName);
+			return false;
+		}
+		return true;
+	}
+}
+
+namespace FModelPinFixups
+{
+	void RecordIfDeferred(const UBlueprint* Blueprint, FName GraphName, FName PinName, const FFModelTypeRef& ReturnType, const FModelTypeResolver::FUnresolvedTypes& Unresolved)
+	{
+		if (FPinFixup* Fixup = AddIfDeferred(Blueprint, PinName, Unresolved))
+		{
+			Fixup->GraphName = GraphName;
+			Fixup->ReturnType = ReturnType;
+		}
+	}
+
+	void RecordIfDeferred(const UBlueprint* Blueprint, FName VariableName, const FString& VariableType, const FModelTypeResolver::FUnresolvedTypes& Unresolved)
+	{
+		if (FPinFixup* Fixup = AddIfDeferred(Blueprint, VariableName, Unresolved))
+		{
+			Fixup->TypeString = VariableType;
+		}
+	}
+
+	void Add(FPinFixup&& Fixup)
+	{
+		Pending.Add(MoveTemp(Fixup));
+	}
+
+	void Forget(const UBlueprint* Blueprint)
+	{
+		const FString BlueprintPath = Blueprint->GetPathName();
+		Pending.RemoveAll([&BlueprintPath](const FPinFixup& Fixup) { return Fixup.BlueprintPath == BlueprintPath; });
+	}
+
+	int32 GetNumPending()
+	{
+		return Pending.Num();
+	}
+
+	TConstArrayView<FPinFixup> GetPending()
+	{
+		return Pending;
+	}
+
+	FApplyStats Apply(TArray<FPinFixup>* OutUnresolved)
+	{
+		check(IsInGameThread());
+		const double StartTime = FPlatformTime::Seconds();
+
+		FApplyStats Stats;
+		TArray<FPinFixup> Fixups = MoveTemp(Pending);
+		Pending.Reset();
+
+		// Patched in memory but not saved: kept for a later sweep, which patches and saves them again
+		TArray<FPinFixup> NotSaved;
+
+		// Grouped by Blueprint, so each one is loaded and saved once
+		Fixups.StableSort([](const FPinFixup& A, const FPinFixup& B) { return A.BlueprintPath < B.BlueprintPath; });
+
+		for (int32 First = 0; First < Fixups.Num();)
+		{
+			int32 End = First + 1;
+			while (End < Fixups.Num() && Fixups[End].BlueprintPath == Fixups[First].BlueprintPath)
+			{
+				++End;
+			}
+
+			UBlueprint* Blueprint = FindObject<UBlueprint>(nullptr, *Fixups[First].BlueprintPath);
+			if (!Blueprint)
+			{
+				Blueprint = LoadObject<UBlueprint>(nullptr, *Fixups[First].BlueprintPath);
+			}
+
+			int32 NumPatchedHere = 0;
+			TArray<int32, TInlineAllocator<8>> FullyPatched;
+			TArray<TPair<int32, int32>, TInlineAllocator<8>> StillUnresolved;
+			for (int32 Index = First; Index < End; ++Index)
+			{
+				FPinFixup& Fixup = Fixups[Index];
+
+				// Resolved exactly as when the pin was created, now that every asset exists
+				FModelTypeResolver::FUnresolvedTypes Unresolved;
+				FEdGraphPinType PinType;
+				bool bResolved = true;
+				if (Fixup.IsReturnPin())
+				{
+					PinType = FModelTypeResolver::ResolveReturnType(Fixup.ReturnType, &Unresolved);
+				}
+				else
+				{
+					bResolved = FModelTypeResolver::ResolveVariableType(Fixup.TypeString, PinType, &Unresolved);
+				}
+				const int32 NumStillUnresolved = Blueprint ? CountDeferrable(Unresolved) : Fixup.NumUnresolved;
+
+				if (Blueprint && bResolved && NumStillUnresolved < Fixup.NumUnresolved && PatchPin(Blueprint, Fixup, PinType))
+				{
+					UE_LOG(LogTemp, Log, TEXT("  Fixed up %s.%s: %s"), *Blueprint->GetName(), *Fixup.PinName.ToString(), *Fixup.GetTypeString());
+					++NumPatchedHere;
+					if (NumStillUnresolved == 0)
+					{
+						FullyPatched.Add(Index);
+					}
+				}
+
+				if (NumStillUnresolved > 0)
+				{
+					++Stats.NumUnresolved;
+					StillUnresolved.Emplace(Index, NumStillUnresolved);
+				}
+			}
+
+			bool bSaved = true;
+			if (NumPatchedHere > 0)
+			{
+				FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+				bSaved = SaveBlueprint(Blueprint);
+				if (bSaved)
+				{
+					Stats.NumPatched += NumPatchedHere;
+					++Stats.NumBlueprintsSaved;
+				}
+				else
+				{
+					++Stats.NumBlueprintsNotSaved;
+					Stats.NumUnresolved += FullyPatched.Num();
+					for (const int32 Index : FullyPatched)
+					{
+						NotSaved.Add(MoveTemp(Fixups[Index]));
+					}
+				}
+			}
+
+			if (OutUnresolved)
+			{
+				for (const TPair<int32, int32>& Entry : StillUnresolved)
+				{
+					FPinFixup& Fixup = Fixups[Entry.Key];
+					// A partial patch that was not saved must be applied again by the next sweep
+					if (bSaved)
+					{
+						Fixup.NumUnresolved = Entry.Value;
+					}
+					OutUnresolved->Add(MoveTemp(Fixup));
+				}
+			}
+
+			First = End;
+		}
+
+		if (OutUnresolved)
+		{
+			OutUnresolved->Append(MoveTemp(NotSaved));
+		}
+		else
+		{
+			Pending.Append(MoveTemp(NotSaved));
+		}
+
+		Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+		if (Fixups.Num() > 0)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Pin fixups: %d of %d patched, %d Blueprints saved, %d not saved, %d still pending in %.2fs"),
+				Stats.NumPatched, Fixups.Num(), Stats.NumBlueprintsSaved, Stats.NumBlueprintsNotSaved, Stats.NumUnresolved, Stats.Seconds);
+		}
+		return Stats;
+	}
+}
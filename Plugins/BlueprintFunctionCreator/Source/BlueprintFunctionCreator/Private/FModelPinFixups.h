@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelTypeResolver.h"
+
+class UBlueprint;
+
+/**
+ * Return pins and member variables that were created with a generic type because a class, struct or enum
+ * they name did not exist yet (typically a Blueprint later in the same import). Recorded as Blueprints are
+ * built and patched in one sweep once every asset exists, so no Blueprint has to be created twice.
+ * Game thread only.
+ */
+namespace FModelPinFixups
+{
+	struct FPinFixup
+	{
+		/** Object path of the Blueprint */
+		FString BlueprintPath;
+
+		/** Function graph whose result node holds the pin; None for a member variable */
+		FName GraphName;
+
+		/** Return pin or member variable */
+		FName PinName;
+
+		/** Member variable type as exported; resolved again by the sweep */
+		FString TypeString;
+
+		/** Return pin type as parsed; resolved again by the sweep */
+		FFModelTypeRef ReturnType;
+
+		/** Classes, structs and enums it named that were missing */
+		int32 NumUnresolved = 0;
+
+		bool IsReturnPin() const { return !GraphName.IsNone(); }
+
+		/** The type in string form, e.g. for a report or the import journal */
+		FString GetTypeString() const { return IsReturnPin() ? ReturnType.ToString() : TypeString; }
+
+		/** Read the type back from GetTypeString; set GraphName first */
+		void SetTypeString(const FString& Type)
+		{
+			if (IsReturnPin())
+			{
+				ReturnType = FFModelTypeRef::Parse(Type);
+			}
+			else
+			{
+				TypeString = Type;
+			}
+		}
+	};
+
+	struct FApplyStats
+	{
+		/** Pins and variables given a more specific type and saved */
+		int32 NumPatched = 0;
+		/** Fixups still pending after the sweep: they name a missing type, or their Blueprint could not be saved */
+		int32 NumUnresolved = 0;
+		int32 NumBlueprintsSaved = 0;
+		/** Blueprints whose patched pins could not be saved; their fixups stay pending */
+		int32 NumBlueprintsNotSaved = 0;
+		double Seconds = 0.0;
+	};
+
+	/**
+	 * Record a pin if resolving its type left classes, structs or enums unresolved
+	 * (unknown property kinds cannot get better later and are not recorded)
+	 */
+	void RecordIfDeferred(const UBlueprint* Blueprint, FName GraphName, FName PinName, const FFModelTypeRef& ReturnType, const FModelTypeResolver::FUnresolvedTypes& Unresolved);
+	void RecordIfDeferred(const UBlueprint* Blueprint, FName VariableName, const FString& VariableType, const FModelTypeResolver::FUnresolvedTypes& Unresolved);
+
+	/** Record a fixup carried over from elsewhere, e.g. a shard process's report */
+	void Add(FPinFixup&& Fixup);
+
+	/** Drop the fixups of a Blueprint that is being discarded, e.g. because its package could not be saved */
+	void Forget(const UBlueprint* Blueprint);
+
+	int32 GetNumPending();
+
+	/** Every recorded fixup, in recording order, e.g. to persist the ones recorded since GetNumPending was last read */
+	TConstArrayView<FPinFixup> GetPending();
+
+	/**
+	 * Resolve every recorded pin again, patch those that now resolve further and save each touched Blueprint once.
+	 * Consumes the recorded fixups, except those of Blueprints that could not be saved: without OutUnresolved
+	 * they stay recorded for the next sweep.
+	 * @param OutUnresolved - Optional; receives the fixups that still name a missing type or could not be saved
+	 */
+	FApplyStats Apply(TArray<FPinFixup>* OutUnresolved = nullptr);
+}
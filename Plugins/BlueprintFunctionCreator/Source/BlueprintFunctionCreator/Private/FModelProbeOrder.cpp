@@ -0,0 +1,210 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelProbeOrder.h"
+#include "Misc/ConfigCacheIni.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	const TCHAR* const ConfigSection = TEXT("FModelImport.ProbeOrder");
+	const TCHAR* const KindNames[] = { TEXT("Class"), TEXT("Struct"), TEXT("Enum") };
+
+	/** Used when DefaultEditor.ini lists no modules for a kind; the order the importer has always probed in */
+	const TCHAR* const DefaultClassModules[] = { TEXT("/Game"), TEXT("Pal"), TEXT("Engine"), TEXT("Niagara"), TEXT("CoreUObject") };
+	const TCHAR* const DefaultStructModules[] = { TEXT("/Game"), TEXT("CoreUObject"), TEXT("Engine"), TEXT("Pal") };
+	const TCHAR* const DefaultEnumModules[] = { TEXT("Pal"), TEXT("Engine"), TEXT("CoreUObject"), TEXT("/Game") };
+
+	/** Save halves both counts of a kind once they add up to more than this */
+	constexpr int64 MaxSavedHits = 10000;
+
+	struct FKindOrder
+	{
+		/** Configured modules, in order; the index is the configured rank */
+		TArray<FName> Modules;
+		/** The first configured module is a content root ("/Game") rather than a /Script module */
+		bool bConfiguredContentFirst = true;
+		FModelProbeOrder::FHits Hits;
+		/** Of Hits, those recorded by this process */
+		FModelProbeOrder::FHits SessionHits;
+	};
+
+	FKindOrder Orders[static_cast<int32>(EFModelTypeKind::Num)];
+	FModelProbeOrder::FStats Stats;
+	bool bAdaptive = true;
+	bool bLoaded = false;
+	bool bSaveEnabled = true;
+
+	void AddTo(FModelProbeOrder::FHits& To, const FModelProbeOrder::FHits& Hits)
+	{
+		To.NumContent += Hits.NumContent;
+		To.NumNative += Hits.NumNative;
+	}
+
+	void LoadOnce()
+	{
+		if (bLoaded)
+		{
+			return;
+		}
+		bLoaded = true;
+
+		GConfig->GetBool(ConfigSection, TEXT("bAdaptive"), bAdaptive, GEditorIni);
+
+		const TArrayView<const TCHAR* const> Defaults[] = { DefaultClassModules, DefaultStructModules, DefaultEnumModules };
+		for (int32 KindIndex = 0; KindIndex < UE_ARRAY_COUNT(Orders); ++KindIndex)
+		{
+			FKindOrder& Order = Orders[KindIndex];
+
+			TArray<FString> Modules;
+			GConfig->GetArray(ConfigSection, *FString::Printf(TEXT("%sModules"), KindNames[KindIndex]), Modules, GEditorIni);
+			if (Modules.Num() == 0)
+			{
+				for (const TCHAR* Module : Defaults[KindIndex])
+				{
+					Modules.Add(Module);
+				}
+			}
+			for (const FString& Module : Modules)
+			{
+				Order.Modules.AddUnique(FName(*Module));
+			}
+			Order.bConfiguredContentFirst = Modules[0].StartsWith(TEXT("/"));
+
+			// "Content=Hits" and "Native=Hits", written by Save()
+			TArray<FString> Hits;
+			GConfig->GetArray(ConfigSection, *FString::Printf(TEXT("%sHits"), KindNames[KindIndex]), Hits, GEditorPerProjectIni);
+			for (const FString& Hit : Hits)
+			{
+				FString Side;
+				FString Count;
+				if (!Hit.Split(TEXT("="), &Side, &Count))
+				{
+					continue;
+				}
+				const int64 NumHits = FMath::Max<int64>(FCString::Atoi64(*Count), 0);
+				if (Side == TEXT("Content"))
+				{
+					Order.Hits.NumContent += NumHits;
+				}
+				else if (Side == TEXT("Native"))
+				{
+					Order.Hits.NumNative += NumHits;
+				}
+			}
+		}
+	}
+}
+
+namespace FModelProbeOrder
+{
+	int32 GetConfiguredRank(EFModelTypeKind Kind, FName Module)
+	{
+		LoadOnce();
+		const TArray<FName>& Modules = Orders[static_cast<int32>(Kind)].Modules;
+		const int32 Rank = Modules.IndexOfByKey(Module);
+		return Rank != INDEX_NONE ? Rank : Modules.Num();
+	}
+
+	bool IsContentFirst(EFModelTypeKind Kind)
+	{
+		LoadOnce();
+		const FKindOrder& Order = Orders[static_cast<int32>(Kind)];
+		if (bAdaptive && Order.Hits.NumContent != Order.Hits.NumNative)
+		{
+			return Order.Hits.NumContent > Order.Hits.NumNative;
+		}
+		return Order.bConfiguredContentFirst;
+	}
+
+	void RecordHit(EFModelTypeKind Kind, bool bContent)
+	{
+		LoadOnce();
+		FKindOrder& Order = Orders[static_cast<int32>(Kind)];
+		++(bContent ? Order.Hits.NumContent : Order.Hits.NumNative);
+		++(bContent ? Order.SessionHits.NumContent : Order.SessionHits.NumNative);
+	}
+
+	void RecordLookup(bool bFound, int32 NumProbes)
+	{
+		if (!bFound)
+		{
+			++Stats.NumUnresolved;
+			return;
+		}
+
+		++Stats.NumResolved;
+		Stats.NumResolvedProbes += NumProbes;
+	}
+
+	FName GetModuleName(const UObject* Type)
+	{
+		// "/Script/Pal" -> "Pal", "/Game/Pal/Blueprint/BP_Foo" -> "/Game"
+		FString PackageName = Type->GetOutermost()->GetName();
+		if (PackageName.RemoveFromStart(TEXT("/Script/")))
+		{
+			return FName(*PackageName);
+		}
+
+		const int32 RootEnd = PackageName.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, 1);
+		if (RootEnd != INDEX_NONE)
+		{
+			PackageName.LeftInline(RootEnd);
+		}
+		return FName(*PackageName);
+	}
+
+	FStats GetStats()
+	{
+		return Stats;
+	}
+
+	FHits GetSessionHits(EFModelTypeKind Kind)
+	{
+		LoadOnce();
+		return Orders[static_cast<int32>(Kind)].SessionHits;
+	}
+
+	void AddHits(EFModelTypeKind Kind, const FHits& Hits)
+	{
+		if (Hits.NumContent < 0 || Hits.NumNative < 0)
+		{
+			return;
+		}
+
+		LoadOnce();
+		FKindOrder& Order = Orders[static_cast<int32>(Kind)];
+		AddTo(Order.Hits, Hits);
+		AddTo(Order.SessionHits, Hits);
+	}
+
+	void SetSaveEnabled(bool bEnabled)
+	{
+		bSaveEnabled = bEnabled;
+	}
+
+	void Save()
+	{
+		if (!bLoaded || !bSaveEnabled || !GConfig)
+		{
+			return;
+		}
+
+		for (int32 KindIndex = 0; KindIndex < UE_ARRAY_COUNT(Orders); ++KindIndex)
+		{
+			FHits& Hits = Orders[KindIndex].Hits;
+			while (Hits.NumContent + Hits.NumNative > MaxSavedHits)
+			{
+				// Roughly keeps the ratio, so the side tried first stays, while older runs weigh less each time
+				Hits.NumContent /= 2;
+				Hits.NumNative /= 2;
+			}
+
+			const TArray<FString> SavedHits = {
+				FString::Printf(TEXT("Content=%lld"), Hits.NumContent),
+				FString::Printf(TEXT("Native=%lld"), Hits.NumNative),
+			};
+			GConfig->SetArray(ConfigSection, *FString::Printf(TEXT("%sHits"), KindNames[KindIndex]), SavedHits, GEditorPerProjectIni);
+		}
+		GConfig->Flush(false, GEditorPerProjectIni);
+	}
+}
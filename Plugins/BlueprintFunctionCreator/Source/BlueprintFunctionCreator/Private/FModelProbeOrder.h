@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** What a type reference names; lookups and probe statistics are kept per kind */
+enum class EFModelTypeKind : uint8
+{
+	Class,
+	Struct,
+	Enum,
+	Num,
+};
+
+/**
+ * Whether the type resolver tries content (Blueprints, UserDefinedStructs) or native types first, per kind.
+ * Both sides are one index lookup each (FModelAssetIndex, FModelNativeTypeIndex), so that choice is the only
+ * thing an order decides. The configured module order comes from DefaultEditor.ini:
+ *
+ *   [FModelImport.ProbeOrder]
+ *   bAdaptive=True
+ *   +ClassModules=/Game
+ *   +ClassModules=Pal
+ *   ...
+ *
+ * Its first module picks the starting side, and its ranks decide which native module wins a short name that
+ * several define. With bAdaptive, each kind counts how many lookups each side resolved and tries the side with
+ * more hits first. The counts are kept in EditorPerProjectUserSettings.ini, so the next run starts from them;
+ * Save halves them once they pass a cap, so the choice follows recent runs rather than the first one.
+ * Hit counts never change which of several same-named types wins.
+ * Game thread only.
+ */
+namespace FModelProbeOrder
+{
+	struct FStats
+	{
+		/** Probed lookups (cache hits are not counted) that found their type */
+		int32 NumResolved = 0;
+		int32 NumUnresolved = 0;
+		/** Locations tried by the lookups that found their type */
+		int32 NumResolvedProbes = 0;
+
+		double GetAverageProbesPerResolved() const
+		{
+			return NumResolved > 0 ? double(NumResolvedProbes) / NumResolved : 0.0;
+		}
+	};
+
+	/** Lookups of one kind that each side resolved */
+	struct FHits
+	{
+		int64 NumContent = 0;
+		int64 NumNative = 0;
+	};
+
+	/**
+	 * Position of Module in the configured order for Kind; every module that is not configured shares the rank
+	 * after the configured ones. Decides between types that share a short name.
+	 */
+	int32 GetConfiguredRank(EFModelTypeKind Kind, FName Module);
+
+	/** Whether content should be tried before native types for Kind */
+	bool IsContentFirst(EFModelTypeKind Kind);
+
+	/**
+	 * Count a type found by trying content and native types in IsContentFirst order. Lookups settled before
+	 * that (e.g. by a /Script path in the export) say nothing about which side to try first and are not counted.
+	 * @param bContent - Whether the content side found it
+	 */
+	void RecordHit(EFModelTypeKind Kind, bool bContent);
+
+	/**
+	 * Count one probed lookup for the stats
+	 * @param bFound - Whether it found its type
+	 * @param NumProbes - Locations tried
+	 */
+	void RecordLookup(bool bFound, int32 NumProbes);
+
+	/** "Pal" for a type in /Script/Pal, "/Game" for one under /Game/ */
+	FName GetModuleName(const UObject* Type);
+
+	FStats GetStats();
+
+	/** Hits recorded by this process, e.g. for a shard to hand to its coordinator */
+	FHits GetSessionHits(EFModelTypeKind Kind);
+
+	/** Count hits recorded by another process, e.g. a shard */
+	void AddHits(EFModelTypeKind Kind, const FHits& Hits);
+
+	/**
+	 * Whether Save writes the hit counts (default true). Shard processes turn it off: each learns on its own,
+	 * and their coordinator merges their hits and saves once instead of the last shard to finish winning.
+	 */
+	void SetSaveEnabled(bool bEnabled);
+
+	/** Persist the hit counts; called after each import and on module shutdown */
+	void Save();
+}
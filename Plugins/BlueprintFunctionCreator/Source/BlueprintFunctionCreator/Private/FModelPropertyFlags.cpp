@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelPropertyFlags.h"
+#include "FModelJsonCursor.h"
+#include "FModelPerfectHash.h"
+
+namespace
+{
+	constexpr int32 NumKnownFlags = 49;
+	using FFlagTable = TFModelPerfectHashTable<EPropertyFlags, NumKnownFlags, 8>;
+
+	/** Flag names without the CPF_ prefix; only flags that are stable across engine versions */
+	constexpr FFlagTable::FEntry KnownFlags[] = {
+		{ "Edit", CPF_Edit },
+		{ "ConstParm", CPF_ConstParm },
+		{ "BlueprintVisible", CPF_BlueprintVisible },
+		{ "ExportObject", CPF_ExportObject },
+		{ "BlueprintReadOnly", CPF_BlueprintReadOnly },
+		{ "Net", CPF_Net },
+		{ "EditFixedSize", CPF_EditFixedSize },
+		{ "Parm", CPF_Parm },
+		{ "OutParm", CPF_OutParm },
+		{ "ZeroConstructor", CPF_ZeroConstructor },
+		{ "ReturnParm", CPF_ReturnParm },
+		{ "DisableEditOnTemplate", CPF_DisableEditOnTemplate },
+		{ "Transient", CPF_Transient },
+		{ "Config", CPF_Config },
+		{ "DisableEditOnInstance", CPF_DisableEditOnInstance },
+		{ "EditConst", CPF_EditConst },
+		{ "GlobalConfig", CPF_GlobalConfig },
+		{ "InstancedReference", CPF_InstancedReference },
+		{ "DuplicateTransient", CPF_DuplicateTransient },
+		{ "SaveGame", CPF_SaveGame },
+		{ "NoClear", CPF_NoClear },
+		{ "ReferenceParm", CPF_ReferenceParm },
+		{ "BlueprintAssignable", CPF_BlueprintAssignable },
+		{ "Deprecated", CPF_Deprecated },
+		{ "IsPlainOldData", CPF_IsPlainOldData },
+		{ "RepSkip", CPF_RepSkip },
+		{ "RepNotify", CPF_RepNotify },
+		{ "Interp", CPF_Interp },
+		{ "NonTransactional", CPF_NonTransactional },
+		{ "EditorOnly", CPF_EditorOnly },
+		{ "NoDestructor", CPF_NoDestructor },
+		{ "AutoWeak", CPF_AutoWeak },
+		{ "ContainsInstancedReference", CPF_ContainsInstancedReference },
+		{ "AssetRegistrySearchable", CPF_AssetRegistrySearchable },
+		{ "SimpleDisplay", CPF_SimpleDisplay },
+		{ "AdvancedDisplay", CPF_AdvancedDisplay },
+		{ "Protected", CPF_Protected },
+		{ "BlueprintCallable", CPF_BlueprintCallable },
+		{ "BlueprintAuthorityOnly", CPF_BlueprintAuthorityOnly },
+		{ "TextExportTransient", CPF_TextExportTransient },
+		{ "NonPIEDuplicateTransient", CPF_NonPIEDuplicateTransient },
+		{ "ExposeOnSpawn", CPF_ExposeOnSpawn },
+		{ "PersistentInstance", CPF_PersistentInstance },
+		{ "UObjectWrapper", CPF_UObjectWrapper },
+		{ "HasGetValueTypeHash", CPF_HasGetValueTypeHash },
+		{ "NativeAccessSpecifierPublic", CPF_NativeAccessSpecifierPublic },
+		{ "NativeAccessSpecifierProtected", CPF_NativeAccessSpecifierProtected },
+		{ "NativeAccessSpecifierPrivate", CPF_NativeAccessSpecifierPrivate },
+		{ "SkipSerialization", CPF_SkipSerialization },
+	};
+
+	/** FNV-1a offset basis + 595: the first seed that maps KnownFlags into the table without collisions */
+	constexpr FFlagTable FlagTable(KnownFlags, 2166136856u);
+	static_assert(FlagTable.IsCollisionFree(), "Property flag hash collides; search for a new seed after changing KnownFlags");
+
+	bool IsTokenChar(uint32 C)
+	{
+		return (C >= 'a' && C <= 'z') || (C >= 'A' && C <= 'Z') || (C >= '0' && C <= '9') || C == '_';
+	}
+
+	template <typename CharType>
+	EPropertyFlags ParseChars(const CharType* Chars, int32 Len)
+	{
+		EPropertyFlags Flags = CPF_None;
+
+		int32 Index = 0;
+		while (Index < Len)
+		{
+			if (!IsTokenChar(static_cast<uint32>(Chars[Index])))
+			{
+				++Index;
+				continue;
+			}
+
+			int32 TokenStart = Index;
+			while (Index < Len && IsTokenChar(static_cast<uint32>(Chars[Index])))
+			{
+				++Index;
+			}
+
+			// Strip the optional CPF_ prefix
+			if (Index - TokenStart > 4
+				&& (static_cast<uint32>(Chars[TokenStart]) | 0x20) == 'c'
+				&& (static_cast<uint32>(Chars[TokenStart + 1]) | 0x20) == 'p'
+				&& (static_cast<uint32>(Chars[TokenStart + 2]) | 0x20) == 'f'
+				&& Chars[TokenStart + 3] == '_')
+			{
+				TokenStart += 4;
+			}
+
+			if (const EPropertyFlags* Flag = FlagTable.Find(Chars + TokenStart, Index - TokenStart))
+			{
+				Flags |= *Flag;
+			}
+		}
+
+		return Flags;
+	}
+}
+
+EPropertyFlags FModelPropertyFlags::Parse(const FFModelJsonString& FlagsText)
+{
+	if (FlagsText.bOwned)
+	{
+		return Parse(FStringView(FlagsText.Owned));
+	}
+
+	if (FlagsText.bEscaped)
+	{
+		return Parse(FStringView(FlagsText.ToString()));
+	}
+
+	if (FlagsText.Data == nullptr)
+	{
+		return CPF_None;
+	}
+
+	return FlagsText.bUtf8
+		? ParseChars(static_cast<const UTF8CHAR*>(FlagsText.Data), FlagsText.Len)
+		: ParseChars(static_cast<const TCHAR*>(FlagsText.Data), FlagsText.Len);
+}
+
+EPropertyFlags FModelPropertyFlags::Parse(FStringView FlagsText)
+{
+	return ParseChars(FlagsText.GetData(), FlagsText.Len());
+}
+
+EPropertyFlags FModelPropertyFlags::Parse(FUtf8StringView FlagsText)
+{
+	return ParseChars(FlagsText.GetData(), FlagsText.Len());
+}
@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+
+struct FFModelJsonString;
+
+/**
+ * Converts FModel "PropertyFlags" strings ("CPF_Parm | CPF_OutParm", "Parm, ReturnParm", ...) into EPropertyFlags.
+ * Each property's flags are tokenized once at parse time so classification is a mask test.
+ */
+namespace FModelPropertyFlags
+{
+	/**
+	 * Parse a flags string. Tokens may be separated by '|', ',' or whitespace and may carry a "CPF_" prefix.
+	 * Unknown tokens are ignored.
+	 * @param FlagsText - The raw PropertyFlags value
+	 * @return The recognized flags, CPF_None if there were none
+	 */
+	EPropertyFlags Parse(const FFModelJsonString& FlagsText);
+	EPropertyFlags Parse(FStringView FlagsText);
+	EPropertyFlags Parse(FUtf8StringView FlagsText);
+}
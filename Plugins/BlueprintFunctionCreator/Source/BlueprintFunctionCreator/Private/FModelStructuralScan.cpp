@@ -0,0 +1,195 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelStructuralScan.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+	#include <emmintrin.h>
+	#if PLATFORM_ALWAYS_HAS_AVX_2
+		#include <immintrin.h>
+		#define FMODEL_SCAN_AVX2 1
+	#endif
+	#define FMODEL_SCAN_SSE2 1
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+	#include <arm_neon.h>
+	#define FMODEL_SCAN_NEON 1
+#endif
+
+#ifndef FMODEL_SCAN_AVX2
+	#define FMODEL_SCAN_AVX2 0
+#endif
+#ifndef FMODEL_SCAN_SSE2
+	#define FMODEL_SCAN_SSE2 0
+#endif
+#ifndef FMODEL_SCAN_NEON
+	#define FMODEL_SCAN_NEON 0
+#endif
+
+namespace
+{
+	/**
+	 * '[' (0x5B) and '{' (0x7B), and ']' (0x5D) and '}' (0x7D), differ only in bit 5,
+	 * so OR-ing 0x20 in lets one compare match each pair.
+	 */
+	constexpr uint8 BracketFoldBit = 0x20;
+
+	FORCEINLINE bool IsStructuralByte(uint8 C)
+	{
+		const uint8 Folded = C | BracketFoldBit;
+		return C == '"' || C == '\\' || Folded == '{' || Folded == '}';
+	}
+
+	FORCEINLINE bool IsStringSpecialByte(uint8 C)
+	{
+		return C == '"' || C == '\\';
+	}
+
+#if FMODEL_SCAN_AVX2
+	template <bool bStringOnly>
+	FORCEINLINE uint32 MatchMask32(const uint8* P)
+	{
+		const __m256i Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(P));
+		__m256i Hits = _mm256_or_si256(_mm256_cmpeq_epi8(Block, _mm256_set1_epi8('"')), _mm256_cmpeq_epi8(Block, _mm256_set1_epi8('\\')));
+		if (!bStringOnly)
+		{
+			const __m256i Folded = _mm256_or_si256(Block, _mm256_set1_epi8(BracketFoldBit));
+			Hits = _mm256_or_si256(Hits, _mm256_cmpeq_epi8(Folded, _mm256_set1_epi8('{')));
+			Hits = _mm256_or_si256(Hits, _mm256_cmpeq_epi8(Folded, _mm256_set1_epi8('}')));
+		}
+		return static_cast<uint32>(_mm256_movemask_epi8(Hits));
+	}
+#endif
+
+#if FMODEL_SCAN_SSE2
+	template <bool bStringOnly>
+	FORCEINLINE uint32 MatchMask16(const uint8* P)
+	{
+		const __m128i Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(P));
+		__m128i Hits = _mm_or_si128(_mm_cmpeq_epi8(Block, _mm_set1_epi8('"')), _mm_cmpeq_epi8(Block, _mm_set1_epi8('\\')));
+		if (!bStringOnly)
+		{
+			const __m128i Folded = _mm_or_si128(Block, _mm_set1_epi8(BracketFoldBit));
+			Hits = _mm_or_si128(Hits, _mm_cmpeq_epi8(Folded, _mm_set1_epi8('{')));
+			Hits = _mm_or_si128(Hits, _mm_cmpeq_epi8(Folded, _mm_set1_epi8('}')));
+		}
+		return static_cast<uint32>(_mm_movemask_epi8(Hits));
+	}
+#endif
+
+#if FMODEL_SCAN_NEON
+	/** NEON has no movemask; narrowing by 4 bits per lane gives a 64-bit mask with a nibble per byte */
+	template <bool bStringOnly>
+	FORCEINLINE uint64 MatchNibbleMask16(const uint8* P)
+	{
+		const uint8x16_t Block = vld1q_u8(P);
+		uint8x16_t Hits = vorrq_u8(vceqq_u8(Block, vdupq_n_u8('"')), vceqq_u8(Block, vdupq_n_u8('\\')));
+		if (!bStringOnly)
+		{
+			const uint8x16_t Folded = vorrq_u8(Block, vdupq_n_u8(BracketFoldBit));
+			Hits = vorrq_u8(Hits, vceqq_u8(Folded, vdupq_n_u8('{')));
+			Hits = vorrq_u8(Hits, vceqq_u8(Folded, vdupq_n_u8('}')));
+		}
+		const uint8x8_t Narrowed = vshrn_n_u16(vreinterpretq_u16_u8(Hits), 4);
+		return vget_lane_u64(vreinterpret_u64_u8(Narrowed), 0);
+	}
+#endif
+
+	template <bool bStringOnly>
+	const uint8* FindNext(const uint8* Cur, const uint8* End)
+	{
+#if FMODEL_SCAN_AVX2
+		while (End - Cur >= 32)
+		{
+			if (const uint32 Mask = MatchMask32<bStringOnly>(Cur))
+			{
+				return Cur + FMath::CountTrailingZeros(Mask);
+			}
+			Cur += 32;
+		}
+#endif
+
+#if FMODEL_SCAN_SSE2
+		while (End - Cur >= 16)
+		{
+			if (const uint32 Mask = MatchMask16<bStringOnly>(Cur))
+			{
+				return Cur + FMath::CountTrailingZeros(Mask);
+			}
+			Cur += 16;
+		}
+#elif FMODEL_SCAN_NEON
+		while (End - Cur >= 16)
+		{
+			if (const uint64 Mask = MatchNibbleMask16<bStringOnly>(Cur))
+			{
+				return Cur + (FMath::CountTrailingZeros64(Mask) >> 2);
+			}
+			Cur += 16;
+		}
+#endif
+
+		for (; Cur < End; ++Cur)
+		{
+			if (bStringOnly ? IsStringSpecialByte(*Cur) : IsStructuralByte(*Cur))
+			{
+				return Cur;
+			}
+		}
+		return End;
+	}
+
+	FORCEINLINE const uint8* AsBytes(const UTF8CHAR* P)
+	{
+		return reinterpret_cast<const uint8*>(P);
+	}
+
+	FORCEINLINE const UTF8CHAR* AsChars(const uint8* P)
+	{
+		return reinterpret_cast<const UTF8CHAR*>(P);
+	}
+}
+
+const UTF8CHAR* FModelStructuralScan::FindStructural(const UTF8CHAR* Cur, const UTF8CHAR* End)
+{
+	return AsChars(FindNext<false>(AsBytes(Cur), AsBytes(End)));
+}
+
+const UTF8CHAR* FModelStructuralScan::FindStringSpecial(const UTF8CHAR* Cur, const UTF8CHAR* End)
+{
+	return AsChars(FindNext<true>(AsBytes(Cur), AsBytes(End)));
+}
+
+const UTF8CHAR* FModelStructuralScan::FindStringEnd(const UTF8CHAR* Cur, const UTF8CHAR* End, bool& bOutEscaped)
+{
+	while (Cur < End)
+	{
+		Cur = FindStringSpecial(Cur, End);
+		if (Cur >= End)
+		{
+			break;
+		}
+		if (static_cast<uint8>(*Cur) == '"')
+		{
+			return Cur;
+		}
+
+		// Backslash: the next byte is escaped, whatever it is (\uXXXX digits are never special).
+		// A torn export can end on the backslash, so never step past End
+		bOutEscaped = true;
+		Cur += FMath::Min<int64>(2, End - Cur);
+	}
+	return End;
+}
+
+const UTF8CHAR* FModelStructuralScan::SkipWhitespace(const UTF8CHAR* Cur, const UTF8CHAR* End)
+{
+	while (Cur < End)
+	{
+		const uint8 C = static_cast<uint8>(*Cur);
+		if (C != ' ' && C != '\n' && C != '\r' && C != '\t')
+		{
+			break;
+		}
+		++Cur;
+	}
+	return Cur;
+}
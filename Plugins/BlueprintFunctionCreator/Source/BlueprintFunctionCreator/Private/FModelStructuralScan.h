@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Vectorized search for JSON structural bytes in UTF-8 text.
+ * Uses AVX2 when the target always has it, SSE2 on other x86 targets, NEON on 64-bit ARM,
+ * and a scalar loop elsewhere and for the tail of every buffer.
+ */
+namespace FModelStructuralScan
+{
+	/** First '"', '\\', '{', '}', '[' or ']' in [Cur, End), or End */
+	const UTF8CHAR* FindStructural(const UTF8CHAR* Cur, const UTF8CHAR* End);
+
+	/** First '"' or '\\' in [Cur, End), or End */
+	const UTF8CHAR* FindStringSpecial(const UTF8CHAR* Cur, const UTF8CHAR* End);
+
+	/**
+	 * Find the closing quote of a string whose body starts at Cur (just past the opening quote).
+	 * @param bOutEscaped - Set to true if the body contains escape sequences
+	 * @return The closing quote, or End if the string is unterminated
+	 */
+	const UTF8CHAR* FindStringEnd(const UTF8CHAR* Cur, const UTF8CHAR* End, bool& bOutEscaped);
+
+	/** First byte in [Cur, End) that is not JSON whitespace, or End */
+	const UTF8CHAR* SkipWhitespace(const UTF8CHAR* Cur, const UTF8CHAR* End);
+}
@@ -0,0 +1,259 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelTypeRef.h"
+#include "FModelPerfectHash.h"
+
+namespace
+{
+	constexpr int32 NumNamedKinds = 23;
+	using FKindTable = TFModelPerfectHashTable<EFModelPropertyKind, NumNamedKinds, 6>;
+
+	constexpr FKindTable::FEntry NamedKinds[] = {
+		{ "VOID", EFModelPropertyKind::Void },
+		{ "BoolProperty", EFModelPropertyKind::Bool },
+		{ "ByteProperty", EFModelPropertyKind::Byte },
+		{ "IntProperty", EFModelPropertyKind::Int },
+		{ "Int64Property", EFModelPropertyKind::Int64 },
+		{ "FloatProperty", EFModelPropertyKind::Float },
+		{ "DoubleProperty", EFModelPropertyKind::Double },
+		{ "StrProperty", EFModelPropertyKind::Str },
+		{ "NameProperty", EFModelPropertyKind::Name },
+		{ "TextProperty", EFModelPropertyKind::Text },
+		{ "EnumProperty", EFModelPropertyKind::Enum },
+		{ "StructProperty", EFModelPropertyKind::Struct },
+		{ "ObjectProperty", EFModelPropertyKind::Object },
+		{ "ClassProperty", EFModelPropertyKind::Class },
+		{ "SoftObjectProperty", EFModelPropertyKind::SoftObject },
+		{ "SoftClassProperty", EFModelPropertyKind::SoftClass },
+		{ "WeakObjectProperty", EFModelPropertyKind::WeakObject },
+		{ "InterfaceProperty", EFModelPropertyKind::Interface },
+		{ "DelegateProperty", EFModelPropertyKind::Delegate },
+		{ "MulticastDelegateProperty", EFModelPropertyKind::MulticastDelegate },
+		{ "MulticastInlineDelegateProperty", EFModelPropertyKind::MulticastInlineDelegate },
+		{ "ArrayProperty", EFModelPropertyKind::Array },
+		{ "MapProperty", EFModelPropertyKind::Map },
+	};
+
+	/** FNV-1a offset basis + 112: the first seed that maps NamedKinds into the table without collisions */
+	constexpr FKindTable KindTable(NamedKinds, 2166136373u);
+	static_assert(KindTable.IsCollisionFree(), "Property kind hash collides; search for a new seed after changing NamedKinds");
+
+	/** Exported name of each kind, indexed by EFModelPropertyKind */
+	const TCHAR* const ExportedKindNames[] = {
+		TEXT(""),
+		TEXT("VOID"),
+		TEXT(""),
+		TEXT("BoolProperty"),
+		TEXT("ByteProperty"),
+		TEXT("IntProperty"),
+		TEXT("Int64Property"),
+		TEXT("FloatProperty"),
+		TEXT("DoubleProperty"),
+		TEXT("StrProperty"),
+		TEXT("NameProperty"),
+		TEXT("TextProperty"),
+		TEXT("EnumProperty"),
+		TEXT("StructProperty"),
+		TEXT("ObjectProperty"),
+		TEXT("ClassProperty"),
+		TEXT("SoftObjectProperty"),
+		TEXT("SoftClassProperty"),
+		TEXT("WeakObjectProperty"),
+		TEXT("InterfaceProperty"),
+		TEXT("DelegateProperty"),
+		TEXT("MulticastDelegateProperty"),
+		TEXT("MulticastInlineDelegateProperty"),
+		TEXT("ArrayProperty"),
+		TEXT("MapProperty"),
+	};
+	static_assert(UE_ARRAY_COUNT(ExportedKindNames) == static_cast<int32>(EFModelPropertyKind::Count), "One name per EFModelPropertyKind");
+
+	template <typename CharType>
+	EFModelPropertyKind FindKindChars(const CharType* Chars, int32 Len)
+	{
+		if (Len == 0)
+		{
+			return EFModelPropertyKind::None;
+		}
+		const EFModelPropertyKind* Kind = KindTable.Find(Chars, Len);
+		return Kind ? *Kind : EFModelPropertyKind::Unknown;
+	}
+
+	FName ToTypeName(FStringView Text)
+	{
+		return Text.IsEmpty() ? NAME_None : FName(Text.Len(), Text.GetData());
+	}
+
+	/** Kind name, or the exported name an Unknown kind was kept under */
+	void AppendKind(FString& Out, EFModelPropertyKind Kind, FName UnknownName)
+	{
+		if (Kind == EFModelPropertyKind::Unknown)
+		{
+			if (!UnknownName.IsNone())
+			{
+				UnknownName.AppendString(Out);
+			}
+		}
+		else
+		{
+			Out += FFModelTypeRef::GetKindName(Kind);
+		}
+	}
+
+	void AppendField(FString& Out, FName Name)
+	{
+		Out += TEXT('|');
+		if (!Name.IsNone())
+		{
+			Name.AppendString(Out);
+		}
+	}
+
+	/**
+	 * "|Class|Path" after a kind. The class slot is written whenever a path follows it, and always for structs,
+	 * which older exports wrote as "StructProperty|Name" even when the name was empty
+	 */
+	void AppendClassFields(FString& Out, EFModelPropertyKind Kind, FName ClassName, const FString& ClassPath)
+	{
+		if (Kind == EFModelPropertyKind::None || Kind == EFModelPropertyKind::Unknown)
+		{
+			return;
+		}
+		const bool bHasPath = !ClassPath.IsEmpty();
+		if (bHasPath || !ClassName.IsNone() || Kind == EFModelPropertyKind::Struct)
+		{
+			AppendField(Out, ClassName);
+		}
+		if (bHasPath)
+		{
+			Out += TEXT('|');
+			Out += ClassPath;
+		}
+	}
+
+	/** "Class'EFoo'" -> "EFoo", as older exports name enums */
+	FStringView StripClassQuotes(FStringView Name)
+	{
+		if (Name.StartsWith(TEXT("Class'")) && Name.EndsWith(TEXT("'")))
+		{
+			return Name.Mid(6, Name.Len() - 7);
+		}
+		return Name;
+	}
+}
+
+FString FFModelTypeRef::ToString() const
+{
+	FString Out;
+	switch (Container)
+	{
+	case EFModelContainerKind::Array:
+		// The inner kind slot is always written, as "ArrayProperty|" when the export names no inner type
+		Out += GetKindName(EFModelPropertyKind::Array);
+		Out += TEXT('|');
+		AppendKind(Out, Kind, ClassName);
+		AppendClassFields(Out, Kind, ClassName, ClassPath);
+		break;
+
+	case EFModelContainerKind::Map:
+		// The key class slot is always written, so the value class can follow it
+		Out += GetKindName(EFModelPropertyKind::Map);
+		Out += TEXT('|');
+		AppendKind(Out, KeyKind, KeyClassName);
+		Out += TEXT('|');
+		AppendKind(Out, Kind, ClassName);
+		AppendField(Out, KeyKind == EFModelPropertyKind::Unknown ? NAME_None : KeyClassName);
+		if (Kind != EFModelPropertyKind::Unknown && !ClassName.IsNone())
+		{
+			AppendField(Out, ClassName);
+		}
+		break;
+
+	default:
+		AppendKind(Out, Kind, ClassName);
+		AppendClassFields(Out, Kind, ClassName, ClassPath);
+		break;
+	}
+	return Out;
+}
+
+FFModelTypeRef FFModelTypeRef::Parse(FStringView TypeString)
+{
+	// Kind, then up to four fields; empty fields are kept so map slots stay in place
+	TArray<FStringView, TInlineAllocator<5>> Fields;
+	for (int32 Start = 0;;)
+	{
+		int32 Separator = INDEX_NONE;
+		if (!TypeString.RightChop(Start).FindChar(TEXT('|'), Separator))
+		{
+			Fields.Add(TypeString.RightChop(Start));
+			break;
+		}
+		Fields.Add(TypeString.Mid(Start, Separator));
+		Start += Separator + 1;
+	}
+	auto GetField = [&Fields](int32 Index) { return Index < Fields.Num() ? Fields[Index] : FStringView(); };
+
+	FFModelTypeRef TypeRef;
+
+	// Element, value or key kind; an Unknown one keeps its exported name in the class name slot
+	auto ReadKind = [](FStringView KindName, EFModelPropertyKind& OutKind, FName& OutUnknownName)
+	{
+		OutKind = FindKind(KindName);
+		if (OutKind == EFModelPropertyKind::Unknown)
+		{
+			OutUnknownName = ToTypeName(KindName);
+		}
+		return OutKind != EFModelPropertyKind::Unknown;
+	};
+
+	const EFModelPropertyKind Lead = FindKind(Fields[0]);
+	if (Lead == EFModelPropertyKind::Array)
+	{
+		TypeRef.Container = EFModelContainerKind::Array;
+		if (ReadKind(GetField(1), TypeRef.Kind, TypeRef.ClassName))
+		{
+			TypeRef.ClassName = ToTypeName(GetField(2));
+			TypeRef.ClassPath = FString(GetField(3));
+		}
+	}
+	else if (Lead == EFModelPropertyKind::Map)
+	{
+		TypeRef.Container = EFModelContainerKind::Map;
+		if (ReadKind(GetField(1), TypeRef.KeyKind, TypeRef.KeyClassName))
+		{
+			TypeRef.KeyClassName = ToTypeName(StripClassQuotes(GetField(3)));
+		}
+		if (ReadKind(GetField(2), TypeRef.Kind, TypeRef.ClassName))
+		{
+			TypeRef.ClassName = ToTypeName(GetField(4));
+		}
+	}
+	else if (ReadKind(Fields[0], TypeRef.Kind, TypeRef.ClassName) && TypeRef.Kind != EFModelPropertyKind::None)
+	{
+		FStringView Name = GetField(1);
+		if (TypeRef.Kind == EFModelPropertyKind::Enum)
+		{
+			Name = StripClassQuotes(Name);
+		}
+		TypeRef.ClassName = ToTypeName(Name);
+		TypeRef.ClassPath = FString(GetField(2));
+	}
+	return TypeRef;
+}
+
+const TCHAR* FFModelTypeRef::GetKindName(EFModelPropertyKind Kind)
+{
+	const int32 Index = static_cast<int32>(Kind);
+	return Index < UE_ARRAY_COUNT(ExportedKindNames) ? ExportedKindNames[Index] : TEXT("");
+}
+
+EFModelPropertyKind FFModelTypeRef::FindKind(FStringView KindName)
+{
+	return FindKindChars(KindName.GetData(), KindName.Len());
+}
+
+EFModelPropertyKind FFModelTypeRef::FindKind(FUtf8StringView KindName)
+{
+	return FindKindChars(KindName.GetData(), KindName.Len());
+}
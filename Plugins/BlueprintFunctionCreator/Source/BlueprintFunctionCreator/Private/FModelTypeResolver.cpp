@@ -0,0 +1,863 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelTypeResolver.h"
+#include "FModelNativeTypeIndex.h"
+#include "FModelAssetIndex.h"
+#include "FModelProbeOrder.h"
+#include "FModelPerfectHash.h"
+#include "FModelClassDescriptor.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "GameFramework/Actor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Misc/PackageName.h"
+
+namespace
+{
+	/** One (kind, hinted path) looked up under a name; bFound false records a miss */
+	struct FTypeCacheEntry
+	{
+		EFModelTypeKind Kind;
+		FString Path;
+		TWeakObjectPtr<UObject> Object;
+		bool bFound = false;
+	};
+
+	/**
+	 * Every lookup of the session, by referenced name. A name is almost always looked up as one kind with
+	 * one path hint, so a hit is one hash lookup and a compare. Game thread only, like all of the resolver.
+	 */
+	TMap<FName, TArray<FTypeCacheEntry, TInlineAllocator<1>>> TypeCache;
+	FModelTypeResolver::FCacheStats CacheStats;
+	FDelegateHandle AssetCreatedHandle;
+
+	FString GetNameOrEmpty(FName Name)
+	{
+		return Name.IsNone() ? FString() : Name.ToString();
+	}
+
+	/** Property kind as exported, for messages; an unknown kind was kept under its exported name */
+	FString GetExportedKindName(EFModelPropertyKind Kind, FName UnknownName)
+	{
+		return Kind == EFModelPropertyKind::Unknown ? GetNameOrEmpty(UnknownName) : FString(FFModelTypeRef::GetKindName(Kind));
+	}
+
+	/** Pin categories a property kind maps to; the K2 category FNames are not constant expressions */
+	enum class EPinCategoryId : uint8
+	{
+		Wildcard,
+		Boolean,
+		Byte,
+		Int,
+		Int64,
+		Float,
+		Double,
+		String,
+		Name,
+		Text,
+		Struct,
+		Object,
+		Class,
+		SoftObject,
+		Interface,
+		Delegate,
+		MCDelegate,
+
+		Count
+	};
+
+	/** What the class name a kind carries is looked up as */
+	enum class EPinTypeLookup : uint8
+	{
+		None,
+		Class,
+		Struct,
+		Enum
+	};
+
+	struct FPinKindMapping
+	{
+		EPinCategoryId Category;
+		EPinTypeLookup Lookup;
+		bool bWeak;
+		/** No pin can hold it (VOID, containers as elements, unknown kinds): wildcard, reported as an unknown property */
+		bool bUnknown;
+	};
+
+	/**
+	 * Pin type of each property kind, indexed by EFModelPropertyKind. Return pins, array elements, map keys,
+	 * map values and member variables all resolve through it, so every site covers the same kinds.
+	 */
+	constexpr FPinKindMapping PinKindMappings[] = {
+		/* None */ { EPinCategoryId::Wildcard, EPinTypeLookup::None, false, false },
+		/* Void */ { EPinCategoryId::Wildcard, EPinTypeLookup::None, false, true },
+		/* Unknown */ { EPinCategoryId::Wildcard, EPinTypeLookup::None, false, true },
+		/* Bool */ { EPinCategoryId::Boolean, EPinTypeLookup::None, false, false },
+		/* Byte */ { EPinCategoryId::Byte, EPinTypeLookup::None, false, false },
+		/* Int */ { EPinCategoryId::Int, EPinTypeLookup::None, false, false },
+		/* Int64 */ { EPinCategoryId::Int64, EPinTypeLookup::None, false, false },
+		/* Float */ { EPinCategoryId::Float, EPinTypeLookup::None, false, false },
+		/* Double */ { EPinCategoryId::Double, EPinTypeLookup::None, false, false },
+		/* Str */ { EPinCategoryId::String, EPinTypeLookup::None, false, false },
+		/* Name */ { EPinCategoryId::Name, EPinTypeLookup::None, false, false },
+		/* Text */ { EPinCategoryId::Text, EPinTypeLookup::None, false, false },
+		/* Enum */ { EPinCategoryId::Byte, EPinTypeLookup::Enum, false, false },
+		/* Struct */ { EPinCategoryId::Struct, EPinTypeLookup::Struct, false, false },
+		/* Object */ { EPinCategoryId::Object, EPinTypeLookup::Class, false, false },
+		/* Class */ { EPinCategoryId::Class, EPinTypeLookup::Class, false, false },
+		/* SoftObject */ { EPinCategoryId::SoftObject, EPinTypeLookup::None, false, false },
+		/* SoftClass */ { EPinCategoryId::SoftObject, EPinTypeLookup::None, false, false },
+		/* WeakObject */ { EPinCategoryId::Object, EPinTypeLookup::None, true, false }, // Weak object references are object pins in UE5
+		/* Interface */ { EPinCategoryId::Interface, EPinTypeLookup::None, false, false },
+		/* Delegate */ { EPinCategoryId::Delegate, EPinTypeLookup::None, false, false },
+		/* MulticastDelegate */ { EPinCategoryId::MCDelegate, EPinTypeLookup::None, false, false },
+		/* MulticastInlineDelegate */ { EPinCategoryId::MCDelegate, EPinTypeLookup::None, false, false },
+		/* Array */ { EPinCategoryId::Wildcard, EPinTypeLookup::None, false, true },
+		/* Map */ { EPinCategoryId::Wildcard, EPinTypeLookup::None, false, true },
+	};
+	static_assert(UE_ARRAY_COUNT(PinKindMappings) == static_cast<int32>(EFModelPropertyKind::Count), "One pin mapping per EFModelPropertyKind");
+
+	const FPinKindMapping& GetPinKindMapping(EFModelPropertyKind Kind)
+	{
+		// Kinds set from Python are not range checked
+		const int32 Index = static_cast<int32>(Kind);
+		return PinKindMappings[Index < UE_ARRAY_COUNT(PinKindMappings) ? Index : static_cast<int32>(EFModelPropertyKind::Unknown)];
+	}
+
+	struct FPinCategoryNames
+	{
+		FName Category;
+		FName SubCategory;
+	};
+
+	const FPinCategoryNames& GetPinCategoryNames(EPinCategoryId Id)
+	{
+		// Built on first use, once the BlueprintGraph module has initialized its category names
+		static const FPinCategoryNames Names[] = {
+			{ UEdGraphSchema_K2::PC_Wildcard, NAME_None },
+			{ UEdGraphSchema_K2::PC_Boolean, NAME_None },
+			{ UEdGraphSchema_K2::PC_Byte, NAME_None },
+			{ UEdGraphSchema_K2::PC_Int, NAME_None },
+			{ UEdGraphSchema_K2::PC_Int64, NAME_None },
+			{ UEdGraphSchema_K2::PC_Real, UEdGraphSchema_K2::PC_Float },
+			{ UEdGraphSchema_K2::PC_Real, UEdGraphSchema_K2::PC_Double },
+			{ UEdGraphSchema_K2::PC_String, NAME_None },
+			{ UEdGraphSchema_K2::PC_Name, NAME_None },
+			{ UEdGraphSchema_K2::PC_Text, NAME_None },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None },
+			{ UEdGraphSchema_K2::PC_Object, NAME_None },
+			{ UEdGraphSchema_K2::PC_Class, NAME_None },
+			{ UEdGraphSchema_K2::PC_SoftObject, NAME_None },
+			{ UEdGraphSchema_K2::PC_Interface, NAME_None },
+			{ UEdGraphSchema_K2::PC_Delegate, NAME_None },
+			{ UEdGraphSchema_K2::PC_MCDelegate, NAME_None },
+		};
+		static_assert(UE_ARRAY_COUNT(Names) == static_cast<int32>(EPinCategoryId::Count), "One name pair per EPinCategoryId");
+		return Names[static_cast<int32>(Id)];
+	}
+
+	/** Category, sub-category and object of a pin or of a map key; FEdGraphPinType and FEdGraphTerminalType both take one */
+	struct FResolvedTerminal
+	{
+		FName Category;
+		FName SubCategory;
+		UObject* SubCategoryObject = nullptr;
+		bool bWeak = false;
+	};
+
+	/** C++ spellings AddVariablesToBlueprint takes for member variables, as property kinds */
+	constexpr int32 NumVariableKinds = 9;
+	using FVariableKindTable = TFModelPerfectHashTable<EFModelPropertyKind, NumVariableKinds, 5>;
+
+	constexpr FVariableKindTable::FEntry VariableKinds[] = {
+		{ "bool", EFModelPropertyKind::Bool },
+		{ "uint8", EFModelPropertyKind::Byte },
+		{ "int32", EFModelPropertyKind::Int },
+		{ "int64", EFModelPropertyKind::Int64 },
+		{ "float", EFModelPropertyKind::Float },
+		{ "double", EFModelPropertyKind::Double },
+		{ "FString", EFModelPropertyKind::Str },
+		{ "FName", EFModelPropertyKind::Name },
+		{ "FText", EFModelPropertyKind::Text },
+	};
+
+	/** FNV-1a offset basis + 4: the first seed that maps VariableKinds into the table without collisions */
+	constexpr FVariableKindTable VariableKindTable(VariableKinds, 2166136265u);
+	static_assert(VariableKindTable.IsCollisionFree(), "Variable kind hash collides; search for a new seed after changing VariableKinds");
+
+	/** "/Game/Path/Asset.0" + "Name" -> "/Game/Path/Asset.Name" */
+	FString MakeObjectPath(const FString& PackagePath, const FString& ObjectName)
+	{
+		FString Path = PackagePath;
+		if (Path.EndsWith(TEXT(".0")))
+		{
+			Path.LeftChopInline(2);
+		}
+		return FString::Printf(TEXT("%s.%s"), *Path, *ObjectName);
+	}
+
+	/** Already in memory, else loaded; only for packages known to exist */
+	template <typename T>
+	T* FindOrLoad(const FString& ObjectPath)
+	{
+		T* Object = FindObject<T>(nullptr, *ObjectPath);
+		return Object ? Object : LoadObject<T>(nullptr, *ObjectPath);
+	}
+
+	/** "/Game/Path/BP_Foo.0" -> "/Game/Path/BP_Foo"; NAME_None without a hint */
+	FName GetHintedPackage(const FString& Path)
+	{
+		return Path.IsEmpty() ? NAME_None : FName(*FPackageName::ObjectPathToPackageName(Path));
+	}
+
+	/**
+	 * Load an object at the path the export named, for assets the asset index missed (e.g., saved after the
+	 * registry scanned). Only packages that exist on disk are loaded, so a miss costs a stat, not a failed load.
+	 */
+	template <typename T>
+	T* LoadFromExportedPath(const FString& ObjectPath)
+	{
+		const FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+		if (!FPackageName::IsValidLongPackageName(PackageName) || !FPackageName::DoesPackageExist(PackageName))
+		{
+			return nullptr;
+		}
+		return FindOrLoad<T>(ObjectPath);
+	}
+
+	/** Try content and native types in the order FModelProbeOrder currently prefers for Kind, and count the side that found it */
+	template <typename T, typename ContentProbeType, typename NativeProbeType>
+	T* ProbeInOrder(EFModelTypeKind Kind, ContentProbeType ProbeContent, NativeProbeType ProbeNative)
+	{
+		const bool bContentFirst = FModelProbeOrder::IsContentFirst(Kind);
+		for (const bool bContent : { bContentFirst, !bContentFirst })
+		{
+			if (T* Found = bContent ? ProbeContent() : ProbeNative())
+			{
+				FModelProbeOrder::RecordHit(Kind, bContent);
+				return Found;
+			}
+		}
+		return nullptr;
+	}
+
+	UClass* ProbeClass(const FString& ClassName, const FString& ClassPath, int32& NumProbes)
+	{
+		if (ClassPath.StartsWith(TEXT("/Script/")))
+		{
+			// A native class named with its module: always in memory
+			++NumProbes;
+			if (UClass* FoundClass = FindObject<UClass>(nullptr, *MakeObjectPath(ClassPath, ClassName)))
+			{
+				return FoundClass;
+			}
+		}
+
+		return ProbeInOrder<UClass>(EFModelTypeKind::Class,
+			[&ClassName, &ClassPath, &NumProbes]() -> UClass*
+			{
+				// A Blueprint class: "BP_Foo_C" lives in the package of the Blueprint asset "BP_Foo"
+				if (!ClassName.EndsWith(TEXT("_C")) || ClassPath.StartsWith(TEXT("/Script/")))
+				{
+					return nullptr;
+				}
+				++NumProbes;
+				const FName HintedPackage = GetHintedPackage(ClassPath);
+				const FName Package = FModelAssetIndex::FindBlueprintPackage(FName(*ClassName.LeftChop(2)), HintedPackage);
+				if (!Package.IsNone())
+				{
+					return FindOrLoad<UClass>(MakeObjectPath(Package.ToString(), ClassName));
+				}
+				return HintedPackage.IsNone() ? nullptr : LoadFromExportedPath<UClass>(MakeObjectPath(HintedPackage.ToString(), ClassName));
+			},
+			[&ClassName, &NumProbes]()
+			{
+				++NumProbes;
+				return FModelNativeTypeIndex::FindClass(FName(*ClassName));
+			});
+	}
+
+	UScriptStruct* ProbeStruct(const FString& StructName, const FString& StructPath, int32& NumProbes)
+	{
+		if (StructPath.StartsWith(TEXT("/Script/")))
+		{
+			++NumProbes;
+			if (UScriptStruct* FoundStruct = FindObject<UScriptStruct>(nullptr, *MakeObjectPath(StructPath, StructName)))
+			{
+				return FoundStruct;
+			}
+		}
+
+		return ProbeInOrder<UScriptStruct>(EFModelTypeKind::Struct,
+			[&StructName, &StructPath, &NumProbes]() -> UScriptStruct*
+			{
+				// A UserDefinedStruct, wherever the asset registry holds it
+				if (StructPath.StartsWith(TEXT("/Script/")))
+				{
+					return nullptr;
+				}
+				++NumProbes;
+				const FName HintedPackage = GetHintedPackage(StructPath);
+				const FName Package = FModelAssetIndex::FindStructPackage(FName(*StructName), HintedPackage);
+				if (!Package.IsNone())
+				{
+					return FindOrLoad<UScriptStruct>(MakeObjectPath(Package.ToString(), StructName));
+				}
+				return HintedPackage.IsNone() ? nullptr : LoadFromExportedPath<UScriptStruct>(MakeObjectPath(HintedPackage.ToString(), StructName));
+			},
+			[&StructName, &NumProbes]()
+			{
+				++NumProbes;
+				return FModelNativeTypeIndex::FindStruct(FName(*StructName));
+			});
+	}
+
+	UEnum* ProbeEnum(const FString& EnumName, const FString& EnumPath, int32& NumProbes)
+	{
+		return ProbeInOrder<UEnum>(EFModelTypeKind::Enum,
+			[&EnumName, &EnumPath, &NumProbes]() -> UEnum*
+			{
+				// A UserDefinedEnum already in memory
+				if (EnumPath.IsEmpty())
+				{
+					return nullptr;
+				}
+				++NumProbes;
+				return FindObject<UEnum>(nullptr, *(EnumPath + TEXT(".") + EnumName));
+			},
+			[&EnumName, &NumProbes]()
+			{
+				++NumProbes;
+				return FModelNativeTypeIndex::FindEnum(FName(*EnumName));
+			});
+	}
+
+	/** Remembered result of Probe(Name, Path), including misses */
+	template <typename T, typename ProbeType>
+	T* FindCached(EFModelTypeKind Kind, const FString& Name, const FString& Path, ProbeType Probe)
+	{
+		check(IsInGameThread());
+
+		if (!AssetCreatedHandle.IsValid() && FModuleManager::Get().IsModuleLoaded(TEXT("AssetRegistry")))
+		{
+			// A new asset may be a type that was missing so far
+			AssetCreatedHandle = IAssetRegistry::GetChecked().OnInMemoryAssetCreated().AddStatic(&FModelTypeResolver::NotifyAssetCreated);
+		}
+
+		TArray<FTypeCacheEntry, TInlineAllocator<1>>& Entries = TypeCache.FindOrAdd(FName(*Name));
+		for (int32 Index = 0; Index < Entries.Num(); ++Index)
+		{
+			FTypeCacheEntry& Entry = Entries[Index];
+			if (Entry.Kind != Kind || Entry.Path != Path)
+			{
+				continue;
+			}
+
+			if (!Entry.bFound)
+			{
+				++CacheStats.NumHits;
+				return nullptr;
+			}
+			if (UObject* Object = Entry.Object.Get())
+			{
+				++CacheStats.NumHits;
+				return static_cast<T*>(Object);
+			}
+
+			// Garbage collected since: look it up again
+			Entries.RemoveAtSwap(Index);
+			--CacheStats.NumEntries;
+			break;
+		}
+
+		++CacheStats.NumMisses;
+		int32 NumProbes = 0;
+		T* Found = Probe(Name, Path, NumProbes);
+		FModelProbeOrder::RecordLookup(Found != nullptr, NumProbes);
+
+		FTypeCacheEntry& NewEntry = Entries.AddDefaulted_GetRef();
+		NewEntry.Kind = Kind;
+		NewEntry.Path = Path;
+		NewEntry.Object = Found;
+		NewEntry.bFound = Found != nullptr;
+		++CacheStats.NumEntries;
+
+		return Found;
+	}
+}
+
+namespace FModelTypeResolver
+{
+	static void AddUnresolved(FUnresolvedTypes* OutUnresolved, const TCHAR* Kind, const FString& Name, const FString& Path = FString())
+	{
+		if (OutUnresolved)
+		{
+			FUnresolvedType& Unresolved = OutUnresolved->AddDefaulted_GetRef();
+			Unresolved.Kind = Kind;
+			Unresolved.Name = Name;
+			Unresolved.Path = Path;
+		}
+	}
+
+	UClass* FindClass(const FString& ClassName, const FString& ClassPath)
+	{
+		return FindCached<UClass>(EFModelTypeKind::Class, ClassName, ClassPath, &ProbeClass);
+	}
+
+	UScriptStruct* FindStruct(const FString& StructName, const FString& StructPath)
+	{
+		return FindCached<UScriptStruct>(EFModelTypeKind::Struct, StructName, StructPath, &ProbeStruct);
+	}
+
+	UEnum* FindEnum(const FString& EnumName, const FString& EnumPath)
+	{
+		return FindCached<UEnum>(EFModelTypeKind::Enum, EnumName, EnumPath, &ProbeEnum);
+	}
+
+	void NotifyAssetCreated(UObject* Asset)
+	{
+		if (!Asset)
+		{
+			return;
+		}
+
+		// Only misses can go stale: a hit stays valid until its object is collected
+		auto ForgetMisses = [](const FString& Name)
+		{
+			if (TArray<FTypeCacheEntry, TInlineAllocator<1>>* Entries = TypeCache.Find(FName(*Name)))
+			{
+				const int32 NumRemoved = Entries->RemoveAllSwap([](const FTypeCacheEntry& Entry) { return !Entry.bFound; });
+				CacheStats.NumEntries -= NumRemoved;
+				CacheStats.NumInvalidated += NumRemoved;
+			}
+		};
+
+		ForgetMisses(Asset->GetName());
+		if (const UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+		{
+			if (Blueprint->GeneratedClass)
+			{
+				ForgetMisses(Blueprint->GeneratedClass->GetName());
+			}
+		}
+	}
+
+	void ForgetMisses()
+	{
+		for (TPair<FName, TArray<FTypeCacheEntry, TInlineAllocator<1>>>& Pair : TypeCache)
+		{
+			const int32 NumRemoved = Pair.Value.RemoveAllSwap([](const FTypeCacheEntry& Entry) { return !Entry.bFound; });
+			CacheStats.NumEntries -= NumRemoved;
+			CacheStats.NumInvalidated += NumRemoved;
+		}
+	}
+
+	FCacheStats GetCacheStats()
+	{
+		return CacheStats;
+	}
+
+	void ResetCache()
+	{
+		TypeCache.Reset();
+		CacheStats = FCacheStats();
+	}
+
+	void Shutdown()
+	{
+		if (AssetCreatedHandle.IsValid())
+		{
+			if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+			{
+				AssetRegistry->OnInMemoryAssetCreated().Remove(AssetCreatedHandle);
+			}
+			AssetCreatedHandle.Reset();
+		}
+		TypeCache.Empty();
+	}
+
+	bool HasReturnValue(const FString& FunctionName, bool bHasReturnValue, const FFModelTypeRef& ReturnType)
+	{
+		// Auto-detect if function should have return value based on naming convention
+		// Only use auto-detection if:
+		// 1. bHasReturnValue is false (no return type specified)
+		// 2. ReturnType is empty (not found in JSON at all)
+		// 3. ReturnType is NOT Void (function found but confirmed no return)
+		// Functions starting with Get, Is, Can, Has, Should, Calc typically return values
+		if (!bHasReturnValue && ReturnType.IsEmpty())
+		{
+			if (FunctionName.StartsWith(TEXT("Get")) ||
+			    FunctionName.StartsWith(TEXT("Is")) ||
+			    FunctionName.StartsWith(TEXT("Can")) ||
+			    FunctionName.StartsWith(TEXT("Has")) ||
+			    FunctionName.StartsWith(TEXT("Should")) ||
+			    FunctionName.StartsWith(TEXT("Calc")) ||
+			    FunctionName.StartsWith(TEXT("Gey"))) // Typo in original: "GeyEjectionPortTransform"
+			{
+				UE_LOG(LogTemp, Log, TEXT("Auto-detected return value for function: %s (no explicit type info)"), *FunctionName);
+				return true;
+			}
+		}
+
+		// If explicitly marked as VOID, ensure no return node is created
+		if (ReturnType.IsVoid())
+		{
+			UE_LOG(LogTemp, Log, TEXT("Function %s explicitly has no return value (VOID)"), *FunctionName);
+			return false;
+		}
+
+		return bHasReturnValue;
+	}
+
+	/**
+	 * One kind through PinKindMappings, looking up the class, struct or enum it names
+	 * @param TypeName - Class, struct or enum name; for an Unknown kind, its exported name
+	 * @param Site - Where the kind appears, for messages ("pin", "array element", "map key", "map value")
+	 */
+	static FResolvedTerminal ResolveTerminal(EFModelPropertyKind Kind, FName TypeName, const FString& TypePath, const TCHAR* Site, FUnresolvedTypes* OutUnresolved)
+	{
+		const FPinKindMapping& Mapping = GetPinKindMapping(Kind);
+		const FPinCategoryNames& Names = GetPinCategoryNames(Mapping.Category);
+
+		FResolvedTerminal Terminal;
+		Terminal.Category = Names.Category;
+		Terminal.SubCategory = Names.SubCategory;
+		Terminal.bWeak = Mapping.bWeak;
+
+		if (Mapping.bUnknown)
+		{
+			const FString KindName = GetExportedKindName(Kind, TypeName);
+			UE_LOG(LogTemp, Warning, TEXT("Unknown %s type '%s', using wildcard"), Site, *KindName);
+			AddUnresolved(OutUnresolved, TEXT("Property"), KindName);
+			return Terminal;
+		}
+
+		const FString Name = GetNameOrEmpty(TypeName);
+		switch (Mapping.Lookup)
+		{
+		case EPinTypeLookup::Class:
+		{
+			const bool bIsClass = Mapping.Category == EPinCategoryId::Class;
+			Terminal.SubCategoryObject = Name.IsEmpty() ? nullptr : FindClass(Name, TypePath);
+			if (!Terminal.SubCategoryObject)
+			{
+				if (!Name.IsEmpty())
+				{
+					if (!TypePath.IsEmpty())
+					{
+						UE_LOG(LogTemp, Warning, TEXT("  ⚠️ Class '%s' not found (may not be generated yet)"), *Name);
+						UE_LOG(LogTemp, Warning, TEXT("  📍 Missing dependency: %s"), *MakeObjectPath(TypePath, Name));
+					}
+					else
+					{
+						UE_LOG(LogTemp, Warning, TEXT("  Could not find class '%s' for %s type, using generic %s"), *Name, Site, bIsClass ? TEXT("UClass") : TEXT("UObject"));
+					}
+					AddUnresolved(OutUnresolved, TEXT("Class"), Name, TypePath);
+				}
+
+				// Object and class pins must name a class: the generic UObject / UClass keeps the pin valid
+				Terminal.SubCategoryObject = bIsClass ? UClass::StaticClass() : UObject::StaticClass();
+			}
+			break;
+		}
+		case EPinTypeLookup::Struct:
+			if (!Name.IsEmpty())
+			{
+				Terminal.SubCategoryObject = FindStruct(Name, TypePath);
+				if (!Terminal.SubCategoryObject)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("  Could not find struct '%s' for %s type, using generic struct type"), *Name, Site);
+					AddUnresolved(OutUnresolved, TEXT("Struct"), Name, TypePath);
+				}
+			}
+			break;
+		case EPinTypeLookup::Enum:
+			if (!Name.IsEmpty())
+			{
+				Terminal.SubCategoryObject = FindEnum(Name, TypePath);
+				if (!Terminal.SubCategoryObject)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("  ✗ Could not find enum class '%s' for %s type, using byte"), *Name, Site);
+					AddUnresolved(OutUnresolved, TEXT("Enum"), Name, TypePath);
+				}
+			}
+			break;
+		default:
+			break;
+		}
+		return Terminal;
+	}
+
+	/** Pin type of a return type or of a member variable read into the same form */
+	static FEdGraphPinType ResolvePinType(const FFModelTypeRef& TypeRef, FUnresolvedTypes* OutUnresolved)
+	{
+		FEdGraphPinType OutPinType;
+		const TCHAR* Site = TEXT("pin");
+
+		if (TypeRef.Container == EFModelContainerKind::Array)
+		{
+			OutPinType.ContainerType = EPinContainerType::Array;
+			Site = TEXT("array element");
+		}
+		else if (TypeRef.Container == EFModelContainerKind::Map)
+		{
+			OutPinType.ContainerType = EPinContainerType::Map;
+
+			if (TypeRef.KeyKind == EFModelPropertyKind::None || TypeRef.Kind == EFModelPropertyKind::None)
+			{
+				const FString TypeString = TypeRef.ToString();
+				UE_LOG(LogTemp, Warning, TEXT("Invalid MapProperty format: %s"), *TypeString);
+				AddUnresolved(OutUnresolved, TEXT("Property"), TypeString);
+				OutPinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+				return OutPinType;
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("  Processing Map type: Key=%s, Value=%s"),
+				*GetExportedKindName(TypeRef.KeyKind, TypeRef.KeyClassName), *GetExportedKindName(TypeRef.Kind, TypeRef.ClassName));
+
+			// The key goes in PinValueType; map entries carry no path hints
+			const FResolvedTerminal Key = ResolveTerminal(TypeRef.KeyKind, TypeRef.KeyClassName, FString(), TEXT("map key"), OutUnresolved);
+			OutPinType.PinValueType.TerminalCategory = Key.Category;
+			OutPinType.PinValueType.TerminalSubCategory = Key.SubCategory;
+			OutPinType.PinValueType.TerminalSubCategoryObject = Key.SubCategoryObject;
+			OutPinType.PinValueType.bTerminalIsWeakPointer = Key.bWeak;
+			Site = TEXT("map value");
+		}
+
+		// Kind is the element kind of an array and the value kind of a map; ClassName/ClassPath belong to it
+		const FResolvedTerminal Terminal = ResolveTerminal(TypeRef.Kind, TypeRef.ClassName, TypeRef.ClassPath, Site, OutUnresolved);
+		OutPinType.PinCategory = Terminal.Category;
+		OutPinType.PinSubCategory = Terminal.SubCategory;
+		OutPinType.PinSubCategoryObject = Terminal.SubCategoryObject;
+		OutPinType.bIsWeakPointer = Terminal.bWeak;
+		return OutPinType;
+	}
+
+	FEdGraphPinType ResolveReturnType(const FFModelTypeRef& ReturnType, FUnresolvedTypes* OutUnresolved)
+	{
+		return ResolvePinType(ReturnType, OutUnresolved);
+	}
+
+	/** A member variable type string read into the return type form */
+	static FFModelTypeRef ReadVariableType(const FString& VariableType)
+	{
+		FFModelTypeRef TypeRef;
+		if (const EFModelPropertyKind* Kind = VariableKindTable.Find(*VariableType, VariableType.Len()))
+		{
+			TypeRef.Kind = *Kind;
+		}
+		else if (VariableType.StartsWith(TEXT("TArray<")))
+		{
+			// The element type is not exported for variables yet
+			TypeRef.Container = EFModelContainerKind::Array;
+			TypeRef.Kind = EFModelPropertyKind::Object;
+		}
+		else
+		{
+			// Exported kinds in the return type form ("ObjectProperty|SceneComponent|/Script/Engine", "Int64Property", ...).
+			// The parser writes /Script/Engine for every component class, including Blueprint ones, so it is no hint.
+			TypeRef = FFModelTypeRef::Parse(VariableType);
+			TypeRef.ClassPath.Reset();
+		}
+		return TypeRef;
+	}
+
+	bool ResolveVariableType(const FString& VariableType, FEdGraphPinType& OutPinType, FUnresolvedTypes* OutUnresolved)
+	{
+		OutPinType = FEdGraphPinType();
+
+		const FFModelTypeRef TypeRef = ReadVariableType(VariableType);
+		const auto IsPinKind = [](EFModelPropertyKind Kind)
+		{
+			return Kind != EFModelPropertyKind::None && !GetPinKindMapping(Kind).bUnknown;
+		};
+		if (!IsPinKind(TypeRef.Kind) || (TypeRef.Container == EFModelContainerKind::Map && !IsPinKind(TypeRef.KeyKind)))
+		{
+			AddUnresolved(OutUnresolved, TEXT("Property"), VariableType);
+			return false;
+		}
+
+		OutPinType = ResolvePinType(TypeRef, OutUnresolved);
+		return true;
+	}
+
+	/**
+	 * Object path of a Blueprint parent and its asset name
+	 * From: "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.0"
+	 * To: "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.BP_GatlingGun"
+	 */
+	static FString GetParentAssetPath(const FString& ParentClassPath, FString& OutAssetName)
+	{
+		FString AssetPath = ParentClassPath;
+
+		// Remove the .0 or other numeric suffix
+		int32 DotIndex;
+		if (AssetPath.FindLastChar('.', DotIndex))
+		{
+			FString NumericPart = AssetPath.Mid(DotIndex + 1);
+			if (NumericPart.IsNumeric())
+			{
+				AssetPath = AssetPath.Left(DotIndex);
+			}
+		}
+
+		// Extract asset name from path
+		if (AssetPath.Split(TEXT("/"), nullptr, &OutAssetName, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
+		{
+			// Build proper asset reference: /Path/To/Asset.AssetName
+			AssetPath = AssetPath + TEXT(".") + OutAssetName;
+		}
+		return AssetPath;
+	}
+
+	UClass* ResolveParentClass(const FString& ParentClassPath, FUnresolvedTypes* OutUnresolved)
+	{
+		UClass* ParentClass = AActor::StaticClass(); // Default to Actor
+		if (ParentClassPath.IsEmpty())
+		{
+			return ParentClass;
+		}
+
+		// Check if it's a C++ class (prefixed with "CPP:")
+		if (ParentClassPath.StartsWith(TEXT("CPP:")))
+		{
+			FString ClassName = ParentClassPath.Mid(4); // Remove "CPP:" prefix
+			UE_LOG(LogTemp, Log, TEXT("Looking for C++ parent class: %s"), *ClassName);
+			
+			// Try to find the C++ class
+			UClass* FoundClass = FindClass(ClassName, FString());
+			if (FoundClass)
+			{
+				ParentClass = FoundClass;
+				UE_LOG(LogTemp, Log, TEXT("✅ Using C++ parent class: %s"), *ParentClass->GetName());
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("❌ C++ class '%s' not found, defaulting to AActor"), *ClassName);
+				AddUnresolved(OutUnresolved, TEXT("Parent"), ClassName);
+			}
+			return ParentClass;
+		}
+
+		// It's a Blueprint parent class
+		FString AssetName;
+		FString AssetPath = GetParentAssetPath(ParentClassPath, AssetName);
+
+		// Load the one package the asset registry holds the parent in: the exported path if it is there, else wherever
+		// a Blueprint of that name was imported (e.g., old imports nested under /Game/Pal/Content/Pal/). If the registry has
+		// not seen it, the exported path is loaded directly as long as the package is on disk
+		UBlueprint* ParentBlueprint = nullptr;
+		const FName ParentPackage = FModelAssetIndex::FindBlueprintPackage(FName(*AssetName), GetHintedPackage(AssetPath));
+		if (!ParentPackage.IsNone())
+		{
+			AssetPath = MakeObjectPath(ParentPackage.ToString(), AssetName);
+			UE_LOG(LogTemp, Log, TEXT("Loading parent Blueprint: %s"), *AssetPath);
+			ParentBlueprint = FindOrLoad<UBlueprint>(AssetPath);
+		}
+		else
+		{
+			ParentBlueprint = LoadFromExportedPath<UBlueprint>(AssetPath);
+		}
+		
+		if (ParentBlueprint && ParentBlueprint->GeneratedClass)
+		{
+			// Skip compilation for performance - parent should already be available
+			ParentClass = ParentBlueprint->GeneratedClass;
+			UE_LOG(LogTemp, Log, TEXT("✅ Using parent class: %s"), *ParentClass->GetName());
+		}
+		else if (ParentBlueprint)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("❌ Parent Blueprint failed to compile, defaulting to AActor"));
+			AddUnresolved(OutUnresolved, TEXT("Parent"), AssetName + TEXT("_C"), AssetPath);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("❌ Parent Blueprint not found: %s, defaulting to AActor"), *AssetPath);
+			AddUnresolved(OutUnresolved, TEXT("Parent"), AssetName + TEXT("_C"), AssetPath);
+		}
+
+		return ParentClass;
+	}
+
+	void PrefetchDescriptorTypes(const FFModelClassDescriptor& Descriptor, const TSet<FName>& SkipPackages, TMap<FName, int32>& InOutRequests, TArray<int32>& OutRequestIds)
+	{
+		check(IsInGameThread());
+
+		auto Prefetch = [&SkipPackages, &InOutRequests, &OutRequestIds](FName Package)
+		{
+			if (Package.IsNone() || SkipPackages.Contains(Package))
+			{
+				return;
+			}
+			if (const int32* RequestId = InOutRequests.Find(Package))
+			{
+				OutRequestIds.AddUnique(*RequestId);
+				return;
+			}
+
+			const FString PackageName = Package.ToString();
+			if (FindPackage(nullptr, *PackageName))
+			{
+				return;
+			}
+			const int32 RequestId = LoadPackageAsync(PackageName);
+			InOutRequests.Add(Package, RequestId);
+			OutRequestIds.Add(RequestId);
+		};
+
+		// The same packages ProbeClass and ProbeStruct load; if a native type of the name wins the lookup, the load was wasted
+		auto PrefetchTerminal = [&Prefetch](EFModelPropertyKind Kind, FName TypeName, const FString& TypePath)
+		{
+			if (TypeName.IsNone() || TypePath.StartsWith(TEXT("/Script/")))
+			{
+				return;
+			}
+
+			const FPinKindMapping& Mapping = GetPinKindMapping(Kind);
+			if (Mapping.bUnknown)
+			{
+				return;
+			}
+			if (Mapping.Lookup == EPinTypeLookup::Class)
+			{
+				const FString ClassName = TypeName.ToString();
+				if (ClassName.EndsWith(TEXT("_C")))
+				{
+					Prefetch(FModelAssetIndex::FindBlueprintPackage(FName(*ClassName.LeftChop(2)), GetHintedPackage(TypePath)));
+				}
+			}
+			else if (Mapping.Lookup == EPinTypeLookup::Struct)
+			{
+				Prefetch(FModelAssetIndex::FindStructPackage(TypeName, GetHintedPackage(TypePath)));
+			}
+		};
+
+		auto PrefetchTypeRef = [&PrefetchTerminal](const FFModelTypeRef& TypeRef)
+		{
+			if (TypeRef.Container == EFModelContainerKind::Map)
+			{
+				PrefetchTerminal(TypeRef.KeyKind, TypeRef.KeyClassName, FString());
+			}
+			PrefetchTerminal(TypeRef.Kind, TypeRef.ClassName, TypeRef.ClassPath);
+		};
+
+		if (!Descriptor.ParentClassPath.IsEmpty() && !Descriptor.ParentClassPath.StartsWith(TEXT("CPP:")))
+		{
+			FString AssetName;
+			const FString AssetPath = GetParentAssetPath(Descriptor.ParentClassPath, AssetName);
+			Prefetch(FModelAssetIndex::FindBlueprintPackage(FName(*AssetName), GetHintedPackage(AssetPath)));
+		}
+
+		for (const FFModelVariableDescriptor& Variable : Descriptor.Variables)
+		{
+			PrefetchTypeRef(ReadVariableType(Variable.Type));
+		}
+
+		for (const FFModelFunctionDescriptor& Function : Descriptor.Functions)
+		{
+			PrefetchTypeRef(Function.ReturnType);
+		}
+	}
+}
@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphPin.h"
+#include "FModelTypeRef.h"
+
+struct FFModelClassDescriptor;
+
+/**
+ * Translates the type strings of a parsed FModel export into parent classes and pin types.
+ * Needs no Blueprint, so the importer and the dry-run planner resolve through exactly the same code.
+ * Looks up and loads objects: game thread only.
+ */
+namespace FModelTypeResolver
+{
+	/** A type an export references that could not be found; the pin or parent fell back to a generic type */
+	struct FUnresolvedType
+	{
+		/** "Parent", "Class", "Struct", "Enum" or "Property" (a property kind the importer does not know) */
+		const TCHAR* Kind = TEXT("");
+
+		/** Name as referenced (e.g., "BP_Foo_C", "F_Bar", "EPalFoo"), or the unknown property kind */
+		FString Name;
+
+		/** Object path hinted by the export, empty if there was none */
+		FString Path;
+	};
+
+	using FUnresolvedTypes = TArray<FUnresolvedType>;
+
+	struct FCacheStats
+	{
+		/** Lookups answered from the cache, found or not */
+		int32 NumHits = 0;
+		/** Lookups that had to probe packages */
+		int32 NumMisses = 0;
+		int32 NumEntries = 0;
+		/** Remembered misses dropped because an asset of that name was created */
+		int32 NumInvalidated = 0;
+	};
+
+	/**
+	 * Class, struct and enum lookups shared by every pin the resolver builds. Each (kind, name, hinted path)
+	 * is probed once per session; later lookups of it, found or not, cost one hash lookup.
+	 * @param Path - Object path hinted by the export ("/Game/.../BP_Foo.0"), empty if there is none
+	 */
+	UClass* FindClass(const FString& ClassName, const FString& ClassPath);
+	UScriptStruct* FindStruct(const FString& StructName, const FString& StructPath);
+	UEnum* FindEnum(const FString& EnumName, const FString& EnumPath);
+
+	/** Forget remembered misses for an asset's name (and a Blueprint's generated class); called for every asset created in the editor */
+	void NotifyAssetCreated(UObject* Asset);
+
+	/** Forget every remembered miss, keeping the hits; called when a module loads, since its native types may be among them */
+	void ForgetMisses();
+
+	FCacheStats GetCacheStats();
+
+	/** Forget every lookup, e.g. after assets were deleted or renamed */
+	void ResetCache();
+
+	/** Release the cache and the asset registry hook; called on module shutdown */
+	void Shutdown();
+
+	/**
+	 * Whether a function gets a return node: "VOID" never does, and with no type info at all the
+	 * Get/Is/Can/Has/Should/Calc naming convention decides
+	 */
+	bool HasReturnValue(const FString& FunctionName, bool bHasReturnValue, const FFModelTypeRef& ReturnType);
+
+	/**
+	 * Pin type for a function return type as parsed from the export.
+	 * Types that cannot be found fall back to wildcard, UObject or UClass so the pin stays valid.
+	 * @param OutUnresolved - Optional; receives every referenced type that was not found
+	 */
+	FEdGraphPinType ResolveReturnType(const FFModelTypeRef& ReturnType, FUnresolvedTypes* OutUnresolved = nullptr);
+
+	/**
+	 * Pin type for a member variable type as understood by AddVariablesToBlueprint: a C++ spelling ("bool", "int64",
+	 * "FString", "TArray<...>") or an exported kind in the return type form ("ObjectProperty|SceneComponent|/Script/Engine",
+	 * "EnumProperty|EPalFoo"). Resolves through the same kind table as ResolveReturnType.
+	 * @param OutUnresolved - Optional; receives every referenced type that was not found
+	 * @return False for type strings the importer does not know; such variables are skipped
+	 */
+	bool ResolveVariableType(const FString& VariableType, FEdGraphPinType& OutPinType, FUnresolvedTypes* OutUnresolved = nullptr);
+
+	/**
+	 * Class a Blueprint should derive from
+	 * @param ParentClassPath - FFModelClassDescriptor::ParentClassPath ("/Game/.../BP_Foo.0" or "CPP:ClassName")
+	 * @param OutUnresolved - Optional; receives the parent if it was not found
+	 * @return The parent, or AActor if there is none or it was not found
+	 */
+	UClass* ResolveParentClass(const FString& ParentClassPath, FUnresolvedTypes* OutUnresolved = nullptr);
+
+	/**
+	 * Start async loads of the content packages a descriptor's parent, variables and return types live in, so
+	 * resolving them later finds them in memory. Only packages the asset index knows are loaded; packages already
+	 * in memory, and native types, need no load.
+	 * @param SkipPackages - Packages not to load (e.g., ones the import is about to create)
+	 * @param InOutRequests - Package -> request id of every load started so far; a package is requested once
+	 * @param OutRequestIds - Receives the requests the descriptor needs, to pass to FlushAsyncLoading before resolving it
+	 */
+	void PrefetchDescriptorTypes(const FFModelClassDescriptor& Descriptor, const TSet<FName>& SkipPackages, TMap<FName, int32>& InOutRequests, TArray<int32>& OutRequestIds);
+}
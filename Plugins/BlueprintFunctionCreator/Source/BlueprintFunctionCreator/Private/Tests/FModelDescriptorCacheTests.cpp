@@ -0,0 +1,211 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelDescriptorCache.h"
+#include "FModelClassDescriptor.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Content hash of a made-up export */
+	FXxHash64 MakeCacheTestHash(const ANSICHAR* ExportName)
+	{
+		return FXxHash64::HashBuffer(ExportName, FCStringAnsi::Strlen(ExportName));
+	}
+
+	FFModelClassDescriptor MakeCacheTestDescriptor()
+	{
+		FFModelClassDescriptor Descriptor;
+		Descriptor.ParentClassPath = TEXT("/Game/Pal/Blueprint/Weapon/BP_AssaultRifleBase.BP_AssaultRifleBase_C");
+
+		FFModelFunctionDescriptor& Function = Descriptor.Functions.AddDefaulted_GetRef();
+		Function.Name = TEXT("GetAmmoClass");
+		Function.ReturnType = FFModelTypeRef::Parse(TEXT("ClassProperty|BP_Ammo_C|/Game/Pal/Blueprint/BP_Ammo.0"));
+		FFModelFunctionDescriptor& MapFunction = Descriptor.Functions.AddDefaulted_GetRef();
+		MapFunction.Name = TEXT("GetCounts");
+		MapFunction.ReturnType = FFModelTypeRef::Parse(TEXT("MapProperty|NameProperty|IntProperty|"));
+
+		FFModelVariableDescriptor& Variable = Descriptor.Variables.AddDefaulted_GetRef();
+		Variable.Name = TEXT("FireRate");
+		Variable.Type = TEXT("FloatProperty");
+
+		FFModelComponentDescriptor& Component = Descriptor.Components.AddDefaulted_GetRef();
+		Component.Name = TEXT("AudioComponent");
+		Component.ComponentClass = TEXT("AudioComponent");
+		return Descriptor;
+	}
+
+	/** Every field of the descriptor as one string, so a mismatch shows both sides */
+	FString DescribeCachedDescriptor(const FFModelClassDescriptor& Descriptor)
+	{
+		FString Description = Descriptor.ParentClassPath + TEXT("\n");
+		for (const FFModelFunctionDescriptor& Function : Descriptor.Functions)
+		{
+			Description += FString::Printf(TEXT("Function %s -> %s\n"), *Function.Name.ToString(), *Function.ReturnType.ToString());
+		}
+		for (const FFModelVariableDescriptor& Variable : Descriptor.Variables)
+		{
+			Description += FString::Printf(TEXT("Variable %s: %s\n"), *Variable.Name.ToString(), *Variable.Type);
+		}
+		for (const FFModelComponentDescriptor& Component : Descriptor.Components)
+		{
+			Description += FString::Printf(TEXT("Component %s: %s\n"), *Component.Name.ToString(), *Component.ComponentClass);
+		}
+		return Description;
+	}
+
+	/** The cache file of an entry, empty if there is none */
+	FString FindCacheEntryFile(const FString& CacheDir, const FXxHash64& ContentHash)
+	{
+		TArray<FString> Files;
+		IFileManager::Get().FindFilesRecursive(Files, *CacheDir, *FString::Printf(TEXT("%016llx.bin"), ContentHash.Hash), true, false);
+		return Files.Num() > 0 ? Files[0] : FString();
+	}
+
+	/** Points the cache at a scratch directory for the lifetime of a test, and removes it afterwards */
+	struct FScopedTestCacheDir
+	{
+		const FString Dir;
+
+		explicit FScopedTestCacheDir(const TCHAR* Name)
+			: Dir(FPaths::Combine(FPaths::AutomationTransientDir(), Name))
+		{
+			IFileManager::Get().DeleteDirectory(*Dir, false, true);
+			FModelDescriptorCache::SetCacheDir(Dir);
+		}
+
+		~FScopedTestCacheDir()
+		{
+			FModelDescriptorCache::SetCacheDir(FString());
+			IFileManager::Get().DeleteDirectory(*Dir, false, true);
+		}
+	};
+
+	constexpr int64 UnlimitedCacheBytes = 1024 * 1024;
+
+	/** The default import settings */
+	constexpr FModelDescriptorCache::EParseSettings DefaultSettings = FModelDescriptorCache::EParseSettings::Streaming | FModelDescriptorCache::EParseSettings::SkipIrrelevantEntries;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelDescriptorCacheValidationTest,
+	"BlueprintFunctionCreator.DescriptorCache.Validation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * A stored descriptor must load back unchanged, an entry parsed with other settings must miss but stay, and an
+ * entry from another parser version, a truncated one or one filed under the wrong hash must miss and be deleted
+ * rather than load.
+ */
+bool FFModelDescriptorCacheValidationTest::RunTest(const FString& Parameters)
+{
+	const FScopedTestCacheDir CacheDir(TEXT("FModelDescriptorCacheValidation"));
+	const FFModelClassDescriptor Descriptor = MakeCacheTestDescriptor();
+	const FXxHash64 Hash = MakeCacheTestHash("BP_GatlingGun.json");
+	const FXxHash64 OtherHash = MakeCacheTestHash("BP_Other.json");
+
+	FFModelClassDescriptor Loaded;
+	TestFalse(TEXT("Empty cache misses"), FModelDescriptorCache::Load(Hash, DefaultSettings, Loaded));
+
+	FModelDescriptorCache::Store(Hash, DefaultSettings, Descriptor, UnlimitedCacheBytes);
+	if (TestTrue(TEXT("Stored entry hits"), FModelDescriptorCache::Load(Hash, DefaultSettings, Loaded)))
+	{
+		TestEqual(TEXT("Loaded descriptor"), DescribeCachedDescriptor(Loaded), DescribeCachedDescriptor(Descriptor));
+		TestTrue(TEXT("Loaded return type"), Loaded.Functions.Num() == 2 && Loaded.Functions[1].ReturnType == Descriptor.Functions[1].ReturnType);
+	}
+	TestFalse(TEXT("Other content misses"), FModelDescriptorCache::Load(OtherHash, DefaultSettings, Loaded));
+
+	// A strict parse could reject an export the skipping one accepted
+	const FString EntryFile = FindCacheEntryFile(CacheDir.Dir, Hash);
+	TestFalse(TEXT("Other settings miss"), FModelDescriptorCache::Load(Hash, FModelDescriptorCache::EParseSettings::Streaming, Loaded));
+	TestTrue(TEXT("Entry with other settings is kept"), IFileManager::Get().FileExists(*EntryFile));
+
+	TArray<uint8> EntryBytes;
+	if (!TestTrue(TEXT("Entry file exists"), FFileHelper::LoadFileToArray(EntryBytes, *EntryFile)))
+	{
+		return false;
+	}
+
+	// Magic, then the parser version
+	TArray<uint8> OtherVersion = EntryBytes;
+	const uint32 NextVersion = FModelDescriptorCache::ParserVersion + 1;
+	FMemory::Memcpy(OtherVersion.GetData() + sizeof(uint32), &NextVersion, sizeof(uint32));
+	FFileHelper::SaveArrayToFile(OtherVersion, *EntryFile);
+	TestFalse(TEXT("Other parser version misses"), FModelDescriptorCache::Load(Hash, DefaultSettings, Loaded));
+	TestFalse(TEXT("Other parser version is deleted"), IFileManager::Get().FileExists(*EntryFile));
+
+	TArray<uint8> Truncated = EntryBytes;
+	Truncated.SetNum(Truncated.Num() - 3);
+	FFileHelper::SaveArrayToFile(Truncated, *EntryFile);
+	TestFalse(TEXT("Truncated entry misses"), FModelDescriptorCache::Load(Hash, DefaultSettings, Loaded));
+	TestFalse(TEXT("Truncated entry is deleted"), IFileManager::Get().FileExists(*EntryFile));
+
+	FModelDescriptorCache::Store(OtherHash, DefaultSettings, Descriptor, UnlimitedCacheBytes);
+	const FString OtherEntryFile = FindCacheEntryFile(CacheDir.Dir, OtherHash);
+	FFileHelper::SaveArrayToFile(EntryBytes, *OtherEntryFile);
+	TestFalse(TEXT("Entry under the wrong hash misses"), FModelDescriptorCache::Load(OtherHash, DefaultSettings, Loaded));
+	TestFalse(TEXT("Entry under the wrong hash is deleted"), IFileManager::Get().FileExists(*OtherEntryFile));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelDescriptorCacheEvictionTest,
+	"BlueprintFunctionCreator.DescriptorCache.Eviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * A store that takes the cache over budget must evict least recently used entries down to 3/4 of the budget,
+ * where a hit counts as a use, and must leave the temp files of stores still in flight alone.
+ */
+bool FFModelDescriptorCacheEvictionTest::RunTest(const FString& Parameters)
+{
+	const FScopedTestCacheDir CacheDir(TEXT("FModelDescriptorCacheEviction"));
+	const FFModelClassDescriptor Descriptor = MakeCacheTestDescriptor();
+	const FXxHash64 Hashes[] = {
+		MakeCacheTestHash("Export0.json"),
+		MakeCacheTestHash("Export1.json"),
+		MakeCacheTestHash("Export2.json"),
+		MakeCacheTestHash("Export3.json"),
+		MakeCacheTestHash("Export4.json"),
+	};
+
+	// Four entries of the same size, oldest first
+	const FDateTime Now = FDateTime::UtcNow();
+	for (int32 Index = 0; Index < 4; ++Index)
+	{
+		FModelDescriptorCache::Store(Hashes[Index], DefaultSettings, Descriptor, UnlimitedCacheBytes);
+		IFileManager::Get().SetTimeStamp(*FindCacheEntryFile(CacheDir.Dir, Hashes[Index]), Now - FTimespan::FromHours(4 - Index));
+	}
+	const int64 EntryBytes = IFileManager::Get().FileSize(*FindCacheEntryFile(CacheDir.Dir, Hashes[0]));
+	if (!TestTrue(TEXT("Entries were stored"), EntryBytes > 0))
+	{
+		return false;
+	}
+
+	// Another worker's store, older than every entry and not yet moved into place
+	const FString TempFile = FindCacheEntryFile(CacheDir.Dir, Hashes[1]) + TEXT(".InFlight.tmp");
+	TArray<uint8> TempBytes;
+	TempBytes.SetNumZeroed(EntryBytes);
+	FFileHelper::SaveArrayToFile(TempBytes, *TempFile);
+	IFileManager::Get().SetTimeStamp(*TempFile, Now - FTimespan::FromHours(5));
+
+	// A hit makes the oldest entry the most recently used
+	FFModelClassDescriptor Loaded;
+	TestTrue(TEXT("Oldest entry hits"), FModelDescriptorCache::Load(Hashes[0], DefaultSettings, Loaded));
+
+	// Five entries against a budget of four: evicted down to three, the two least recently used
+	FModelDescriptorCache::Store(Hashes[4], DefaultSettings, Descriptor, EntryBytes * 4);
+	TestTrue(TEXT("In-flight temp file kept"), IFileManager::Get().FileExists(*TempFile));
+
+	const bool bExpectedKept[] = { true, false, false, true, true };
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Hashes); ++Index)
+	{
+		const bool bKept = !FindCacheEntryFile(CacheDir.Dir, Hashes[Index]).IsEmpty();
+		TestTrue(FString::Printf(TEXT("Entry %d %s"), Index, bExpectedKept[Index] ? TEXT("kept") : TEXT("evicted")), bKept == bExpectedKept[Index]);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,283 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelExportClassifier.h"
+#include "FModelStructuralScan.h"
+#include "Dom/JsonObject.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FClassifierSample
+	{
+		const TCHAR* Name;
+		/** UTF-8 export text, without a BOM */
+		const ANSICHAR* Json;
+	};
+
+	/** A struct first, then the Blueprint class; nested "Type" and "Super" members must not be read as the entry's */
+	const ANSICHAR* const StructThenBlueprintJson = R"json([
+  {
+    "Type": "UserDefinedStruct",
+    "Name": "F_NPC_PathWalkArray",
+    "ChildProperties": [ { "Type": "ArrayProperty", "Name": "Points", "Super": { "ObjectName": "Nested" } } ]
+  },
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_GatlingGun_C",
+    "Properties": { "Type": "NotTheEntryType", "Name": "NotTheEntryName" },
+    "Super": {
+      "ObjectName": "BlueprintGeneratedClass'BP_AssaultRifleBase_C'",
+      "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_AssaultRifleBase.0"
+    }
+  },
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_Second_C"
+  }
+])json";
+
+	/** Structural bytes inside strings, escaped quotes and backslashes, and non-ASCII names */
+	const ANSICHAR* const EscapedStringsJson = R"json([
+  "not an entry",
+  {
+    "Type": "Function",
+    "Name": "Brackets{[}]\"Quoted\"\\"
+  },
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_Caf\u00e9_)json" "\xC3\xA9" R"json(_C",
+    "Super": {
+      "ObjectPath": "C:\\Exports\\}]\\",
+      "ObjectName": "BlueprintGeneratedClass'BP_\"Base\"_C'"
+    }
+  }
+])json";
+
+	/** A Super that is not an object is not a reference */
+	const ANSICHAR* const StringSuperJson = R"json([
+  { "Type": "BlueprintGeneratedClass", "Name": "BP_Orphan_C", "Super": "BlueprintGeneratedClass'BP_Gone_C'" }
+])json";
+
+	const ANSICHAR* const NoBlueprintJson = R"json([
+  { "Type": "UserDefinedEnum", "Name": "EPalWeaponType", "Names": { "EPalWeaponType::A": 0 } },
+  { "Type": "UserDefinedStruct", "Name": "F_Unused" }
+])json";
+
+	/** Not an export array */
+	const ANSICHAR* const ObjectJson = R"json({ "Type": "BlueprintGeneratedClass", "Name": "BP_Object_C" })json";
+
+	const FClassifierSample ClassifierSamples[] =
+	{
+		{ TEXT("StructThenBlueprint"), StructThenBlueprintJson },
+		{ TEXT("Escapes"), EscapedStringsJson },
+		{ TEXT("StringSuper"), StringSuperJson },
+		{ TEXT("NoBlueprint"), NoBlueprintJson },
+		{ TEXT("Object"), ObjectJson },
+	};
+
+	/** The summary FModelExportClassifier should produce, read through the FJsonSerializer DOM */
+	FFModelExportSummary SummarizeWithDom(const FString& JsonText)
+	{
+		FFModelExportSummary Summary;
+		TArray<TSharedPtr<FJsonValue>> Entries;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+		if (!FJsonSerializer::Deserialize(Reader, Entries))
+		{
+			return Summary;
+		}
+		Summary.bIsExportArray = true;
+
+		bool bIsFirst = true;
+		for (const TSharedPtr<FJsonValue>& Value : Entries)
+		{
+			const TSharedPtr<FJsonObject>* Entry = nullptr;
+			if (!Value.IsValid() || !Value->TryGetObject(Entry))
+			{
+				continue;
+			}
+
+			FString Type;
+			FString Name;
+			(*Entry)->TryGetStringField(TEXT("Type"), Type);
+			(*Entry)->TryGetStringField(TEXT("Name"), Name);
+			if (bIsFirst)
+			{
+				Summary.FirstEntryType = Type;
+				Summary.FirstEntryName = Name;
+				bIsFirst = false;
+			}
+
+			if (Type == TEXT("BlueprintGeneratedClass"))
+			{
+				Summary.bHasBlueprintClass = true;
+				Summary.BlueprintClassName = Name;
+				const TSharedPtr<FJsonObject>* Super = nullptr;
+				if ((*Entry)->TryGetObjectField(TEXT("Super"), Super))
+				{
+					Summary.bHasSuper = true;
+					(*Super)->TryGetStringField(TEXT("ObjectName"), Summary.SuperObjectName);
+					(*Super)->TryGetStringField(TEXT("ObjectPath"), Summary.SuperObjectPath);
+				}
+				break;
+			}
+		}
+		return Summary;
+	}
+
+	/** Every field of the summary, compared case-sensitively */
+	FString DescribeSummary(const FFModelExportSummary& Summary)
+	{
+		return FString::Printf(TEXT("Array=%d First=%s/%s Blueprint=%d %s Super=%d %s %s"),
+			Summary.bIsExportArray, *Summary.FirstEntryType, *Summary.FirstEntryName,
+			Summary.bHasBlueprintClass, *Summary.BlueprintClassName,
+			Summary.bHasSuper, *Summary.SuperObjectName, *Summary.SuperObjectPath);
+	}
+
+	const uint8* FindScalar(const uint8* Cur, const uint8* End, bool bStringOnly)
+	{
+		for (; Cur < End; ++Cur)
+		{
+			const uint8 C = *Cur;
+			if (C == '"' || C == '\\' || (!bStringOnly && (C == '{' || C == '}' || C == '[' || C == ']')))
+			{
+				return Cur;
+			}
+		}
+		return End;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelStructuralScanMatchesScalarTest,
+	"BlueprintFunctionCreator.Classifier.ScanMatchesScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * The vector paths of FModelStructuralScan must find exactly the byte a plain loop finds, from every alignment
+ * and for every length, so blocks, block boundaries and the scalar tail are all covered.
+ */
+bool FFModelStructuralScanMatchesScalarTest::RunTest(const FString& Parameters)
+{
+	// Every byte value, with structural bytes rare enough that most blocks hold none
+	constexpr int32 NumBytes = 160;
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(NumBytes);
+	FRandomStream Random(0x464D6F64);
+	for (uint8& Byte : Bytes)
+	{
+		Byte = static_cast<uint8>(Random.RandRange(0, 255));
+	}
+
+	const uint8* const Data = Bytes.GetData();
+	for (int32 Start = 0; Start <= NumBytes; ++Start)
+	{
+		for (int32 End = Start; End <= NumBytes; ++End)
+		{
+			const UTF8CHAR* const Cur = reinterpret_cast<const UTF8CHAR*>(Data + Start);
+			const UTF8CHAR* const Last = reinterpret_cast<const UTF8CHAR*>(Data + End);
+
+			const int32 Structural = UE_PTRDIFF_TO_INT32(reinterpret_cast<const uint8*>(FModelStructuralScan::FindStructural(Cur, Last)) - Data);
+			const int32 ExpectedStructural = UE_PTRDIFF_TO_INT32(FindScalar(Data + Start, Data + End, false) - Data);
+			const int32 StringSpecial = UE_PTRDIFF_TO_INT32(reinterpret_cast<const uint8*>(FModelStructuralScan::FindStringSpecial(Cur, Last)) - Data);
+			const int32 ExpectedStringSpecial = UE_PTRDIFF_TO_INT32(FindScalar(Data + Start, Data + End, true) - Data);
+			if (Structural != ExpectedStructural || StringSpecial != ExpectedStringSpecial)
+			{
+				AddError(FString::Printf(TEXT("[%d, %d): structural at %d (expected %d), string special at %d (expected %d)"),
+					Start, End, Structural, ExpectedStructural, StringSpecial, ExpectedStringSpecial));
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelExportClassifierMatchesDomTest,
+	"BlueprintFunctionCreator.Classifier.MatchesDom",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * FModelExportClassifier must summarize each sample exactly as a DOM read of it does. Each sample is shifted by
+ * up to 40 bytes of leading whitespace so every string and bracket lands on each side of a vector block boundary.
+ */
+bool FFModelExportClassifierMatchesDomTest::RunTest(const FString& Parameters)
+{
+	for (const FClassifierSample& Sample : ClassifierSamples)
+	{
+		const int32 SampleLen = FCStringAnsi::Strlen(Sample.Json);
+		for (int32 Padding = 0; Padding <= 40; ++Padding)
+		{
+			TArray<ANSICHAR> Text;
+			Text.Init(' ', Padding);
+			Text.Append(Sample.Json, SampleLen);
+			const FUtf8StringView Utf8Text(reinterpret_cast<const UTF8CHAR*>(Text.GetData()), Text.Num());
+
+			const FUTF8ToTCHAR Converted(Text.GetData(), Text.Num());
+			const FFModelExportSummary Expected = SummarizeWithDom(FString(Converted.Length(), Converted.Get()));
+
+			FFModelExportSummary Summary;
+			FModelExportClassifier::Summarize(Utf8Text, Summary);
+
+			const FString ExpectedDescription = DescribeSummary(Expected);
+			const FString Description = DescribeSummary(Summary);
+			if (!Description.Equals(ExpectedDescription, ESearchCase::CaseSensitive))
+			{
+				AddError(FString::Printf(TEXT("%s (padding %d): classifier differs from DOM\n--- DOM\n%s\n--- Classifier\n%s"),
+					Sample.Name, Padding, *ExpectedDescription, *Description));
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelExportClassifierTrailingBackslashTest,
+	"BlueprintFunctionCreator.Classifier.TrailingBackslash",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * A torn export can end inside a string, right after a backslash. The string scan must stop at the end of the
+ * text, and the classifier must not report the Blueprint class whose name was cut off.
+ */
+bool FFModelExportClassifierTrailingBackslashTest::RunTest(const FString& Parameters)
+{
+	const ANSICHAR* const TornJson = R"json([ { "Type": "BlueprintGeneratedClass", "Name": "BP_Torn\)json";
+	const int32 TornLen = FCStringAnsi::Strlen(TornJson);
+
+	for (int32 Padding = 0; Padding <= 40; ++Padding)
+	{
+		// Sized exactly, so a scan past the last byte runs off the allocation
+		TArray<ANSICHAR> Text;
+		Text.Init(' ', Padding);
+		Text.Append(TornJson, TornLen);
+		const UTF8CHAR* const Begin = reinterpret_cast<const UTF8CHAR*>(Text.GetData());
+		const UTF8CHAR* const End = Begin + Text.Num();
+
+		// Just the backslash, and the backslash at the end of a longer string
+		for (const UTF8CHAR* StringStart : { End - 1, End - 8 })
+		{
+			bool bEscaped = false;
+			const UTF8CHAR* StringEnd = FModelStructuralScan::FindStringEnd(StringStart, End, bEscaped);
+			if (StringEnd != End || !bEscaped)
+			{
+				AddError(FString::Printf(TEXT("Padding %d, string of %d bytes: string end at %d of %d, escaped %d"),
+					Padding, UE_PTRDIFF_TO_INT32(End - StringStart), UE_PTRDIFF_TO_INT32(StringEnd - Begin), Text.Num(), bEscaped));
+				return false;
+			}
+		}
+
+		FFModelExportSummary Summary;
+		FModelExportClassifier::Summarize(FUtf8StringView(Begin, Text.Num()), Summary);
+		if (Summary.bHasBlueprintClass)
+		{
+			AddError(FString::Printf(TEXT("Padding %d: torn export classified as Blueprint %s"), Padding, *Summary.BlueprintClassName));
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
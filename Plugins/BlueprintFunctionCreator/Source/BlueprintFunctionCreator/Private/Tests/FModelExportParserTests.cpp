@@ -0,0 +1,475 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelExportParser.h"
+#include "FModelExportFile.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	struct FParserSample
+	{
+		const TCHAR* Name;
+		/** UTF-8 export text, without a BOM */
+		const ANSICHAR* Json;
+	};
+
+	/** Blueprint parent, components and standalone Function entries behind an ignored class default object (EXAMPLES.md) */
+	const ANSICHAR* const BlueprintParentJson = R"json([
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_GatlingGun_C",
+    "Class": "UScriptClass'BlueprintGeneratedClass'",
+    "Super": {
+      "ObjectName": "BlueprintGeneratedClass'BP_AssaultRifleBase_C'",
+      "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_AssaultRifleBase.0"
+    },
+    "Flags": "RF_Public | RF_Transactional | RF_WasLoaded | RF_LoadCompleted",
+    "Properties": {
+      "SimpleConstructionScript": {
+        "ObjectName": "SimpleConstructionScript'BP_GatlingGun_C:SimpleConstructionScript_0'",
+        "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.26"
+      }
+    },
+    "Children": [
+      { "ObjectName": "Function'BP_GatlingGun_C:GetAmmoClass'", "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.2" },
+      { "ObjectName": "Function'BP_GatlingGun_C:GetMuzzleEffect'", "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.3" },
+      { "ObjectName": "Function'BP_GatlingGun_C:StopFireLoopSound'", "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.4" },
+      { "ObjectName": "Function'BP_GatlingGun_C:ExecuteUbergraph_BP_GatlingGun'", "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.5" }
+    ],
+    "ChildProperties": [
+      { "Type": "ObjectProperty", "Name": "Mesh", "PropertyType": "Class'SkeletalMeshComponent'" },
+      {
+        "Type": "ObjectProperty",
+        "Name": "AudioComponent",
+        "PropertyFlags": "Edit | BlueprintVisible | ZeroConstructor | InstancedReference",
+        "PropertyClass": { "ObjectName": "Class'AudioComponent'", "ObjectPath": "/Script/Engine" }
+      },
+      { "Type": "FloatProperty", "Name": "FireRate", "PropertyFlags": "Edit | BlueprintVisible" },
+      { "Type": "StructProperty", "Name": "UberGraphFrame" },
+      { "Type": "IntProperty", "Name": "CallFunc_GetAmmo_ReturnValue" },
+      { "Type": "BoolProperty", "Name": "K2Node_Event_bIsFiring" }
+    ],
+    "MuzzleRoot": {
+      "Type": "ObjectProperty",
+      "Name": "MuzzleRoot",
+      "PropertyClass": { "ObjectName": "Class'SceneComponent'", "ObjectPath": "/Script/Engine" }
+    },
+    "MuzzleArray": { "Type": "ArrayProperty", "Name": "MuzzleArray" },
+    "bCooked": true
+  },
+  {
+    "Type": "BP_GatlingGun_C",
+    "Name": "Default__BP_GatlingGun_C",
+    "Properties": { "UberGraphFrame": {}, "Nested": [ [ { "Deep": [ 1, 2.5e3, -0.25, null, false ] } ] ] }
+  },
+  {
+    "Type": "Function",
+    "Name": "GetAmmoClass",
+    "Outer": "BP_GatlingGun_C",
+    "Class": "UScriptClass'Function'",
+    "ChildProperties": [
+      {
+        "Type": "ClassProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ZeroConstructor | ReturnParm",
+        "PropertyClass": { "ObjectName": "Class'Class'", "ObjectPath": "/Script/CoreUObject" },
+        "MetaClass": { "ObjectName": "BlueprintGeneratedClass'BP_AmmoBase_C'", "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_AmmoBase.0" }
+      }
+    ],
+    "Script": [ { "Inst": "EX_Return", "Expression": { "Inst": "EX_LocalVariable" } } ]
+  },
+  {
+    "Type": "Function",
+    "Name": "StopFireLoopSound",
+    "ChildProperties": []
+  }
+])json";
+
+	/** C++ parent through SuperStruct and a class with no parent at all (EXAMPLES.md) */
+	const ANSICHAR* const NativeParentJson = R"json([
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_AssaultRifleBase_C",
+    "Class": "UScriptClass'BlueprintGeneratedClass'",
+    "SuperStruct": { "ObjectName": "Class'PalWeaponBase'", "ObjectPath": "/Script/Pal" },
+    "Children": [
+      { "ObjectName": "Function'BP_AssaultRifleBase_C:GetAmmoClass'", "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_AssaultRifleBase.43" },
+      { "ObjectName": "Function'BP_AssaultRifleBase_C:Get Right Hand Location'", "ObjectPath": "/Game/Pal/Blueprint/Weapon/BP_AssaultRifleBase.55" }
+    ],
+    "ChildProperties": [
+      { "Type": "ObjectProperty", "Name": "WeaponMesh", "PropertyType": "Class'SkeletalMeshComponent'" }
+    ]
+  }
+])json";
+
+	const ANSICHAR* const NoParentJson = R"json([
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_CustomActor_C",
+    "Children": [
+      { "ObjectName": "Function'BP_CustomActor_C:CustomFunction'", "ObjectPath": "/Game/Custom/BP_CustomActor.2" }
+    ],
+    "ChildProperties": []
+  }
+])json";
+
+	/** Escaped and raw UTF-8 names; the raw-UTF-8 standalone Function entry must match the \u00e9-escaped child to get its return type */
+	const ANSICHAR* const EscapesJson = R"json([
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_Escapes_C",
+    "Super": { "ObjectName": "BlueprintGeneratedClass'BP_Base_C'", "ObjectPath": "\/Game\/Escapes\/BP_Base.0" },
+    "Children": [
+      { "ObjectName": "Function'BP_Escapes_C:Say \"Hi\"'", "ObjectPath": "/Game/Escapes/BP_Escapes.2" },
+      { "ObjectName": "Function'BP_Escapes_C:Back\\Slash'", "ObjectPath": "/Game/Escapes/BP_Escapes.3" },
+      { "ObjectName": "Function'BP_Escapes_C:Caf\u00e9'", "ObjectPath": "/Game/Escapes/BP_Escapes.4" },
+      { "ObjectName": "Function'BP_Escapes_C:Na)json" "\xC3\xAF" R"json(ve'", "ObjectPath": "/Game/Escapes/BP_Escapes.5" }
+    ],
+    "ChildProperties": [
+      { "Type": "IntProperty", "Name": "Tab\tName" },
+      { "Type": "StrProperty", "Name": "Slashed\/Name" },
+      { "Type": "NameProperty", "Name": "Gr)json" "\xC3\xBC\xC3\x9F" R"json(e" }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "Caf)json" "\xC3\xA9" R"json(",
+    "ChildProperties": [
+      {
+        "Type": "ObjectProperty",
+        "Name": "Ret\"Value\"",
+        "PropertyFlags": "CPF_Parm, CPF_OutParm, CPF_ReturnParm",
+        "PropertyClass": { "ObjectName": "BlueprintGeneratedClass'BP_Caf\u00e9_C'", "ObjectPath": "/Game/Escapes/BP_Caf\u00e9.0" }
+      }
+    ]
+  }
+])json";
+
+	/** The same function and variable names several times, and a second BlueprintGeneratedClass that must be ignored */
+	const ANSICHAR* const DuplicatesJson = R"json([
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_Example_C",
+    "Children": [
+      { "ObjectName": "Function'BP_Example_C:MyFunction'", "ObjectPath": "/Game/Example/BP_Example.2" },
+      { "ObjectName": "Function'BP_Example_C:Other'", "ObjectPath": "/Game/Example/BP_Example.3" },
+      { "ObjectName": "Function'BP_Example_C:MyFunction'", "ObjectPath": "/Game/Example/BP_Example.150" },
+      { "ObjectName": "Function'BP_Example_C:None'", "ObjectPath": "/Game/Example/BP_Example.151" },
+      { "ObjectName": "NotAFunction'BP_Example_C:Skipped'", "ObjectPath": "/Game/Example/BP_Example.152" }
+    ],
+    "ChildProperties": [
+      { "Type": "FloatProperty", "Name": "Health" },
+      { "Type": "IntProperty", "Name": "Health" },
+      {
+        "Type": "ObjectProperty",
+        "Name": "Root",
+        "PropertyClass": { "ObjectName": "Class'SceneComponent'", "ObjectPath": "/Script/Engine" }
+      }
+    ],
+    "Health": { "Type": "BoolProperty", "Name": "Health" },
+    "Root": {
+      "Type": "ObjectProperty",
+      "Name": "Root",
+      "PropertyClass": { "ObjectName": "Class'StaticMeshComponent'", "ObjectPath": "/Script/Engine" }
+    }
+  },
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_Example_Inner_C",
+    "Super": { "ObjectName": "BlueprintGeneratedClass'BP_Wrong_C'", "ObjectPath": "/Game/Example/BP_Wrong.0" },
+    "Children": [ { "ObjectName": "Function'BP_Example_Inner_C:Wrong'", "ObjectPath": "/Game/Example/BP_Example.200" } ]
+  },
+  { "Type": "Function", "Name": "Other", "ChildProperties": [ { "Type": "IntProperty", "Name": "ReturnValue", "PropertyFlags": "Parm | OutParm | ReturnParm" } ] },
+  { "Type": "Function", "Name": "Other", "ChildProperties": [ { "Type": "BoolProperty", "Name": "ReturnValue", "PropertyFlags": "Parm | OutParm | ReturnParm" } ] },
+  { "Type": "Function", "Name": "Standalone Only", "ChildProperties": [] }
+])json";
+
+	/** Every return-type shape BuildReturnType distinguishes */
+	const ANSICHAR* const ReturnTypesJson = R"json([
+  {
+    "Type": "BlueprintGeneratedClass",
+    "Name": "BP_Returns_C",
+    "SuperStruct": { "ObjectName": "Class'Actor'", "ObjectPath": "/Script/Engine" },
+    "Children": [
+      { "ObjectName": "Function'BP_Returns_C:GetActors'" },
+      { "ObjectName": "Function'BP_Returns_C:GetVectors'" },
+      { "ObjectName": "Function'BP_Returns_C:GetInts'" },
+      { "ObjectName": "Function'BP_Returns_C:GetActorMap'" },
+      { "ObjectName": "Function'BP_Returns_C:GetStructMap'" },
+      { "ObjectName": "Function'BP_Returns_C:GetEnumKeyMap'" },
+      { "ObjectName": "Function'BP_Returns_C:GetStruct'" },
+      { "ObjectName": "Function'BP_Returns_C:GetEnum'" },
+      { "ObjectName": "Function'BP_Returns_C:GetByRef'" },
+      { "ObjectName": "Function'BP_Returns_C:GetOut'" },
+      { "ObjectName": "Function'BP_Returns_C:GetUnknown'" },
+      { "ObjectName": "Function'BP_Returns_C:NotExported'" }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetActors",
+    "ChildProperties": [
+      {
+        "Type": "ArrayProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ReturnParm",
+        "Inner": {
+          "Type": "ObjectProperty",
+          "Name": "ReturnValue",
+          "PropertyClass": { "ObjectName": "BlueprintGeneratedClass'BP_Enemy_C'", "ObjectPath": "/Game/Pal/BP_Enemy.0" }
+        }
+      }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetVectors",
+    "ChildProperties": [
+      {
+        "Type": "ArrayProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ReturnParm",
+        "Inner": { "Type": "StructProperty", "Struct": { "ObjectName": "ScriptStruct'Vector'", "ObjectPath": "/Script/CoreUObject" } }
+      }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetInts",
+    "ChildProperties": [
+      { "Type": "ArrayProperty", "Name": "ReturnValue", "PropertyFlags": "Parm | OutParm | ReturnParm", "Inner": { "Type": "IntProperty" } }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetActorMap",
+    "ChildProperties": [
+      {
+        "Type": "MapProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ReturnParm",
+        "KeyProp": { "Type": "IntProperty" },
+        "ValueProp": { "Type": "ObjectProperty", "PropertyClass": { "ObjectName": "Class'Actor'", "ObjectPath": "/Script/Engine" } }
+      }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetStructMap",
+    "ChildProperties": [
+      {
+        "Type": "MapProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ReturnParm",
+        "KeyProp": { "Type": "NameProperty" },
+        "ValueProp": { "Type": "StructProperty", "Struct": { "ObjectName": "UserDefinedStruct'F_PalStats'", "ObjectPath": "/Game/Pal/F_PalStats.0" } }
+      }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetEnumKeyMap",
+    "ChildProperties": [
+      {
+        "Type": "MapProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ReturnParm",
+        "KeyProp": { "Type": "EnumProperty", "Enum": { "ObjectName": "UserDefinedEnum'EPalElement'", "ObjectPath": "/Game/Pal/EPalElement.0" } },
+        "ValueProp": { "Type": "FloatProperty" }
+      }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetStruct",
+    "ChildProperties": [
+      {
+        "Type": "StructProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ReturnParm",
+        "Struct": { "ObjectName": "UserDefinedStruct'F_PalStats'", "ObjectPath": "/Game/Pal/F_PalStats.0" }
+      }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetEnum",
+    "ChildProperties": [
+      {
+        "Type": "ByteProperty",
+        "Name": "ReturnValue",
+        "PropertyFlags": "Parm | OutParm | ReturnParm",
+        "Enum": { "ObjectName": "UserDefinedEnum'EPalElement'", "ObjectPath": "/Game/Pal/EPalElement.0" }
+      },
+      {
+        "Type": "EnumProperty",
+        "Name": "Unused",
+        "PropertyFlags": "Parm | OutParm",
+        "Enum": { "ObjectName": "UserDefinedEnum'EPalOther'", "ObjectPath": "/Game/Pal/EPalOther.0" }
+      }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetByRef",
+    "ChildProperties": [
+      { "Type": "IntProperty", "Name": "InOut", "PropertyFlags": "Parm | OutParm | ReferenceParm" }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetOut",
+    "ChildProperties": [
+      { "Type": "IntProperty", "Name": "In", "PropertyFlags": "Parm" },
+      { "Type": "TextProperty", "Name": "Out", "PropertyFlags": "Parm | OutParm" }
+    ]
+  },
+  {
+    "Type": "Function",
+    "Name": "GetUnknown",
+    "ChildProperties": [
+      { "Type": "OptionalProperty", "Name": "ReturnValue", "PropertyFlags": "Parm | OutParm | ReturnParm" }
+    ]
+  }
+])json";
+
+	const FParserSample ParserSamples[] =
+	{
+		{ TEXT("BlueprintParent"), BlueprintParentJson },
+		{ TEXT("NativeParent"), NativeParentJson },
+		{ TEXT("NoParent"), NoParentJson },
+		{ TEXT("Escapes"), EscapesJson },
+		{ TEXT("Duplicates"), DuplicatesJson },
+		{ TEXT("ReturnTypes"), ReturnTypesJson },
+	};
+
+	/** Every field of the descriptor, compared case-sensitively (FName and FString == are not) */
+	FString DescribeDescriptor(const FFModelClassDescriptor& Descriptor)
+	{
+		FString Description = FString::Printf(TEXT("Parent=%s\n"), *Descriptor.ParentClassPath);
+		for (const FFModelFunctionDescriptor& Function : Descriptor.Functions)
+		{
+			Description += FString::Printf(TEXT("Function %s -> %s\n"), *Function.Name.ToString(), *Function.ReturnType.ToString());
+		}
+		for (const FFModelVariableDescriptor& Variable : Descriptor.Variables)
+		{
+			Description += FString::Printf(TEXT("Variable %s: %s\n"), *Variable.Name.ToString(), *Variable.Type);
+		}
+		for (const FFModelComponentDescriptor& Component : Descriptor.Components)
+		{
+			Description += FString::Printf(TEXT("Component %s: %s\n"), *Component.Name.ToString(), *Component.ComponentClass);
+		}
+		return Description;
+	}
+
+	/** Test base: the parser logs each entry it reads at Warning verbosity, which is not a test failure */
+	class FFModelParserTestBase : public FAutomationTestBase
+	{
+	public:
+		FFModelParserTestBase(const FString& InName, const bool bInComplexTask)
+			: FAutomationTestBase(InName, bInComplexTask)
+		{
+		}
+
+		virtual bool SuppressLogWarnings() override { return true; }
+	};
+}
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FFModelParserFrontEndsMatchTest, FFModelParserTestBase,
+	"BlueprintFunctionCreator.Parser.FrontEndsMatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * The streaming front-end over TCHAR and over UTF-8 must produce exactly the descriptor the DOM reference does,
+ * with and without a UTF-8 BOM and with the skipping FModel.Parse.SkipIrrelevantEntries controls on and off.
+ * Files are read the way ParseDescriptorFile reads them, so BOM handling is covered too.
+ */
+bool FFModelParserFrontEndsMatchTest::RunTest(const FString& Parameters)
+{
+	const FString SampleDir = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("FModelExportParser"));
+
+	for (const FParserSample& Sample : ParserSamples)
+	{
+		for (const bool bWithBom : { false, true })
+		{
+			const FString Context = FString::Printf(TEXT("%s%s"), Sample.Name, bWithBom ? TEXT(" (BOM)") : TEXT(""));
+
+			TArray<uint8> Bytes;
+			if (bWithBom)
+			{
+				Bytes.Append({ 0xEF, 0xBB, 0xBF });
+			}
+			Bytes.Append(reinterpret_cast<const uint8*>(Sample.Json), FCStringAnsi::Strlen(Sample.Json));
+
+			const FString SamplePath = FPaths::Combine(SampleDir, FString(Sample.Name) + (bWithBom ? TEXT("_Bom.json") : TEXT(".json")));
+			if (!TestTrue(FString::Printf(TEXT("%s: write sample"), *Context), FFileHelper::SaveArrayToFile(Bytes, *SamplePath)))
+			{
+				continue;
+			}
+
+			FString JsonString;
+			TestTrue(FString::Printf(TEXT("%s: load as FString"), *Context), FFileHelper::LoadFileToString(JsonString, *SamplePath));
+
+			FFModelExportFile ExportFile;
+			const bool bMapped = ExportFile.Open(SamplePath) && ExportFile.CanParseInPlace();
+			TestTrue(FString::Printf(TEXT("%s: open as UTF-8"), *Context), bMapped);
+
+			FFModelClassDescriptor DomDescriptor;
+			{
+				FFModelExportAccumulator Accumulator;
+				TestTrue(FString::Printf(TEXT("%s: DOM parse"), *Context), FModelExportParser::ParseDom(JsonString, Accumulator));
+				Accumulator.Finish(DomDescriptor);
+			}
+			const FString Expected = DescribeDescriptor(DomDescriptor);
+			TestFalse(FString::Printf(TEXT("%s: DOM found functions"), *Context), DomDescriptor.Functions.IsEmpty());
+
+			for (const bool bSkipIrrelevantEntries : { true, false })
+			{
+				FFModelParseOptions Options;
+				Options.bSkipIrrelevantEntries = bSkipIrrelevantEntries;
+				const FString OptionContext = FString::Printf(TEXT("%s, SkipIrrelevantEntries %d"), *Context, bSkipIrrelevantEntries ? 1 : 0);
+
+				FFModelClassDescriptor TcharDescriptor;
+				{
+					FFModelExportAccumulator Accumulator;
+					TestTrue(FString::Printf(TEXT("%s: TCHAR streaming parse"), *OptionContext), FModelExportParser::ParseStreaming(JsonString, Accumulator, Options));
+					Accumulator.Finish(TcharDescriptor);
+				}
+
+				const FString TcharResult = DescribeDescriptor(TcharDescriptor);
+				if (!TcharResult.Equals(Expected, ESearchCase::CaseSensitive))
+				{
+					AddError(FString::Printf(TEXT("%s: TCHAR streaming differs from DOM\n--- DOM\n%s--- TCHAR\n%s"), *OptionContext, *Expected, *TcharResult));
+				}
+
+				if (!bMapped)
+				{
+					continue;
+				}
+
+				FFModelClassDescriptor Utf8Descriptor;
+				{
+					FFModelExportAccumulator Accumulator;
+					TestTrue(FString::Printf(TEXT("%s: UTF-8 streaming parse"), *OptionContext), FModelExportParser::ParseStreaming(ExportFile.GetUtf8Text(), Accumulator, Options));
+					Accumulator.Finish(Utf8Descriptor);
+				}
+
+				const FString Utf8Result = DescribeDescriptor(Utf8Descriptor);
+				if (!Utf8Result.Equals(Expected, ESearchCase::CaseSensitive))
+				{
+					AddError(FString::Printf(TEXT("%s: UTF-8 streaming differs from DOM\n--- DOM\n%s--- UTF-8\n%s"), *OptionContext, *Expected, *Utf8Result));
+				}
+			}
+		}
+	}
+
+	IFileManager::Get().DeleteDirectory(*SampleDir, false, true);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
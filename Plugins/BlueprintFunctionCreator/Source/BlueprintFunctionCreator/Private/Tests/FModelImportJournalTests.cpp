@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportJournal.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	using EJournalStatus = FFModelImportJournal::EStatus;
+
+	FModelPinFixups::FPinFixup MakeJournalFixup(const TCHAR* BlueprintPath, const TCHAR* GraphName, const TCHAR* PinName, const TCHAR* Type)
+	{
+		FModelPinFixups::FPinFixup Fixup;
+		Fixup.BlueprintPath = BlueprintPath;
+		Fixup.GraphName = GraphName;
+		Fixup.PinName = PinName;
+		Fixup.SetTypeString(Type);
+		Fixup.NumUnresolved = 1;
+		return Fixup;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelImportJournalResumeTest,
+	"BlueprintFunctionCreator.Journal.Resume",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * A journal reopened after a crash must give back the last record of each package with its hash, ignore a torn
+ * last line, start the next record on a line of its own, and hand back only the deferred pins whose Blueprint
+ * was created and not swept or rebuilt since.
+ */
+bool FFModelImportJournalResumeTest::RunTest(const FString& Parameters)
+{
+	const FString JournalDir = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("FModelImportJournal"));
+	const FString JournalPath = FPaths::Combine(JournalDir, TEXT("Journal.log"));
+	FFModelImportJournal::FExportVersion ExportA;
+	ExportA.ContentHash = 0xABCDEF0123456789ull;
+	ExportA.FileSize = 12345;
+	ExportA.ModificationTicks = 638000000000000000ll;
+
+	FFModelImportJournal::FExportVersion ExportG;
+	ExportG.ContentHash = 2;
+
+	{
+		FFModelImportJournal Journal;
+		if (!TestTrue(TEXT("Open a new journal"), Journal.Open(JournalPath, /*bReset*/ true)))
+		{
+			return false;
+		}
+		TestFalse(TEXT("A reset journal is not resuming"), Journal.IsResuming());
+
+		Journal.Record(EJournalStatus::Started, TEXT("/Game/A/BP_A"), {}, TEXT("A.json"));
+		Journal.RecordPinFixup(MakeJournalFixup(TEXT("/Game/A/BP_A.BP_A"), TEXT("GetB"), TEXT("ReturnValue"), TEXT("ObjectProperty|BP_B_C|/Game/B/BP_B.0")));
+		Journal.Record(EJournalStatus::Created, TEXT("/Game/A/BP_A"), ExportA, TEXT("A.json"));
+
+		Journal.Record(EJournalStatus::Existing, TEXT("/Game/C/BP_C"), {}, TEXT("C.json"));
+		Journal.Record(EJournalStatus::Started, TEXT("/Game/D/BP_D"), {}, TEXT("D.json"));
+		Journal.Record(EJournalStatus::Started, TEXT("/Game/E/BP_E"), {}, TEXT("E.json"));
+		Journal.Record(EJournalStatus::Failed, TEXT("/Game/E/BP_E"), {}, TEXT("E.json"));
+
+		// Created, then started again: rebuilt on resume, which records its pins again
+		Journal.Record(EJournalStatus::Started, TEXT("/Game/F/BP_F"), {}, TEXT("F.json"));
+		Journal.RecordPinFixup(MakeJournalFixup(TEXT("/Game/F/BP_F.BP_F"), TEXT(""), TEXT("Target"), TEXT("StructProperty|F_Missing|/Game/F/F_Missing.0")));
+		Journal.Record(EJournalStatus::Created, TEXT("/Game/F/BP_F"), ExportA, TEXT("F.json"));
+		Journal.Record(EJournalStatus::Started, TEXT("/Game/F/BP_F"), {}, TEXT("F.json"));
+		Journal.Flush();
+	}
+
+	// Killed halfway through writing a record
+	TestTrue(TEXT("Append a torn line"), FFileHelper::SaveStringToFile(TEXT("C\t0000000000000002\t0\t0\t/Game/G/BP_G"), *JournalPath,
+		FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append));
+
+	{
+		FFModelImportJournal Journal;
+		if (!TestTrue(TEXT("Reopen"), Journal.Open(JournalPath, /*bReset*/ false)))
+		{
+			return false;
+		}
+		TestTrue(TEXT("Resuming"), Journal.IsResuming());
+
+		EJournalStatus Status = EJournalStatus::Failed;
+		FFModelImportJournal::FExportVersion Export;
+		TestTrue(TEXT("BP_A recorded"), Journal.FindRecord(TEXT("/Game/A/BP_A"), Status, Export));
+		TestTrue(TEXT("BP_A created"), Status == EJournalStatus::Created);
+		TestTrue(TEXT("BP_A hash"), Export.ContentHash == ExportA.ContentHash);
+		TestEqual(TEXT("BP_A size"), Export.FileSize, ExportA.FileSize);
+		TestEqual(TEXT("BP_A modification time"), Export.ModificationTicks, ExportA.ModificationTicks);
+		TestFalse(TEXT("BP_A finished"), Journal.WasInterrupted(TEXT("/Game/A/BP_A")));
+
+		TestTrue(TEXT("BP_C recorded"), Journal.FindRecord(TEXT("/Game/C/BP_C"), Status, Export) && Status == EJournalStatus::Existing);
+		TestTrue(TEXT("BP_D interrupted"), Journal.WasInterrupted(TEXT("/Game/D/BP_D")));
+		TestTrue(TEXT("BP_E failed"), Journal.FindRecord(TEXT("/Game/E/BP_E"), Status, Export) && Status == EJournalStatus::Failed);
+		TestTrue(TEXT("BP_E interrupted"), Journal.WasInterrupted(TEXT("/Game/E/BP_E")));
+		TestTrue(TEXT("BP_F started again"), Journal.FindRecord(TEXT("/Game/F/BP_F"), Status, Export) && Status == EJournalStatus::Started);
+		TestFalse(TEXT("Torn line ignored"), Journal.FindRecord(TEXT("/Game/G/BP_G"), Status, Export));
+		TestEqual(TEXT("Done"), Journal.GetNumDone(), 2);
+
+		const TArray<FModelPinFixups::FPinFixup> Fixups = Journal.TakePinFixups();
+		if (TestEqual(TEXT("Pending fixups"), Fixups.Num(), 1))
+		{
+			const FModelPinFixups::FPinFixup& Fixup = Fixups[0];
+			TestEqual(TEXT("Fixup Blueprint"), Fixup.BlueprintPath, FString(TEXT("/Game/A/BP_A.BP_A")));
+			TestTrue(TEXT("Fixup pin"), Fixup.GraphName == TEXT("GetB") && Fixup.PinName == TEXT("ReturnValue"));
+			TestTrue(TEXT("Fixup type"), Fixup.ReturnType == FFModelTypeRef::Parse(TEXT("ObjectProperty|BP_B_C|/Game/B/BP_B.0")));
+			TestEqual(TEXT("Fixup unresolved"), Fixup.NumUnresolved, 1);
+		}
+		TestEqual(TEXT("Fixups are taken once"), Journal.TakePinFixups().Num(), 0);
+
+		Journal.Record(EJournalStatus::Created, TEXT("/Game/G/BP_G"), ExportG, TEXT("G.json"));
+		Journal.RecordPinFixupsApplied();
+		Journal.Flush();
+	}
+
+	{
+		FFModelImportJournal Journal;
+		TestTrue(TEXT("Reopen after resume"), Journal.Open(JournalPath, /*bReset*/ false));
+
+		EJournalStatus Status = EJournalStatus::Failed;
+		FFModelImportJournal::FExportVersion Export;
+		TestTrue(TEXT("Record after a torn line is read"), Journal.FindRecord(TEXT("/Game/G/BP_G"), Status, Export) && Status == EJournalStatus::Created && Export.ContentHash == 2);
+		TestEqual(TEXT("Swept fixups are not loaded again"), Journal.TakePinFixups().Num(), 0);
+	}
+
+	{
+		FFModelImportJournal Journal;
+		TestTrue(TEXT("Reset"), Journal.Open(JournalPath, /*bReset*/ true));
+		TestFalse(TEXT("Reset forgets earlier records"), Journal.IsResuming() || Journal.GetNumDone() > 0);
+	}
+
+	IFileManager::Get().DeleteDirectory(*JournalDir, false, true);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
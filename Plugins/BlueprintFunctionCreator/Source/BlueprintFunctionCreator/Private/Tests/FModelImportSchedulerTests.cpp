@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportScheduler.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** A Blueprint export as the classifier summarizes it; an empty SuperObjectName means no Super */
+	FFModelExportSummary MakeBlueprintSummary(const TCHAR* JsonFilePath, const TCHAR* ClassName, const TCHAR* SuperObjectName)
+	{
+		FFModelExportSummary Summary;
+		Summary.JsonFilePath = JsonFilePath;
+		Summary.bIsExportArray = true;
+		Summary.bHasBlueprintClass = true;
+		Summary.BlueprintClassName = ClassName;
+		Summary.bHasSuper = *SuperObjectName != TEXT('\0');
+		Summary.SuperObjectName = SuperObjectName;
+		return Summary;
+	}
+
+	/** Entries as "Class@Depth<-ParentIndex", compared as one string so a failure shows the whole order */
+	FString DescribeEntries(const FFModelImportPlan& Plan)
+	{
+		TArray<FString> Entries;
+		for (const FFModelImportPlanEntry& Entry : Plan.Entries)
+		{
+			Entries.Add(FString::Printf(TEXT("%s@%d<-%d"), *Entry.BlueprintClassName, Entry.Depth, Entry.ParentIndex));
+		}
+		return FString::Join(Entries, TEXT(" "));
+	}
+
+	/** Test base: the scheduler logs cycles and duplicates at Warning verbosity, which is what is being tested */
+	class FFModelSchedulerTestBase : public FAutomationTestBase
+	{
+	public:
+		FFModelSchedulerTestBase(const FString& InName, const bool bInComplexTask)
+			: FAutomationTestBase(InName, bInComplexTask)
+		{
+		}
+
+		virtual bool SuppressLogWarnings() override { return true; }
+	};
+}
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FFModelImportSchedulerOrderTest, FFModelSchedulerTestBase,
+	"BlueprintFunctionCreator.Scheduler.Order",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * BuildPlan must emit every parent before its children, grouped by depth with roots in input order, and must
+ * set aside duplicates, self-parents, cycles and everything below a cycle instead of ordering them.
+ */
+bool FFModelImportSchedulerOrderTest::RunTest(const FString& Parameters)
+{
+	TArray<FFModelExportSummary> Summaries;
+	Summaries.Add(MakeBlueprintSummary(TEXT("Child.json"), TEXT("BP_Child_C"), TEXT("BlueprintGeneratedClass'BP_Root_C'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("Root.json"), TEXT("BP_Root_C"), TEXT("Class'Actor'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("Grandchild.json"), TEXT("BP_Grandchild_C"), TEXT("BlueprintGeneratedClass'BP_Child_C'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("Orphan.json"), TEXT("BP_Orphan_C"), TEXT("BlueprintGeneratedClass'BP_External_C'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("Self.json"), TEXT("BP_Self_C"), TEXT("BlueprintGeneratedClass'BP_Self_C'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("CycleA.json"), TEXT("BP_CycleA_C"), TEXT("BlueprintGeneratedClass'BP_CycleB_C'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("CycleB.json"), TEXT("BP_CycleB_C"), TEXT("BlueprintGeneratedClass'BP_CycleA_C'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("BelowCycle.json"), TEXT("BP_BelowCycle_C"), TEXT("BlueprintGeneratedClass'BP_CycleA_C'")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("RootAgain.json"), TEXT("BP_Root_C"), TEXT("")));
+	Summaries.Add(MakeBlueprintSummary(TEXT("Sibling.json"), TEXT("BP_Sibling_C"), TEXT("BlueprintGeneratedClass'BP_Root_C'")));
+
+	FFModelExportSummary Struct;
+	Struct.JsonFilePath = TEXT("Struct.json");
+	Struct.bIsExportArray = true;
+	Struct.FirstEntryType = TEXT("UserDefinedStruct");
+	Summaries.Add(Struct);
+
+	const FFModelImportPlan Plan = FModelImportScheduler::BuildPlan(Summaries);
+
+	TestEqual(TEXT("Entries"), DescribeEntries(Plan),
+		FString(TEXT("BP_Root_C@0<--1 BP_Orphan_C@0<--1 BP_Child_C@1<-0 BP_Sibling_C@1<-0 BP_Grandchild_C@2<-2")));
+	TestEqual(TEXT("Depths"), Plan.NumDepths, 3);
+	TestEqual(TEXT("Missing parents"), FString::Join(Plan.MissingParentClassNames, TEXT(" ")), FString(TEXT("BP_External_C")));
+	TestEqual(TEXT("Cyclic"), FString::Join(Plan.CyclicJsonFilePaths, TEXT(" ")), FString(TEXT("Self.json CycleA.json CycleB.json BelowCycle.json")));
+	TestEqual(TEXT("Duplicates"), FString::Join(Plan.DuplicateJsonFilePaths, TEXT(" ")), FString(TEXT("RootAgain.json")));
+
+	for (int32 EntryIndex = 0; EntryIndex < Plan.Entries.Num(); ++EntryIndex)
+	{
+		const FFModelImportPlanEntry& Entry = Plan.Entries[EntryIndex];
+		if (Entry.ParentIndex != INDEX_NONE)
+		{
+			TestTrue(FString::Printf(TEXT("%s comes after its parent"), *Entry.BlueprintClassName), Entry.ParentIndex < EntryIndex);
+			TestEqual(FString::Printf(TEXT("%s is one below its parent"), *Entry.BlueprintClassName), Entry.Depth, Plan.Entries[Entry.ParentIndex].Depth + 1);
+		}
+	}
+
+	TestEqual(TEXT("Native Super"), FModelImportScheduler::GetParentBlueprintClassName(Summaries[1]), FString());
+	TestEqual(TEXT("No Super"), FModelImportScheduler::GetParentBlueprintClassName(Summaries[8]), FString());
+	TestTrue(TEXT("Empty plan"), FModelImportScheduler::BuildPlan({}).Entries.IsEmpty());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelImportSharding.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Append an entry below ParentIndex (INDEX_NONE for a root) and return its index */
+	int32 AddShardingEntry(FFModelImportPlan& Plan, int32 ParentIndex)
+	{
+		FFModelImportPlanEntry& Entry = Plan.Entries.AddDefaulted_GetRef();
+		Entry.BlueprintClassName = FString::Printf(TEXT("BP_%d_C"), Plan.Entries.Num() - 1);
+		Entry.ParentIndex = ParentIndex;
+		Entry.Depth = ParentIndex != INDEX_NONE ? Plan.Entries[ParentIndex].Depth + 1 : 0;
+		return Plan.Entries.Num() - 1;
+	}
+
+	/** Where Partition put each entry */
+	struct FShardingLocation
+	{
+		int32 Stage = INDEX_NONE;
+		int32 Shard = INDEX_NONE;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelImportShardingPartitionTest,
+	"BlueprintFunctionCreator.Sharding.Partition",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * Every entry must land in exactly one shard, and its parent either in the same shard or in an earlier stage.
+ * Trees that fit a fair share stay whole; a larger one is split below its root into the next stage.
+ */
+bool FFModelImportShardingPartitionTest::RunTest(const FString& Parameters)
+{
+	// 24 entries: a tree of 16 (root, 3 children, 4 grandchildren each), a chain of 3 and 5 single roots
+	FFModelImportPlan Plan;
+	const int32 LargeRoot = AddShardingEntry(Plan, INDEX_NONE);
+	const int32 ChainRoot = AddShardingEntry(Plan, INDEX_NONE);
+	for (int32 Single = 0; Single < 5; ++Single)
+	{
+		AddShardingEntry(Plan, INDEX_NONE);
+	}
+	TArray<int32> LargeChildren;
+	for (int32 Child = 0; Child < 3; ++Child)
+	{
+		LargeChildren.Add(AddShardingEntry(Plan, LargeRoot));
+	}
+	const int32 ChainMiddle = AddShardingEntry(Plan, ChainRoot);
+	for (const int32 Child : LargeChildren)
+	{
+		for (int32 Grandchild = 0; Grandchild < 4; ++Grandchild)
+		{
+			AddShardingEntry(Plan, Child);
+		}
+	}
+	const int32 ChainLeaf = AddShardingEntry(Plan, ChainMiddle);
+
+	constexpr int32 NumShards = 4;
+	const TArray<FModelImportSharding::FStage> Stages = FModelImportSharding::Partition(Plan, NumShards);
+
+	TArray<FShardingLocation> Locations;
+	Locations.SetNum(Plan.Entries.Num());
+	for (int32 StageIndex = 0; StageIndex < Stages.Num(); ++StageIndex)
+	{
+		TestTrue(FString::Printf(TEXT("Stage %d has at most %d shards"), StageIndex, NumShards), Stages[StageIndex].Num() <= NumShards);
+		for (int32 ShardIndex = 0; ShardIndex < Stages[StageIndex].Num(); ++ShardIndex)
+		{
+			const FModelImportSharding::FShard& Shard = Stages[StageIndex][ShardIndex];
+			TestTrue(FString::Printf(TEXT("Stage %d shard %d is not empty"), StageIndex, ShardIndex), Shard.Num() > 0);
+			for (int32 Position = 0; Position < Shard.Num(); ++Position)
+			{
+				const int32 Index = Shard[Position];
+				if (!TestTrue(FString::Printf(TEXT("Entry %d exists"), Index), Plan.Entries.IsValidIndex(Index)))
+				{
+					return false;
+				}
+				TestTrue(FString::Printf(TEXT("Stage %d shard %d is ascending"), StageIndex, ShardIndex), Position == 0 || Shard[Position - 1] < Index);
+				TestEqual(FString::Printf(TEXT("Entry %d is in one shard"), Index), Locations[Index].Stage, INDEX_NONE);
+				Locations[Index] = { StageIndex, ShardIndex };
+			}
+		}
+	}
+
+	for (int32 Index = 0; Index < Plan.Entries.Num(); ++Index)
+	{
+		const FShardingLocation& Location = Locations[Index];
+		TestTrue(FString::Printf(TEXT("Entry %d is in a shard"), Index), Location.Stage != INDEX_NONE);
+
+		const int32 Parent = Plan.Entries[Index].ParentIndex;
+		if (Parent != INDEX_NONE && Location.Stage != INDEX_NONE)
+		{
+			const FShardingLocation& ParentLocation = Locations[Parent];
+			const bool bSameShard = ParentLocation.Stage == Location.Stage && ParentLocation.Shard == Location.Shard;
+			TestTrue(FString::Printf(TEXT("Entry %d: parent %d is in the same shard or an earlier stage"), Index, Parent),
+				bSameShard || ParentLocation.Stage < Location.Stage);
+		}
+	}
+
+	// A fair share is 6: the tree of 16 is split below its root, each child subtree of 5 stays whole
+	TestEqual(TEXT("Stages"), Stages.Num(), 2);
+	TestEqual(TEXT("Large root stage"), Locations[LargeRoot].Stage, 0);
+	for (const int32 Child : LargeChildren)
+	{
+		TestEqual(FString::Printf(TEXT("Child %d stage"), Child), Locations[Child].Stage, 1);
+	}
+	TestTrue(TEXT("Chain stays in one shard"), Locations[ChainRoot].Stage == Locations[ChainLeaf].Stage && Locations[ChainRoot].Shard == Locations[ChainLeaf].Shard);
+
+	TestTrue(TEXT("Same plan, same shards"), FModelImportSharding::Partition(Plan, NumShards) == Stages);
+
+	const TArray<FModelImportSharding::FStage> Single = FModelImportSharding::Partition(Plan, 0);
+	TestTrue(TEXT("No shard count means one shard of everything"), Single.Num() == 1 && Single[0].Num() == 1 && Single[0][0].Num() == Plan.Entries.Num());
+	TestEqual(TEXT("Empty plan"), FModelImportSharding::Partition(FFModelImportPlan(), NumShards).Num(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
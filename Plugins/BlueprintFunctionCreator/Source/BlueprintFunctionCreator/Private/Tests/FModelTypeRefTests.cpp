@@ -0,0 +1,94 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FModelTypeRef.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/** Strings as the parser built them before return types were interned; each must survive Parse + ToString unchanged */
+	const TCHAR* const BaselineTypeStrings[] = {
+		TEXT(""),
+		TEXT("VOID"),
+		TEXT("BoolProperty"),
+		TEXT("FieldPathProperty"),
+		TEXT("ObjectProperty|Actor|/Script/Engine"),
+		TEXT("ObjectProperty|BP_Foo_C|/Game/Blueprints/BP_Foo.0"),
+		// Same path in other case: paths are not interned, so it must not come back as the one above
+		TEXT("ObjectProperty|BP_Foo_C|/Game/blueprints/bp_foo.0"),
+		TEXT("ClassProperty|Actor"),
+		TEXT("EnumProperty|EPalWeaponType|/Game/Enums/EPalWeaponType.0"),
+		TEXT("StructProperty|Vector"),
+		TEXT("StructProperty|"),
+		TEXT("StructProperty||/Game/Structs/F_NPC_PathWalkArray.0"),
+		TEXT("ArrayProperty|"),
+		TEXT("ArrayProperty|IntProperty"),
+		TEXT("ArrayProperty|FieldPathProperty"),
+		TEXT("ArrayProperty|ObjectProperty"),
+		TEXT("ArrayProperty|ObjectProperty|Actor|/Script/Engine"),
+		TEXT("ArrayProperty|StructProperty|Transform"),
+		TEXT("ArrayProperty|StructProperty|"),
+		TEXT("MapProperty|NameProperty|IntProperty|"),
+		TEXT("MapProperty|FieldPathProperty|IntProperty|"),
+		TEXT("MapProperty|ObjectProperty|StructProperty|Actor|Vector"),
+		TEXT("MapProperty|EnumProperty|ObjectProperty|EPalWeaponType|Actor"),
+	};
+
+	struct FNormalizedTypeString
+	{
+		const TCHAR* Input;
+		const TCHAR* Expected;
+	};
+
+	/** Strings Parse accepts that are written back in the canonical form */
+	const FNormalizedTypeString NormalizedTypeStrings[] = {
+		{ TEXT("boolproperty"), TEXT("BoolProperty") },
+		{ TEXT("StructProperty"), TEXT("StructProperty|") },
+		{ TEXT("ArrayProperty"), TEXT("ArrayProperty|") },
+		{ TEXT("EnumProperty|Class'EPalWeaponType'"), TEXT("EnumProperty|EPalWeaponType") },
+		{ TEXT("MapProperty|EnumProperty|IntProperty|Class'EPalWeaponType'"), TEXT("MapProperty|EnumProperty|IntProperty|EPalWeaponType") },
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFModelTypeRefRoundTripTest,
+	"BlueprintFunctionCreator.TypeRef.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+/**
+ * ToString must give back the strings the Python API took before return types were interned, including the empty
+ * slots they kept, and Parse must read them into the same FFModelTypeRef again.
+ */
+bool FFModelTypeRefRoundTripTest::RunTest(const FString& Parameters)
+{
+	for (const TCHAR* TypeString : BaselineTypeStrings)
+	{
+		const FFModelTypeRef TypeRef = FFModelTypeRef::Parse(TypeString);
+		const FString Written = TypeRef.ToString();
+		TestEqual(FString::Printf(TEXT("'%s' written back"), TypeString), Written, FString(TypeString));
+		TestTrue(FString::Printf(TEXT("'%s' parsed again"), TypeString), FFModelTypeRef::Parse(Written) == TypeRef);
+	}
+
+	for (const FNormalizedTypeString& Entry : NormalizedTypeStrings)
+	{
+		const FFModelTypeRef TypeRef = FFModelTypeRef::Parse(Entry.Input);
+		TestEqual(FString::Printf(TEXT("'%s' written back"), Entry.Input), TypeRef.ToString(), FString(Entry.Expected));
+		TestTrue(FString::Printf(TEXT("'%s' parsed like '%s'"), Entry.Input, Entry.Expected), FFModelTypeRef::Parse(Entry.Expected) == TypeRef);
+	}
+
+	// As the parser fills them from an export, not from a string
+	FFModelTypeRef UnnamedStruct;
+	UnnamedStruct.Kind = EFModelPropertyKind::Struct;
+	UnnamedStruct.ClassPath = TEXT("/Game/Structs/F_NPC_PathWalkArray.0");
+	TestEqual(TEXT("Struct with a path but no name"), UnnamedStruct.ToString(), FString(TEXT("StructProperty||/Game/Structs/F_NPC_PathWalkArray.0")));
+
+	FFModelTypeRef UntypedArray;
+	UntypedArray.Container = EFModelContainerKind::Array;
+	TestEqual(TEXT("Array without an inner type"), UntypedArray.ToString(), FString(TEXT("ArrayProperty|")));
+	TestTrue(TEXT("Array without an inner type parsed again"), FFModelTypeRef::Parse(UntypedArray.ToString()) == UntypedArray);
+
+	TestTrue(TEXT("No type info"), FFModelTypeRef().ToString().IsEmpty());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,8 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "FModelClassDescriptor.h"
+#include "FModelExportSummary.h"
+#include "FModelImportPlan.h"
 #include "DummyBlueprintFunctionLibrary.generated.h"
 
+namespace FModelPipelinedImport
+{
+	/** Called on the game thread as each pipelined Blueprint is saved or fails (Blueprint is nullptr on failure) */
+	using FOnBlueprintDone = TFunctionRef<void(int32 Index, UBlueprint* Blueprint, const FString& Error, uint64 ContentHash)>;
+}
+
 /**
  * Function library for creating Blueprint functions programmatically
  */
@@ -20,12 +29,15 @@ public:
 	 * @param Blueprint - The Blueprint to add the function to
 	 * @param FunctionName - Name of the function to create
 	 * @param bHasReturnValue - Whether the function has a return value
-	 * @param ReturnValueType - The type of return value (e.g., "ClassProperty", "BoolProperty", etc.) - empty for wildcard
+	 * @param ReturnValueType - The type of return value in FFModelTypeRef string form (e.g., "BoolProperty", "ObjectProperty|Actor", "ArrayProperty|StructProperty|Vector") - empty for wildcard
 	 * @return True if successful
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
 	static bool AddFunctionStubToBlueprint(UBlueprint* Blueprint, FName FunctionName, bool bHasReturnValue = false, const FString& ReturnValueType = TEXT(""));
 
+	/** AddFunctionStubToBlueprint with the return type as parsed, without going through its string form */
+	static bool AddFunctionStubFromTypeRef(UBlueprint* Blueprint, FName FunctionName, bool bHasReturnValue, const FFModelTypeRef& ReturnType);
+
 	/**
 	 * Add multiple function stubs to a Blueprint from an array of names
 	 * @param Blueprint - The Blueprint to add functions to
@@ -36,6 +48,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
 	static int32 AddMultipleFunctionStubsToBlueprint(UBlueprint* Blueprint, const TArray<FName>& FunctionNames, const TArray<FString>& ReturnTypes);
 
+	/**
+	 * Add function stubs described by a parsed FModel export
+	 * @param Blueprint - The Blueprint to add functions to
+	 * @param Functions - Functions with their return type info
+	 * @return Number of functions successfully created
+	 */
+	static int32 AddFunctionDescriptorsToBlueprint(UBlueprint* Blueprint, const TArray<FFModelFunctionDescriptor>& Functions);
+
 	/**
 	 * Add components to a Blueprint from component data
 	 * @param Blueprint - The Blueprint to add components to
@@ -50,14 +70,40 @@ public:
 	 * Add member variables to a Blueprint
 	 * @param Blueprint - The Blueprint to add variables to
 	 * @param VariableNames - Array of variable names
-	 * @param VariableTypes - Array of variable types (e.g., "bool", "int32", "float")
+	 * @param VariableTypes - Array of variable types (e.g., "bool", "int32", "FString", "ObjectProperty|SceneComponent|/Script/Engine")
 	 * @return Number of variables successfully created
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
 	static int32 AddVariablesToBlueprint(UBlueprint* Blueprint, const TArray<FName>& VariableNames, const TArray<FString>& VariableTypes);
 
 	/**
-	 * Parse FModel JSON file and extract function names
+	 * Add member variables described by a parsed FModel export
+	 * @param Blueprint - The Blueprint to add variables to
+	 * @param Variables - Variables with their types
+	 * @return Number of variables successfully created
+	 */
+	static int32 AddVariableDescriptorsToBlueprint(UBlueprint* Blueprint, const TArray<FFModelVariableDescriptor>& Variables);
+
+	/**
+	 * Parse FModel JSON file into a class descriptor
+	 * @param JsonFilePath - Path to the JSON file
+	 * @param OutDescriptor - Parent class, functions, variables and components found
+	 * @return True if parsing was successful
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static bool ParseFModelClassDescriptor(const FString& JsonFilePath, FFModelClassDescriptor& OutDescriptor);
+
+	/**
+	 * Parse many FModel JSON files concurrently on the task graph
+	 * Touches no UObjects, so only Blueprint creation from the results has to happen on the game thread
+	 * @param JsonFilePaths - Paths to the JSON files
+	 * @return One result per path, in the same order, with the descriptor or the reason parsing failed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static TArray<FFModelParseResult> ParseFModelJSONBatch(const TArray<FString>& JsonFilePaths);
+
+	/**
+	 * Parse FModel JSON file and extract function names (parallel-array form of ParseFModelClassDescriptor)
 	 * @param JsonFilePath - Path to the JSON file
 	 * @param OutFunctionNames - Output array of function names found
 	 * @param OutComponentNames - Output array of component names found
@@ -71,23 +117,156 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
 	static bool ParseFModelJSON(const FString& JsonFilePath, TArray<FName>& OutFunctionNames, TArray<FName>& OutComponentNames, TArray<FString>& OutComponentClasses, TArray<FName>& OutVariableNames, TArray<FString>& OutVariableTypes, TArray<FString>& OutFunctionReturnTypes, FString& OutParentClassPath);
 
+	/** String form of a parsed return type, as ParseFModelJSON returns it (e.g., "ObjectProperty|BP_Foo_C|/Game/Foo/BP_Foo.0") */
+	UFUNCTION(BlueprintPure, Category = "Blueprint Function Creator")
+	static FString FModelTypeRefToString(const FFModelTypeRef& TypeRef);
+
+	/** Return type from its string form; unknown property kinds are kept as Unknown */
+	UFUNCTION(BlueprintPure, Category = "Blueprint Function Creator")
+	static FFModelTypeRef ParseFModelTypeRef(const FString& TypeString);
+
+	/**
+	 * Classify an FModel JSON export from its top-level structure, without parsing it
+	 * @param JsonFilePath - Path to the JSON file
+	 * @param OutSummary - Entry types, Blueprint class name and Super reference found
+	 * @return True if the file could be read
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static bool ClassifyFModelJSON(const FString& JsonFilePath, FFModelExportSummary& OutSummary);
+
+	/**
+	 * Classify many FModel JSON exports in parallel
+	 * @param JsonFilePaths - Paths to the JSON files
+	 * @return One summary per path, in the same order (unreadable files have bIsExportArray false)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static TArray<FFModelExportSummary> ClassifyFModelJSONFiles(const TArray<FString>& JsonFilePaths);
+
+	/**
+	 * Summarize every FModel JSON export under a folder, using the persistent index in Saved/FModelImport/
+	 * Unchanged files (same size and timestamp) are served from the index; only new or changed files are read
+	 * @param JsonFolder - Root of the FModel export tree
+	 * @return One summary per .json file under JsonFolder, sorted by path
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static TArray<FFModelExportSummary> IndexFModelExportFolder(const FString& JsonFolder);
+
+	/**
+	 * Order Blueprint exports so every parent is created before its children, in a single pass
+	 * The parent -> child graph is built once; inheritance cycles and parents missing from the tree are reported up front
+	 * @param Summaries - Structural summaries of the exports (e.g., from IndexFModelExportFolder)
+	 * @return Creation order of the Blueprint exports, plus the exports that cannot be ordered
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static FFModelImportPlan PlanFModelBlueprintImport(const TArray<FFModelExportSummary>& Summaries);
+
+	/**
+	 * Plan an import and resolve every parent, variable and return type it would need, without creating or saving anything
+	 * Resolution goes through the same code as the import itself, so the unresolved list is what the import would fall back on
+	 * @param Summaries - Structural summaries of the exports (e.g., from IndexFModelExportFolder)
+	 * @param MaxBufferedDescriptors - Most parsed descriptors waiting for the game thread; parsing pauses beyond it
+	 * @return The plan, the types that could not be resolved and per-stage timing
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static FFModelDryRunResult DryRunFModelBlueprintImport(const TArray<FFModelExportSummary>& Summaries, int32 MaxBufferedDescriptors = 64);
+
+	/**
+	 * Create one wave of Blueprints: exports that do not depend on each other (e.g., one Depth of an FFModelImportPlan)
+	 * All files are parsed concurrently first; only Blueprint creation and saving run on the game thread
+	 * @param JsonFilePaths - Paths to the JSON files
+	 * @param DestinationPaths - Where to create each Blueprint (parallel to JsonFilePaths)
+	 * @param AssetNames - Name of each Blueprint asset (parallel to JsonFilePaths)
+	 * @return Created Blueprints, errors and timing of the wave
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static FFModelWaveResult CreateBlueprintWaveFromFModelJSON(const TArray<FString>& JsonFilePaths, const TArray<FString>& DestinationPaths, const TArray<FString>& AssetNames);
+
+	/**
+	 * Create Blueprints through a bounded pipeline: threads read and parse ahead while the game thread loads referenced
+	 * packages ahead, creates, and saves in the background
+	 * Blueprints are created in input order, so pass parents before children (e.g., FFModelImportPlan order)
+	 * @param JsonFilePaths - Paths to the JSON files
+	 * @param DestinationPaths - Where to create each Blueprint (parallel to JsonFilePaths)
+	 * @param AssetNames - Name of each Blueprint asset (parallel to JsonFilePaths)
+	 * @param MaxBufferedDescriptors - Most parsed descriptors waiting for the game thread, and most package writes in flight
+	 * @return Created Blueprints, errors and per-stage timing
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static FFModelPipelineResult ImportFModelBlueprintsPipelined(const TArray<FString>& JsonFilePaths, const TArray<FString>& DestinationPaths, const TArray<FString>& AssetNames, int32 MaxBufferedDescriptors = 64);
+
+	/**
+	 * ImportFModelBlueprintsPipelined, reporting each Blueprint as soon as it is done
+	 * @param OnBlueprintDone - Called once per input file, in input order, once its package is written
+	 */
+	static FFModelPipelineResult ImportBlueprintsPipelined(const TArray<FString>& JsonFilePaths, const TArray<FString>& DestinationPaths, const TArray<FString>& AssetNames, int32 MaxBufferedDescriptors, FModelPipelinedImport::FOnBlueprintDone OnBlueprintDone);
+
+	/**
+	 * Patch the return pins and variables that were created with a generic type because a type they name did not
+	 * exist yet, now that it does. Call once after every Blueprint of an import was created; each affected
+	 * Blueprint is saved once.
+	 * @return How many pins were patched and how many still name a missing type
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static FFModelPinFixupResult ApplyFModelPinFixups();
+
 	/**
 	 * Create a complete Blueprint from FModel JSON
 	 * @param JsonFilePath - Path to the JSON file
 	 * @param DestinationPath - Where to create the Blueprint in Unreal (e.g., "/Game/Pal/Blueprint/")
 	 * @param AssetName - Name of the Blueprint asset to create
-	 * @return The created Blueprint, or nullptr if failed
+	 * @return The created Blueprint, or nullptr if it could not be parsed, created or saved
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
 	static UBlueprint* CreateBlueprintFromFModelJSON(const FString& JsonFilePath, const FString& DestinationPath, const FString& AssetName);
 
+	/**
+	 * CreateBlueprintFromFModelJSON, also reporting why no Blueprint was returned
+	 * @param OutStatus - Created, ParseFailed, CreateFailed or SaveFailed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static UBlueprint* CreateBlueprintFromFModelJSONWithStatus(const FString& JsonFilePath, const FString& DestinationPath, const FString& AssetName, EFModelCreateStatus& OutStatus);
+
+	/**
+	 * Create a complete Blueprint from a descriptor returned by ParseFModelClassDescriptor or ParseFModelJSONBatch
+	 * @param Descriptor - Parsed export
+	 * @param DestinationPath - Where to create the Blueprint in Unreal (e.g., "/Game/Pal/Blueprint/")
+	 * @param AssetName - Name of the Blueprint asset to create
+	 * @return The created Blueprint, or nullptr if it could not be created or saved
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static UBlueprint* CreateBlueprintFromParsedDescriptor(const FFModelClassDescriptor& Descriptor, const FString& DestinationPath, const FString& AssetName);
+
+	/**
+	 * CreateBlueprintFromParsedDescriptor, also reporting why no Blueprint was returned
+	 * @param OutStatus - Created, CreateFailed or SaveFailed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static UBlueprint* CreateBlueprintFromParsedDescriptorWithStatus(const FFModelClassDescriptor& Descriptor, const FString& DestinationPath, const FString& AssetName, EFModelCreateStatus& OutStatus);
+
+	/**
+	 * Create a complete Blueprint from an already parsed FModel export
+	 * @param Descriptor - Parsed export, consumed by the call
+	 * @param DestinationPath - Where to create the Blueprint in Unreal (e.g., "/Game/Pal/Blueprint/")
+	 * @param AssetName - Name of the Blueprint asset to create
+	 * @param OutStatus - Optional; Created, or why no Blueprint was returned
+	 * @return The created Blueprint, or nullptr if it could not be created or saved
+	 */
+	static UBlueprint* CreateBlueprintFromDescriptor(FFModelClassDescriptor&& Descriptor, const FString& DestinationPath, const FString& AssetName, EFModelCreateStatus* OutStatus = nullptr);
+
 	/**
 	 * Create a UserDefinedStruct from FModel JSON
 	 * @param JsonFilePath - Path to the JSON file containing UserDefinedStruct data
 	 * @param DestinationPath - Where to create the struct in Unreal (e.g., "/Game/Pal/Blueprint/Spawner/Other/")
 	 * @param StructName - Name of the struct asset to create
-	 * @return The created UserDefinedStruct, or nullptr if failed
+	 * @return The created UserDefinedStruct, or nullptr if it could not be created or saved
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
 	static UUserDefinedStruct* CreateUserDefinedStructFromJSON(const FString& JsonFilePath, const FString& DestinationPath, const FString& StructName);
+
+	/**
+	 * CreateUserDefinedStructFromJSON, also reporting why no struct was returned
+	 * @param OutStatus - Created, CreateFailed or SaveFailed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Blueprint Function Creator")
+	static UUserDefinedStruct* CreateUserDefinedStructFromJSONWithStatus(const FString& JsonFilePath, const FString& DestinationPath, const FString& StructName, EFModelCreateStatus& OutStatus);
 };
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelTypeRef.h"
+#include "FModelClassDescriptor.generated.h"
+
+/**
+ * A function found in an FModel export
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelFunctionDescriptor
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FName Name;
+
+	/** Return type; Kind Void for no return value, empty to auto-detect */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FFModelTypeRef ReturnType;
+};
+
+/**
+ * A member variable found in an FModel export
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelVariableDescriptor
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FName Name;
+
+	/** Variable type as understood by AddVariablesToBlueprint (e.g., "bool", "ObjectProperty|SceneComponent|/Script/Engine") */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FString Type;
+};
+
+/**
+ * A component template found in an FModel export
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelComponentDescriptor
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FName Name;
+
+	/** Component class name (e.g., "SceneComponent", "StaticMeshComponent") */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FString ComponentClass;
+};
+
+/**
+ * Everything ParseFModelJSON extracts from one Blueprint export.
+ * Each function and variable carries its own type, so there are no parallel arrays to keep aligned.
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelClassDescriptor
+{
+	GENERATED_BODY()
+
+	/** Parent class path (e.g., "/Game/Pal/Blueprint/Weapon/BP_GatlingGun.0"), or "CPP:ClassName" for native parents */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FString ParentClassPath;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	TArray<FFModelFunctionDescriptor> Functions;
+
+	/** Includes component references, which are imported as object variables */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	TArray<FFModelVariableDescriptor> Variables;
+
+	/** Component templates; the importer adds component references as variables instead, so the parser leaves this empty */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	TArray<FFModelComponentDescriptor> Components;
+};
+
+/** Outcome of parsing one file in a batch */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelParseResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString JsonFilePath;
+
+	/** True if the file was read and parsed; Descriptor is only meaningful in that case */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	bool bSuccess = false;
+
+	/** Why the file could not be parsed, empty on success */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString Error;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FFModelClassDescriptor Descriptor;
+
+	/** xxHash64 of the file's bytes where the parse path computed it, 0 otherwise (C++ only: no uint64 in Blueprints) */
+	uint64 ContentHash = 0;
+};
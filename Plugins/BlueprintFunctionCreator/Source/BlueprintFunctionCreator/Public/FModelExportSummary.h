@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelExportSummary.generated.h"
+
+/**
+ * What an FModel export file contains, as found by a structural pre-scan (no JSON DOM, no full parse).
+ * Enough for a batch driver to sort files into structs and Blueprints and order Blueprints by parent.
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelExportSummary
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString JsonFilePath;
+
+	/** True if the file could be read and its top-level value is an array */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	bool bIsExportArray = false;
+
+	/** "Type" of the first entry (e.g., "UserDefinedStruct") */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString FirstEntryType;
+
+	/** "Name" of the first entry */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString FirstEntryName;
+
+	/** True if any entry is a BlueprintGeneratedClass */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	bool bHasBlueprintClass = false;
+
+	/** "Name" of the first BlueprintGeneratedClass entry (e.g., "BP_GatlingGun_C") */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString BlueprintClassName;
+
+	/** True if that entry has a "Super" object */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	bool bHasSuper = false;
+
+	/** Super ObjectName (e.g., "BlueprintGeneratedClass'BP_WeaponBase_C'") */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString SuperObjectName;
+
+	/** Super ObjectPath (e.g., "/Game/Pal/Blueprint/Weapon/BP_WeaponBase.0") */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString SuperObjectPath;
+
+	/** Size of the file when it was indexed; only set by the export index */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int64 FileSize = 0;
+
+	/** Modification time of the file when it was indexed; only set by the export index */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FDateTime ModificationTime;
+};
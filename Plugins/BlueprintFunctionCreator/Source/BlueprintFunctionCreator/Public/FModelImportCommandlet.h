@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FModelImportCommandlet.generated.h"
+
+/**
+ * Headless import of an FModel export tree: UserDefinedStructs first, then Blueprints in dependency order.
+ *
+ * UnrealEditor-Cmd <Project>.uproject -run=FModelImport -Source=<export folder> [-Dest=/Game] [-Report=<file.json>] [-MaxBuffered=64] [-Shards=1] [-SkipStructs] [-Journal=<file>] [-ResetJournal] [-NoJournal] [-DryRun]
+ *
+ * With -Shards=N the Blueprint phase is split across up to N headless editor processes per stage
+ * (see FModelImportSharding), each running this commandlet on a -FileList, and their reports are merged.
+ *
+ * A resume journal (FFModelImportJournal; default Saved/FModelImport/Journal_<hash>.log, one per export tree
+ * and destination) records every asset as it is started and finished, so rerunning after a crash skips finished
+ * assets and rebuilds only the ones left half-written. -ResetJournal starts it over, -NoJournal disables it.
+ *
+ * With -DryRun nothing is created: every Blueprint export is parsed and its parent, variable and return
+ * types are resolved, and the report lists the types the import would not find.
+ *
+ * Writes a JSON summary to -Report (default Saved/FModelImport/ImportReport.json) and returns
+ * 0 if everything was created or already existed, 1 if any asset failed, 2 on bad arguments.
+ */
+UCLASS()
+class BLUEPRINTFUNCTIONCREATOR_API UFModelImportCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFModelImportCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
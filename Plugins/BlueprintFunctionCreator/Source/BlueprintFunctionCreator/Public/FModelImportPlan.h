@@ -0,0 +1,286 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelImportPlan.generated.h"
+
+class UBlueprint;
+
+/**
+ * One Blueprint export in creation order
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelImportPlanEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString JsonFilePath;
+
+	/** Generated class name (e.g., "BP_GatlingGun_C") */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString BlueprintClassName;
+
+	/** Parent Blueprint class name, empty for native parents or no Super */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString ParentClassName;
+
+	/** Index of the parent's entry in FFModelImportPlan::Entries, INDEX_NONE if the parent is not in the export tree */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 ParentIndex = INDEX_NONE;
+
+	/** Number of in-tree Blueprint ancestors; entries of the same depth do not depend on each other */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 Depth = 0;
+};
+
+/**
+ * Creation order for the Blueprints of an export tree, computed once from the parent -> child graph.
+ * Every parent that is in the tree comes before all of its children, so one pass creates everything.
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelImportPlan
+{
+	GENERATED_BODY()
+
+	/** Sorted by depth; roots keep their input order and children follow their parents' order */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FFModelImportPlanEntry> Entries;
+
+	/** Number of distinct depths in Entries */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumDepths = 0;
+
+	/** Parent Blueprint classes referenced by Entries but not exported; they must already exist in the project */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FString> MissingParentClassNames;
+
+	/** Exports on (or below) an inheritance cycle; they can never be created and are not in Entries */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FString> CyclicJsonFilePaths;
+
+	/** Exports whose class name was already defined by an earlier export; they are not in Entries */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FString> DuplicateJsonFilePaths;
+};
+
+/**
+ * Why a create call did or did not return an asset
+ */
+UENUM(BlueprintType)
+enum class EFModelCreateStatus : uint8
+{
+	Created,
+	/** The export could not be read or parsed */
+	ParseFailed,
+	/** The asset could not be created, e.g. because one of that name already exists */
+	CreateFailed,
+	/** The asset was built but its package could not be written; it was discarded, so a later attempt creates it again */
+	SaveFailed
+};
+
+/**
+ * Outcome of creating one wave (one inheritance depth) of Blueprints
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelWaveResult
+{
+	GENERATED_BODY()
+
+	/** One per input file, in the same order; nullptr where parsing or creation failed */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<TObjectPtr<UBlueprint>> Blueprints;
+
+	/** One per input file, in the same order; empty where the Blueprint was created */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FString> Errors;
+
+	/** Wall time of the parallel parse */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double ParseSeconds = 0.0;
+
+	/** Wall time of Blueprint creation and saving on the game thread */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double CreateSeconds = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumCreated = 0;
+};
+
+/**
+ * Outcome of a pipelined import
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelPipelineResult
+{
+	GENERATED_BODY()
+
+	/** One per input file, in the same order; nullptr where parsing or creation failed */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<TObjectPtr<UBlueprint>> Blueprints;
+
+	/** One per input file, in the same order; empty where the Blueprint was created */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FString> Errors;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumCreated = 0;
+
+	/** Wall time of the whole import */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double TotalSeconds = 0.0;
+
+	/** Time the read thread spent opening and hashing files, descriptor cache hits included */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double ReadSeconds = 0.0;
+
+	/** Parse time, summed over all workers */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double ParseSeconds = 0.0;
+
+	/** Game-thread time spent starting package loads for upcoming Blueprints and waiting for them */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double ResolveSeconds = 0.0;
+
+	/** Game-thread time spent creating Blueprints, saving excluded */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double CreateSeconds = 0.0;
+
+	/** Game-thread time spent waiting for parse results; near zero when creation is the bottleneck */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double CreateStallSeconds = 0.0;
+
+	/** Game-thread time spent serializing packages; they are written to disk in the background */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double SaveSeconds = 0.0;
+
+	/** Game-thread time spent waiting for package writes to finish */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double SaveWaitSeconds = 0.0;
+
+	/** Most parsed descriptors held in memory at once */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 PeakBufferedDescriptors = 0;
+
+	/** Types looked up for the first time (later lookups are cached) and found */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumProbedTypes = 0;
+
+	/** Locations tried to find them; divided by NumProbedTypes, the average probes per resolved type */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumTypeProbes = 0;
+};
+
+/**
+ * Outcome of patching the pins that were created before the types they name existed
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelPinFixupResult
+{
+	GENERATED_BODY()
+
+	/** Return pins and variables given their exported type */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumPatched = 0;
+
+	/** Pins that still name a type that does not exist, or whose Blueprint could not be saved; they stay pending */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumUnresolved = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumBlueprintsSaved = 0;
+
+	/** Blueprints whose patched pins could not be saved; the next ApplyFModelPinFixups retries them */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumBlueprintsNotSaved = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double Seconds = 0.0;
+};
+
+/**
+ * A type referenced by the exports that a dry run could not resolve; the importer would fall back to a generic type
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelUnresolvedType
+{
+	GENERATED_BODY()
+
+	/** "Parent", "Class", "Struct", "Enum" or "Property" (a property kind the importer does not know) */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString Kind;
+
+	/** Name as referenced (e.g., "BP_Foo_C", "F_Bar"), or the unknown property kind */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString Name;
+
+	/** Object path hinted by the first reference, empty if it had none */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString Path;
+
+	/** Parents, variables and return values referring to this type across all exports */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumReferences = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FString FirstJsonFilePath;
+};
+
+/**
+ * Outcome of a dry run: the creation plan and every type the import would fail to resolve, without creating any asset
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelDryRunResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	FFModelImportPlan Plan;
+
+	/** Most referenced first */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FFModelUnresolvedType> UnresolvedTypes;
+
+	/** "<reason>: <file>" for each planned export that could not be parsed */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	TArray<FString> ParseErrors;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumFunctions = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumVariables = 0;
+
+	/** Parent, variable and return types resolved */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumTypesResolved = 0;
+
+	/** References to Blueprints and structs the import itself creates; they cannot exist yet, so they are not counted as unresolved */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumTypesFromPlan = 0;
+
+	/** Wall time of the whole dry run */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double TotalSeconds = 0.0;
+
+	/** Time the read thread spent opening and hashing files, descriptor cache hits included */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double ReadSeconds = 0.0;
+
+	/** Parse time, summed over all workers */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double ParseSeconds = 0.0;
+
+	/** Game-thread time spent resolving types, package loads included */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	double ResolveSeconds = 0.0;
+
+	/** Types looked up for the first time (later lookups are cached) and found */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumProbedTypes = 0;
+
+	/** Locations tried to find them; divided by NumProbedTypes, the average probes per resolved type */
+	UPROPERTY(BlueprintReadOnly, Category = "Blueprint Function Creator")
+	int32 NumTypeProbes = 0;
+};
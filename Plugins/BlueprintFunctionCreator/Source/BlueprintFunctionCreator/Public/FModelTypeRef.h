@@ -0,0 +1,127 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FModelTypeRef.generated.h"
+
+/**
+ * Property kinds an FModel export can name ("BoolProperty", "ObjectProperty", ...), interned once by the parser
+ */
+UENUM(BlueprintType)
+enum class EFModelPropertyKind : uint8
+{
+	/** No type info; the importer guesses from the function name */
+	None,
+	/** The export lists the function but it returns nothing ("VOID") */
+	Void,
+	/** A kind the importer does not know; FFModelTypeRef keeps its name in ClassName */
+	Unknown,
+
+	Bool,
+	Byte,
+	Int,
+	Int64,
+	Float,
+	Double,
+	Str,
+	Name,
+	Text,
+	Enum,
+	Struct,
+	Object,
+	Class,
+	SoftObject,
+	SoftClass,
+	WeakObject,
+	Interface,
+	Delegate,
+	MulticastDelegate,
+	MulticastInlineDelegate,
+
+	/** Containers only appear in the string form; FFModelTypeRef holds them in Container */
+	Array UMETA(Hidden),
+	Map UMETA(Hidden),
+
+	Count UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EFModelContainerKind : uint8
+{
+	None,
+	Array,
+	Map
+};
+
+/**
+ * A function return type as the parser found it: the property kind, the container around it and the class,
+ * struct or enum it names. Kinds and short names are interned, so the importer switches on kinds instead of
+ * splitting strings; object paths stay strings so they neither grow the name table nor lose their case.
+ *
+ * The string form ("ObjectProperty|Class|Path", "ArrayProperty|Inner|Class|Path",
+ * "MapProperty|Key|Value|KeyClass|ValueClass", "VOID") is what the string-based Python API takes and returns.
+ */
+USTRUCT(BlueprintType)
+struct BLUEPRINTFUNCTIONCREATOR_API FFModelTypeRef
+{
+	GENERATED_BODY()
+
+	/** The element kind for an array, the value kind for a map */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	EFModelPropertyKind Kind = EFModelPropertyKind::None;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	EFModelContainerKind Container = EFModelContainerKind::None;
+
+	/** Map key kind; None unless Container is Map */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	EFModelPropertyKind KeyKind = EFModelPropertyKind::None;
+
+	/** Class, struct or enum named by Kind (e.g., "BP_Foo_C", "Vector"), or the exported name of an Unknown kind */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FName ClassName;
+
+	/** Object path of ClassName as exported ("/Game/.../BP_Foo.0"); empty for native types and map entries */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FString ClassPath;
+
+	/** Class, struct or enum named by KeyKind, or the exported name of an Unknown key kind */
+	UPROPERTY(BlueprintReadWrite, Category = "Blueprint Function Creator")
+	FName KeyClassName;
+
+	/** No type info at all */
+	bool IsEmpty() const
+	{
+		return Kind == EFModelPropertyKind::None && Container == EFModelContainerKind::None;
+	}
+
+	bool IsVoid() const
+	{
+		return Kind == EFModelPropertyKind::Void && Container == EFModelContainerKind::None;
+	}
+
+	/** The string form; empty for no type info */
+	FString ToString() const;
+
+	/** Read the string form; unknown kinds are kept as Unknown with their name */
+	static FFModelTypeRef Parse(FStringView TypeString);
+
+	/** Kind as exported ("BoolProperty", "VOID"); empty for None and Unknown */
+	static const TCHAR* GetKindName(EFModelPropertyKind Kind);
+
+	/** Interned kind of an exported name; Unknown if it is not one, None if it is empty. Case-insensitive */
+	static EFModelPropertyKind FindKind(FStringView KindName);
+	static EFModelPropertyKind FindKind(FUtf8StringView KindName);
+
+	bool operator==(const FFModelTypeRef& Other) const
+	{
+		return Kind == Other.Kind && Container == Other.Container && KeyKind == Other.KeyKind
+			&& ClassName == Other.ClassName && ClassPath.Equals(Other.ClassPath, ESearchCase::CaseSensitive) && KeyClassName == Other.KeyClassName;
+	}
+
+	bool operator!=(const FFModelTypeRef& Other) const
+	{
+		return !(*this == Other);
+	}
+};
@@ -29,8 +29,14 @@ from pathlib import Path
 class CompleteBlueprintConverter:
     """Creates COMPLETE Blueprint dummies with functions using the C++ plugin"""
     
-    def __init__(self, json_folder=None):
-        """Initialize converter with auto-detection"""
+    def __init__(self, json_folder=None, import_mode='pipeline'):
+        """Initialize converter with auto-detection
+        
+        import_mode:
+            'pipeline'   - workers parse ahead of game-thread creation, with a bounded buffer (fastest)
+            'waves'      - one inheritance depth at a time, each wave parsed in parallel
+            'sequential' - parse everything, then create one by one
+        """
         if json_folder is None:
             json_folder = self.find_json_folder()
             if json_folder is None:
@@ -38,6 +44,19 @@ class CompleteBlueprintConverter:
         
         self.json_folder = Path(json_folder)
         self.blueprint_lib = unreal.DummyBlueprintFunctionLibrary
+        self.import_mode = import_mode
+        
+        # Most parsed descriptors the pipeline may hold while the game thread catches up
+        self.max_buffered_descriptors = 64
+        
+        # Structural summaries from the plugin's pre-scan, keyed by file path
+        self.export_summaries = {}
+        
+        # Parsed descriptors from the plugin's batch parse, keyed by file path
+        self.parse_results = {}
+        
+        # Every JSON file under json_folder, from the plugin's persistent export index
+        self.all_json_files = []
         
         # Build a set of all Blueprint names we're going to create
         self.available_blueprints = set()
@@ -50,23 +69,43 @@ class CompleteBlueprintConverter:
             'errors': []
         }
     
+    def classify_files(self, json_files):
+        """Classify JSON files with the plugin's structural pre-scan (no json.load), cached per file"""
+        pending = [f for f in json_files if str(f) not in self.export_summaries]
+        if pending:
+            summaries = self.blueprint_lib.classify_f_model_json_files([str(f) for f in pending])
+            for json_file, summary in zip(pending, summaries):
+                self.export_summaries[str(json_file)] = summary
+        return [self.export_summaries[str(f)] for f in json_files]
+    
+    def get_export_summary(self, json_file):
+        """Structural summary of a single JSON file"""
+        return self.classify_files([json_file])[0]
+    
+    def parse_files(self, json_files):
+        """Parse JSON files concurrently in the plugin (one call, all cores), cached per file"""
+        pending = [f for f in json_files if str(f) not in self.parse_results]
+        if pending:
+            results = self.blueprint_lib.parse_f_model_json_batch([str(f) for f in pending])
+            for json_file, result in zip(pending, results):
+                self.parse_results[str(json_file)] = result
+    
+    def index_export_tree(self):
+        """Walk the export tree once via the plugin's persistent index (only new or changed files are re-read)"""
+        summaries = self.blueprint_lib.index_f_model_export_folder(str(self.json_folder))
+        self.all_json_files = []
+        for summary in summaries:
+            json_file = Path(summary.json_file_path)
+            self.export_summaries[str(json_file)] = summary
+            self.all_json_files.append(json_file)
+        return self.all_json_files
+    
     def _scan_available_blueprints(self):
         """Scan all JSON files to build a list of available Blueprints"""
-        import json
-        for json_file in self.json_folder.rglob('*.json'):
-            try:
-                with open(json_file, 'r', encoding='utf-8') as f:
-                    data = json.load(f)
-                if isinstance(data, list) and len(data) > 0:
-                    # Scan ALL entries to find the BlueprintGeneratedClass (it might not be first)
-                    for entry in data:
-                        if entry.get('Type') == 'BlueprintGeneratedClass':
-                            name = entry.get('Name', '')
-                            if name:
-                                self.available_blueprints.add(name)
-                                break  # Only need one BlueprintGeneratedClass per file
-            except Exception:
-                pass
+        for summary in self.classify_files(self.index_export_tree()):
+            # The pre-scan finds the BlueprintGeneratedClass wherever it is (it might not be first)
+            if summary.has_blueprint_class and summary.blueprint_class_name:
+                self.available_blueprints.add(summary.blueprint_class_name)
         
         unreal.log(f"Found {len(self.available_blueprints)} Blueprints to create")
         # Debug: show first 10
@@ -99,20 +138,18 @@ class CompleteBlueprintConverter:
         try:
             unreal.log(f"  📄 Reading JSON: {json_file.name}")
             
-            # Parse JSON to validate
-            with open(json_file, 'r', encoding='utf-8') as f:
-                data = json.load(f)
+            # Validate with the structural pre-scan
+            summary = self.get_export_summary(json_file)
             
-            if not isinstance(data, list) or len(data) == 0:
+            if not summary.is_export_array or not summary.first_entry_type:
                 unreal.log_warning(f"  ⚠️ Invalid JSON format (not a list or empty)")
                 return False
             
-            entry = data[0]
-            if entry.get('Type') != 'UserDefinedStruct':
-                unreal.log_warning(f"  ⚠️ Not a UserDefinedStruct (type: {entry.get('Type')})")
+            if summary.first_entry_type != 'UserDefinedStruct':
+                unreal.log_warning(f"  ⚠️ Not a UserDefinedStruct (type: {summary.first_entry_type})")
                 return False
             
-            struct_name = entry.get('Name', '')
+            struct_name = summary.first_entry_name
             if not struct_name:
                 unreal.log_warning(f"  ⚠️ No struct name found in JSON")
                 return False
@@ -135,7 +172,7 @@ class CompleteBlueprintConverter:
             
             # Use C++ plugin to create the struct
             unreal.log(f"  🔨 Creating struct asset via C++ plugin...")
-            new_struct = self.blueprint_lib.create_user_defined_struct_from_json(
+            new_struct, status = self.blueprint_lib.create_user_defined_struct_from_json_with_status(
                 str(json_file),
                 dest_path,
                 struct_name
@@ -145,7 +182,7 @@ class CompleteBlueprintConverter:
                 unreal.log(f"  ✅ Created struct: {struct_name} at {full_path}")
                 return True
             else:
-                unreal.log_error(f"  ❌ Failed to create struct (C++ function returned None)")
+                unreal.log_error(f"  ❌ Failed to create struct ({status})")
                 return False
                 
         except Exception as e:
@@ -160,16 +197,12 @@ class CompleteBlueprintConverter:
         unreal.log("📦 CREATING USER-DEFINED STRUCTS (Phase 1)")
         unreal.log("="*80 + "\n")
         
-        struct_files = []
-        for json_file in self.json_folder.rglob('F_*.json'):
-            try:
-                with open(json_file, 'r', encoding='utf-8') as f:
-                    data = json.load(f)
-                if isinstance(data, list) and len(data) > 0:
-                    if data[0].get('Type') == 'UserDefinedStruct':
-                        struct_files.append(json_file)
-            except Exception:
-                pass
+        candidates = [f for f in self.all_json_files if f.name.startswith('F_')]
+        struct_files = [
+            json_file
+            for json_file, summary in zip(candidates, self.classify_files(candidates))
+            if summary.is_export_array and summary.first_entry_type == 'UserDefinedStruct'
+        ]
         
         unreal.log(f"Found {len(struct_files)} UserDefinedStruct files\n")
         
@@ -252,11 +285,25 @@ class CompleteBlueprintConverter:
         
         try:
             # Use plugin to create complete Blueprint!
-            blueprint = self.blueprint_lib.create_blueprint_from_f_model_json(
-                str(json_file),
-                dest_path,
-                asset_name
-            )
+            # Files parsed up front by parse_files() only need the game-thread creation step
+            parse_result = self.parse_results.pop(str(json_file), None)
+            if parse_result is not None and not parse_result.success:
+                unreal.log_warning(f"❌ Failed to parse: {json_file.name} ({parse_result.error})")
+                self.stats['failed'] += 1
+                return False
+            
+            if parse_result is not None:
+                blueprint, status = self.blueprint_lib.create_blueprint_from_parsed_descriptor_with_status(
+                    parse_result.descriptor,
+                    dest_path,
+                    asset_name
+                )
+            else:
+                blueprint, status = self.blueprint_lib.create_blueprint_from_f_model_json_with_status(
+                    str(json_file),
+                    dest_path,
+                    asset_name
+                )
             
             if blueprint:
                 # Force save the Blueprint
@@ -270,7 +317,7 @@ class CompleteBlueprintConverter:
                 self.stats['created'] += 1
                 return True
             else:
-                unreal.log_warning(f"❌ Failed to create: {asset_name}")
+                unreal.log_warning(f"❌ Failed to create: {asset_name} ({status})")
                 self.stats['failed'] += 1
                 return False
                 
@@ -283,249 +330,170 @@ class CompleteBlueprintConverter:
     
     def is_blueprint_json(self, json_file):
         """Check if JSON file is a BlueprintGeneratedClass"""
-        import json
-        
-        try:
-            with open(json_file, 'r', encoding='utf-8') as f:
-                data = json.load(f)
-            
-            if isinstance(data, list) and len(data) > 0:
-                # Scan ALL entries to find the BlueprintGeneratedClass (it might not be first)
-                for entry in data:
-                    if entry.get('Type') == 'BlueprintGeneratedClass':
-                        return True
-                return False
-            
-            return False
-            
-        except Exception:
-            return False
-    
-    def check_parent_exists(self, json_file):
-        """Check if the parent Blueprint exists for this JSON file"""
-        import json
-        
-        try:
-            with open(json_file, 'r', encoding='utf-8') as f:
-                data = json.load(f)
-            
-            # Look for BlueprintGeneratedClass with Super field
-            if isinstance(data, list) and len(data) > 0:
-                # Scan ALL entries to find the BlueprintGeneratedClass (it might not be first)
-                blueprint_entry = None
-                for entry in data:
-                    if entry.get('Type') == 'BlueprintGeneratedClass':
-                        blueprint_entry = entry
-                        break
-                
-                if blueprint_entry:
-                    super_obj = blueprint_entry.get('Super')
-                    if super_obj and isinstance(super_obj, dict):
-                        parent_name = super_obj.get('ObjectName', '')
-                        parent_path = super_obj.get('ObjectPath', '')
-                        
-                        if parent_path and parent_path.startswith('/Game/'):
-                            # Extract the parent class name from ObjectName (e.g., "BlueprintGeneratedClass'BP_GatlingGun_C'")
-                            if parent_name.startswith('BlueprintGeneratedClass'):
-                                # Extract class name: "BlueprintGeneratedClass'BP_GatlingGun_C'" -> "BP_GatlingGun_C"
-                                parent_class_name = parent_name.split("'")[1] if "'" in parent_name else ""
-                                
-                                unreal.log(f"  Checking parent: {parent_class_name}, In available list: {parent_class_name in self.available_blueprints}")
-                                
-                                # Check if this parent is in our list of Blueprints to create
-                                if parent_class_name in self.available_blueprints:
-                                    # Parent is a Blueprint we're creating, check if it exists yet
-                                    # Remove the _C suffix to get the asset name
-                                    parent_asset_name = parent_class_name.replace('_C', '')
-                                    # Remove the .0 or other suffixes from the path and build proper path
-                                    parent_asset_path = parent_path.rsplit('.', 1)[0]  # Remove .0
-                                    # Use asset name (remove _C suffix only from end) for existence check
-                                    if parent_class_name.endswith('_C'):
-                                        parent_asset_name = parent_class_name[:-2]  # Remove last 2 characters
-                                    else:
-                                        parent_asset_name = parent_class_name
-                                    parent_full_path = f"{parent_asset_path}.{parent_asset_name}"
-                                    
-                                    exists = unreal.EditorAssetLibrary.does_asset_exist(parent_full_path)
-                                    unreal.log(f"  Checking path: {parent_full_path}, Exists: {exists}")
-                                    
-                                    # If not found, try with /Content/Pal/ prefix (Unreal may remap paths)
-                                    if not exists and parent_asset_path.startswith('/Game/Pal/') and not parent_asset_path.startswith('/Game/Pal/Content/'):
-                                        # The actual structure is /Game/Pal/Content/Pal/...
-                                        alt_path = parent_asset_path.replace('/Game/Pal/', '/Game/Pal/Content/Pal/')
-                                        alt_full_path = f"{alt_path}.{parent_asset_name}"
-                                        exists = unreal.EditorAssetLibrary.does_asset_exist(alt_full_path)
-                                        if exists:
-                                            unreal.log(f"  ✓ Found at alternate path: {alt_full_path}")
-                                        else:
-                                            unreal.log(f"  ✗ Also checked: {alt_full_path}, Exists: {exists}")
-                                    
-                                    if not exists:
-                                        unreal.log(f"  ⏸️ Waiting for parent: {parent_class_name}")
-                                    else:
-                                        unreal.log(f"  ✅ Parent exists: {parent_class_name}")
-                                    return exists
-                                else:
-                                    # Parent is not in our JSON files, it's from the original game
-                                    # We can't create it, so just use AActor as parent
-                                    unreal.log(f"  ⚠️ Parent not in JSON files (will use AActor): {parent_class_name}")
-                                    return True
-                            else:
-                                # It's a native class, can proceed
-                                return True
-            
-            # No parent specified, can proceed
-            return True
-            
-        except Exception as e:
-            unreal.log_warning(f"Error checking parent for {json_file.name}: {str(e)}")
-            return True  # Proceed anyway if we can't check
-    
-    def sort_by_dependencies(self, json_files):
-        """Sort JSON files by dependency order - parents before children"""
-        import json
-        
-        # Build dependency map: child -> parent_file
-        file_to_class = {}  # json_file -> class_name
-        class_to_file = {}  # class_name -> json_file
-        dependencies = {}   # child_class -> parent_class
-        
-        # First pass: map files to class names
-        for json_file in json_files:
-            try:
-                with open(json_file, 'r', encoding='utf-8') as f:
-                    data = json.load(f)
-                
-                if isinstance(data, list) and len(data) > 0:
-                    for entry in data:
-                        if entry.get('Type') == 'BlueprintGeneratedClass':
-                            class_name = entry.get('Name', '')
-                            if class_name:
-                                file_to_class[json_file] = class_name
-                                class_to_file[class_name] = json_file
-                                
-                                # Extract parent dependency
-                                super_obj = entry.get('Super')
-                                if super_obj and isinstance(super_obj, dict):
-                                    parent_name = super_obj.get('ObjectName', '')
-                                    if parent_name.startswith('BlueprintGeneratedClass'):
-                                        if "'" in parent_name:
-                                            parent_class = parent_name.split("'")[1]
-                                            dependencies[class_name] = parent_class
-                                break
-            except Exception:
-                continue
-        
-        # Topological sort - parents before children
-        sorted_files = []
-        processed = set()
-        in_progress = set()
-        
-        def visit(json_file):
-            if json_file in processed:
-                return
-            if json_file in in_progress:
-                return  # Circular dependency, skip
-                
-            class_name = file_to_class.get(json_file)
-            if not class_name:
-                sorted_files.append(json_file)
-                processed.add(json_file)
-                return
-                
-            in_progress.add(json_file)
-            
-            # Process parent first
-            parent_class = dependencies.get(class_name)
-            if parent_class and parent_class in class_to_file:
-                parent_file = class_to_file[parent_class]
-                if parent_file not in processed:
-                    visit(parent_file)
-            
-            # Now process this file
-            sorted_files.append(json_file)
-            processed.add(json_file)
-            in_progress.remove(json_file)
-        
-        # Visit all files
-        for json_file in json_files:
-            visit(json_file)
-            
-        unreal.log(f"  Sorted {len(sorted_files)} files by dependency order")
-        return sorted_files
+        # The pre-scan finds the BlueprintGeneratedClass wherever it is (it might not be first)
+        return self.get_export_summary(json_file).has_blueprint_class
     
+    def plan_blueprints(self, json_files):
+        """Creation order from the plugin's dependency scheduler (parents before children, one pass)"""
+        plan = self.blueprint_lib.plan_f_model_blueprint_import(self.classify_files(json_files))
+        
+        if plan.missing_parent_class_names:
+            unreal.log(f"  {len(plan.missing_parent_class_names)} parent Blueprints are not in the JSON files (must already exist, else AActor is used)")
+        for cyclic_file in plan.cyclic_json_file_paths:
+            unreal.log_warning(f"  ⚠️ Inheritance cycle, skipping: {Path(cyclic_file).name}")
+            self.stats['errors'].append(f"Inheritance cycle: {Path(cyclic_file).name}")
+        for duplicate_file in plan.duplicate_json_file_paths:
+            unreal.log_warning(f"  ⚠️ Class already defined by another file, skipping: {Path(duplicate_file).name}")
+        
+        unreal.log(f"  Planned {len(plan.entries)} files over {plan.num_depths} inheritance depths")
+        return plan
+
+    def dry_run(self):
+        """Parse every Blueprint export and resolve its types through the plugin, without creating any asset"""
+        unreal.log("Dry run: planning and resolving types, nothing will be created...")
+        result = self.blueprint_lib.dry_run_f_model_blueprint_import(self.classify_files(self.all_json_files), self.max_buffered_descriptors)
+
+        unreal.log(f"  Planned {len(result.plan.entries)} files over {result.plan.num_depths} inheritance depths")
+        unreal.log(f"  {result.num_functions} functions, {result.num_variables} variables")
+        unreal.log(f"  {result.num_types_resolved} types resolved, {result.num_types_from_plan} created by this import, "
+                   f"{len(result.unresolved_types)} unresolved")
+        for unresolved in result.unresolved_types[:20]:
+            unreal.log_warning(f"  ⚠️ {unresolved.kind} {unresolved.name}: {unresolved.num_references} references "
+                               f"(first in {Path(unresolved.first_json_file_path).name})")
+        if len(result.unresolved_types) > 20:
+            unreal.log(f"  ... and {len(result.unresolved_types) - 20} more")
+        for parse_error in result.parse_errors:
+            unreal.log_warning(f"  ❌ {parse_error}")
+
+        unreal.log(f"  Dry run: {result.total_seconds:.2f}s total, read {result.read_seconds:.2f}s, "
+                   f"parse {result.parse_seconds:.2f}s (all workers), resolve {result.resolve_seconds:.2f}s")
+        return result
+
     def process_all(self):
-        """Process all JSON files with multi-pass for parent dependencies"""
-        all_json_files = list(self.json_folder.rglob('*.json'))
-        
-        # Filter to only Blueprint JSON files
-        unreal.log("Filtering Blueprint JSON files...")
-        json_files = [f for f in all_json_files if self.is_blueprint_json(f)]
+        """Process all Blueprint JSON files once, in dependency order"""
+        all_json_files = self.all_json_files
         
-        # Sort by dependency order - parents first
-        unreal.log("Sorting by dependency order...")
-        json_files = self.sort_by_dependencies(json_files)
+        # Order Blueprint exports parents-first; non-Blueprint files are dropped by the scheduler
+        unreal.log("Planning Blueprint creation order...")
+        plan = self.plan_blueprints(all_json_files)
+        json_files = [Path(entry.json_file_path) for entry in plan.entries]
         
         total = len(json_files)
-        non_blueprint_count = len(all_json_files) - total
+        unordered = len(plan.cyclic_json_file_paths)
+        non_blueprint_count = len(all_json_files) - total - unordered - len(plan.duplicate_json_file_paths)
         
         unreal.log("\n" + "="*80)
         unreal.log("COMPLETE BLUEPRINT CREATION - WITH FUNCTIONS!")
         unreal.log("="*80)
         unreal.log(f"Found {total} Blueprint JSON files (skipping {non_blueprint_count} non-Blueprint files)")
-        unreal.log(f"Processing with dependency resolution...")
+        unreal.log(f"Processing in dependency order...")
         unreal.log("="*80 + "\n")
         
-        skipped = []
-        max_passes = 15  # Prevent infinite loops - increased for better dependency resolution
-        current_pass = 1
-        
-        while json_files and current_pass <= max_passes:
-            if current_pass > 1:
-                unreal.log(f"\n{'='*60}")
-                unreal.log(f"PASS {current_pass}: Processing {len(json_files)} remaining files...")
-                unreal.log(f"{'='*60}\n")
-            
-            still_skipped = []
+        if self.import_mode == 'pipeline':
+            self.process_pipelined(plan)
+        elif self.import_mode == 'waves':
+            self.process_waves(plan)
+        else:
+            # Parse every Blueprint export concurrently before the game-thread creation pass
+            unreal.log("Parsing Blueprint JSON files...")
+            self.parse_files(json_files)
             
+            # Every parent in the export tree comes before its children, so a single pass creates everything
             for i, json_file in enumerate(json_files, 1):
-                # Check if parent exists
-                if not self.check_parent_exists(json_file):
-                    unreal.log(f"[{i}/{len(json_files)}] ⏸️ Skipping (parent missing): {json_file.name}")
-                    still_skipped.append(json_file)
-                    continue
-                
-                unreal.log(f"\n[{i}/{len(json_files)}] {json_file.name}")
+                unreal.log(f"\n[{i}/{total}] {json_file.name}")
                 self.process_json_file(json_file)
                 
                 # Progress update every 50 files
                 if (self.stats['total']) % 50 == 0:
                     self.print_progress(self.stats['total'], total)
-            
-            # Check if we made progress
-            if len(still_skipped) == len(json_files):
-                # No progress made, parents are missing and won't be created
-                unreal.log_warning(f"\n⚠️ Could not resolve {len(still_skipped)} files due to missing parents")
-                for sf in still_skipped:
-                    self.stats['failed'] += 1
-                    self.stats['total'] += 1
-                break
-            
-            json_files = still_skipped
-            current_pass += 1
-            
-            # Force asset registry refresh between passes to pick up newly created assets
-            if json_files and current_pass <= max_passes:
-                unreal.log(f"🔄 Refreshing asset registry for pass {current_pass}...")
-                # Give UE5 a moment to fully process the assets
-                import time
-                time.sleep(0.1)
         
-        if current_pass > max_passes:
-            unreal.log_warning(f"⚠️ Reached maximum passes ({max_passes})")
+        # Pins that named a Blueprint or struct created later in this run get their real type now
+        fixups = self.blueprint_lib.apply_f_model_pin_fixups()
+        if fixups.num_patched or fixups.num_unresolved:
+            unreal.log(f"Pin fixups: {fixups.num_patched} patched in {fixups.num_blueprints_saved} Blueprints, "
+                       f"{fixups.num_unresolved} still unresolved ({fixups.seconds:.2f}s)")
+        
+        # Exports on an inheritance cycle can never be created
+        self.stats['failed'] += unordered
+        self.stats['total'] += unordered
         
         self.print_summary()
     
+    def prepare_creation(self, json_files):
+        """Destination and asset name per file, dropping files whose asset already exists"""
+        json_paths, dest_paths, asset_names = [], [], []
+        for json_file in json_files:
+            self.stats['total'] += 1
+            dest_path, asset_name = self.get_destination_path(json_file)
+            if not dest_path or not asset_name:
+                self.stats['errors'].append(f"Could not determine path for: {json_file.name}")
+                self.stats['failed'] += 1
+                continue
+            if unreal.EditorAssetLibrary.does_asset_exist(f"{dest_path}/{asset_name}"):
+                unreal.log(f"⏭️ Skipping existing: {asset_name}")
+                continue
+            json_paths.append(str(json_file))
+            dest_paths.append(dest_path)
+            asset_names.append(asset_name)
+        return json_paths, dest_paths, asset_names
+    
+    def record_results(self, json_paths, asset_names, blueprints, errors):
+        """Update stats from the per-file results of a native batch creation"""
+        for json_path, asset_name, blueprint, error in zip(json_paths, asset_names, blueprints, errors):
+            if blueprint:
+                self.available_blueprints.add(asset_name)
+                self.stats['created'] += 1
+            else:
+                unreal.log_warning(f"❌ {error}: {Path(json_path).name}")
+                self.stats['errors'].append(f"{error}: {asset_name}")
+                self.stats['failed'] += 1
+    
+    def process_pipelined(self, plan):
+        """Create all Blueprints in plan order while plugin workers parse ahead (bounded buffer)"""
+        json_paths, dest_paths, asset_names = self.prepare_creation([Path(entry.json_file_path) for entry in plan.entries])
+        if not json_paths:
+            return
+        
+        result = self.blueprint_lib.import_f_model_blueprints_pipelined(json_paths, dest_paths, asset_names, self.max_buffered_descriptors)
+        self.record_results(json_paths, asset_names, result.blueprints, result.errors)
+        
+        # Stall near zero means game-thread creation is the bottleneck; high stall means parsing is
+        unreal.log(f"\nPipeline: {result.total_seconds:.2f}s total, read {result.read_seconds:.2f}s, "
+                   f"parse {result.parse_seconds:.2f}s (all workers), resolve {result.resolve_seconds:.2f}s, "
+                   f"create {result.create_seconds:.2f}s, save {result.save_seconds:.2f}s, "
+                   f"waited for parse {result.create_stall_seconds:.2f}s, for writes {result.save_wait_seconds:.2f}s, "
+                   f"peak {result.peak_buffered_descriptors} descriptors buffered")
+    
+    def process_waves(self, plan):
+        """Create Blueprints one inheritance depth at a time; each wave is parsed in parallel by the plugin"""
+        waves = [[] for _ in range(plan.num_depths)]
+        for entry in plan.entries:
+            waves[entry.depth].append(Path(entry.json_file_path))
+        
+        total = len(plan.entries)
+        wave_timings = []
+        
+        for depth, wave_files in enumerate(waves):
+            unreal.log(f"\n{'='*60}")
+            unreal.log(f"WAVE {depth + 1}/{len(waves)}: {len(wave_files)} Blueprints")
+            unreal.log(f"{'='*60}\n")
+            
+            json_paths, dest_paths, asset_names = self.prepare_creation(wave_files)
+            if not json_paths:
+                continue
+            
+            wave = self.blueprint_lib.create_blueprint_wave_from_f_model_json(json_paths, dest_paths, asset_names)
+            self.record_results(json_paths, asset_names, wave.blueprints, wave.errors)
+            
+            wave_timings.append((depth, len(json_paths), wave.parse_seconds, wave.create_seconds))
+            self.print_progress(self.stats['total'], total)
+        
+        # Per-wave timing shows whether parsing or game-thread creation is the critical path
+        unreal.log("\nWave timings (depth: files, parse s, create s):")
+        for depth, count, parse_seconds, create_seconds in wave_timings:
+            unreal.log(f"  {depth}: {count}, {parse_seconds:.2f}, {create_seconds:.2f}")
+        unreal.log(f"  total: parse {sum(t[2] for t in wave_timings):.2f}s, create {sum(t[3] for t in wave_timings):.2f}s")
+    
     def print_progress(self, current, total):
         """Print progress update"""
         percentage = (current * 100) // total